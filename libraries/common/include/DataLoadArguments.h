@@ -28,6 +28,12 @@ namespace common
         /// <summary> The number of elements in an input data vector. </summary>
         std::string dataDimension = "";
 
+        /// <summary> The number of threads that run examples through a map without state, each with its own copy of the map (0 uses all hardware threads). </summary>
+        size_t numMapThreads = 1;
+
+        /// <summary> The number of threads that parse a text data file (0 uses all hardware threads). With one thread, the file is parsed line by line as the dataset is built. </summary>
+        size_t numParseThreads = 1;
+
         // not exposed on the command line
         size_t parsedDataDimension = 0;
     };
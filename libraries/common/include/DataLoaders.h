@@ -11,13 +11,16 @@
 #include "DataLoadArguments.h"
 
 // data
+#include "CompactDataset.h"
 #include "Dataset.h"
+#include "DatasetBlockIterator.h"
 #include "ParsingExampleIterator.h"
 
 // model
 #include "DynamicMap.h"
 
 // stl
+#include <memory>
 #include <string>
 
 namespace ell
@@ -31,7 +34,17 @@ namespace common
     /// <returns> The data iterator. </returns>
     std::unique_ptr<data::IParsingExampleIterator> GetDataIterator(const DataLoadArguments& dataLoadArguments);
 
-    /// <summary> Gets a dataset from data load arguments. </summary>
+    /// <summary> Returns true if the data file is loaded into a CompactDataset (see GetDataset&lt;data::CompactDataset&gt;)
+    /// before a dataset is built from it, which is the case for binary datasets and for text files parsed by more than one
+    /// thread. Otherwise, the file is parsed line by line as the dataset is built. </summary>
+    ///
+    /// <param name="dataLoadArguments"> The data load arguments. </param>
+    ///
+    /// <returns> true if the data file is loaded into a CompactDataset. </returns>
+    bool IsLoadedAsCompactDataset(const DataLoadArguments& dataLoadArguments);
+
+    /// <summary> Gets a dataset from data load arguments. If IsLoadedAsCompactDataset, the data file is loaded into a
+    /// CompactDataset, whose examples are then copied into the dataset. Otherwise, the examples are added as they are parsed. </summary>
     ///
     /// <typeparam name="DatasetType"> Dataset type. </typeparam>
     /// <param name="dataLoadArguments"> The data load arguments. </param>
@@ -40,9 +53,21 @@ namespace common
     template <typename DatasetType = data::AutoSupervisedDataset>
     DatasetType GetDataset(const DataLoadArguments& dataLoadArguments);
 
+    /// <summary> Gets a CompactDataset from data load arguments. If the data file is a binary dataset
+    /// (see CompactDataset::Write), it is memory-mapped and no parsing or copying takes place. Otherwise, the
+    /// text file is parsed with data::ParseCompactDatasetFile, by DataLoadArguments::numParseThreads threads. </summary>
+    ///
+    /// <param name="dataLoadArguments"> The data load arguments. </param>
+    ///
+    /// <returns> The dataset. </returns>
+    template <>
+    data::CompactDataset GetDataset<data::CompactDataset>(const DataLoadArguments& dataLoadArguments);
+
     /// <summary>
-    /// Gets a dataset by loading it according to data load arguments and then running it through a
-    /// map.
+    /// Gets a dataset by loading it according to data load arguments and running it through a map. If
+    /// IsLoadedAsCompactDataset, or if more than one thread runs the map, the data file is loaded into a CompactDataset,
+    /// whose examples are passed to the map as views. Otherwise, each example is mapped and added as it is parsed, so
+    /// only the mapped dataset is kept in memory.
     /// </summary>
     ///
     /// <typeparam name="DatasetType"> The Dataset type. </typeparam>
@@ -52,6 +77,38 @@ namespace common
     /// <returns> The dataset. </returns>
     template <typename DatasetType = data::AutoSupervisedDataset>
     DatasetType GetMappedDataset(const DataLoadArguments& dataLoadArguments, const model::DynamicMap& map);
+
+    /// <summary>
+    /// Gets a dataset by running the examples of a CompactDataset through a map. The examples are passed
+    /// to the map as views into the CompactDataset. With several threads, each thread runs a contiguous
+    /// range of examples through its own copy of the map, and the mapped examples keep their order. A map
+    /// with state (see model::DynamicMap::HasState) always runs on a single thread, so its outputs don't
+    /// depend on the number of threads.
+    /// </summary>
+    ///
+    /// <typeparam name="DatasetType"> The Dataset type. </typeparam>
+    /// <param name="dataset"> The CompactDataset. </param>
+    /// <param name="map"> The map. </param>
+    /// <param name="numMapThreads"> The number of threads that run examples through the map (0 uses all hardware threads), ignored if the map has state. </param>
+    ///
+    /// <returns> The dataset. </returns>
+    template <typename DatasetType = data::AutoSupervisedDataset>
+    DatasetType GetMappedDataset(const data::CompactDataset& dataset, const model::DynamicMap& map, size_t numMapThreads = 1);
+
+    /// <summary>
+    /// Gets an iterator that streams the dataset described by data load arguments in blocks, running each
+    /// example through a map. Parsing and mapping take place on a background thread, one block ahead of the
+    /// block in use, so the memory used doesn't depend on the size of the dataset.
+    /// </summary>
+    ///
+    /// <typeparam name="DatasetType"> The Dataset type of each block. </typeparam>
+    /// <param name="dataLoadArguments"> The data load arguments. </param>
+    /// <param name="map"> The map, which must outlive the iterator and must not be used elsewhere while the iterator exists. </param>
+    /// <param name="blockSize"> The number of examples in each block. </param>
+    ///
+    /// <returns> The block iterator. </returns>
+    template <typename DatasetType = data::AutoSupervisedDataset>
+    std::unique_ptr<data::DatasetBlockIterator<DatasetType>> GetMappedDatasetBlockIterator(const DataLoadArguments& dataLoadArguments, const model::DynamicMap& map, size_t blockSize);
 }
 }
 
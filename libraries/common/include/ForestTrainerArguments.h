@@ -15,6 +15,9 @@
 #include "HistogramForestTrainer.h"
 #include "SortingForestTrainer.h"
 
+// stl
+#include <string>
+
 namespace ell
 {
 namespace common
@@ -22,6 +25,9 @@ namespace common
     struct ForestTrainerArguments : public trainers::SortingForestTrainerParameters, public trainers::HistogramForestTrainerParameters
     {
         bool sortingTrainer;
+
+        // a model file with a forest predictor node whose forest training continues from (warm start)
+        std::string warmStartModelFilename;
     };
 
     /// <summary> Parsed version of sorting tree trainer parameters. </summary>
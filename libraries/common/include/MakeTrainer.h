@@ -47,8 +47,9 @@ namespace common
     ///
     /// <param name="lossArguments"> loss arguments. </param>
     /// <param name="trainerArguments"> trainer arguments. </param>
+    /// <param name="initialPredictor"> The forest that training continues from, which is empty by default. </param>
     ///
     /// <returns> A unique_ptr to a forest trainer. </returns>
-    std::unique_ptr<trainers::ITrainer<predictors::SimpleForestPredictor>> MakeForestTrainer(const LossArguments& lossArguments, const ForestTrainerArguments& trainerArguments);
+    std::unique_ptr<trainers::ITrainer<predictors::SimpleForestPredictor>> MakeForestTrainer(const LossArguments& lossArguments, const ForestTrainerArguments& trainerArguments, const predictors::SimpleForestPredictor& initialPredictor = predictors::SimpleForestPredictor());
 }
 }
@@ -37,6 +37,20 @@ namespace common
             "dd",
             "Number of elements to read from each data vector",
             "");
+
+        parser.AddOption(
+            numMapThreads,
+            "numMapThreads",
+            "nmt",
+            "Number of threads that run the data through the map, each with its own copy of the map (0 uses all hardware threads). Maps with state, such as moving statistics, always run on a single thread",
+            1);
+
+        parser.AddOption(
+            numParseThreads,
+            "numParseThreads",
+            "npt",
+            "Number of threads that parse a text data file (0 uses all hardware threads). With more than one, the whole file is parsed into memory before the dataset is built",
+            1);
     }
 
     utilities::CommandLineParseResult ParsedDataLoadArguments::PostProcess(const utilities::CommandLineParser& parser)
@@ -12,7 +12,9 @@
 #include "Files.h"
 
 // data
+#include "CompactDataset.h"
 #include "Dataset.h"
+#include "ParallelTextParser.h"
 #include "ParsingExampleIterator.h"
 #include "SequentialLineIterator.h"
 #include "SparseEntryParser.h"
@@ -28,11 +30,40 @@ namespace ell
 {
 namespace common
 {
+    namespace
+    {
+        // iterates over the examples of a memory-mapped binary dataset, in place of a parsing iterator
+        class CompactDatasetExampleIterator : public data::IParsingExampleIterator
+        {
+        public:
+            CompactDatasetExampleIterator(data::CompactDataset dataset)
+                : _dataset(std::move(dataset))
+            {
+            }
+
+            virtual bool IsValid() const override { return _current < _dataset.NumExamples(); }
+
+            virtual void Next() override { ++_current; }
+
+            virtual data::AutoSupervisedExample Get() const override { return data::AutoSupervisedExample(_dataset.GetDataVector(_current), _dataset.GetMetadata(_current)); }
+
+        private:
+            data::CompactDataset _dataset;
+            size_t _current = 0;
+        };
+    }
+
     //
     // Public functions
     //
     std::unique_ptr<data::IParsingExampleIterator> GetDataIterator(const DataLoadArguments& dataLoadArguments)
     {
+        // binary datasets are memory-mapped rather than parsed
+        if (data::IsCompactDatasetFile(dataLoadArguments.inputDataFilename))
+        {
+            return std::make_unique<CompactDatasetExampleIterator>(data::CompactDataset(dataLoadArguments.inputDataFilename));
+        }
+
         // create parser for sparse vectors (SVMLight format)
         data::SparseEntryParser sparseEntryParser;
 
@@ -42,5 +73,23 @@ namespace common
         // Create iterator
         return data::GetParsingExampleIterator(std::move(lineIterator), std::move(sparseEntryParser));
     }
+
+    bool IsLoadedAsCompactDataset(const DataLoadArguments& dataLoadArguments)
+    {
+        return dataLoadArguments.numParseThreads != 1 || data::IsCompactDatasetFile(dataLoadArguments.inputDataFilename);
+    }
+
+    template <>
+    data::CompactDataset GetDataset<data::CompactDataset>(const DataLoadArguments& dataLoadArguments)
+    {
+        // binary datasets are served directly from the mapped file
+        if (data::IsCompactDatasetFile(dataLoadArguments.inputDataFilename))
+        {
+            return data::CompactDataset(dataLoadArguments.inputDataFilename);
+        }
+
+        // text datasets are parsed in chunks, concurrently, directly into contiguous storage
+        return data::ParseCompactDatasetFile(dataLoadArguments.inputDataFilename, data::CompactDataset::Layout::sparse, dataLoadArguments.numParseThreads);
+    }
 }
 }
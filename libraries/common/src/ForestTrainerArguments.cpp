@@ -35,9 +35,33 @@ namespace common
         parser.AddOption(randomSeed,
                          "randomSeed",
                          "rs",
-                         "Random seed used to choose random split threshold candidates",
+                         "Random seed used to sample rows and features, and to choose random split threshold candidates",
                          "123456");
 
+        parser.AddOption(rowSampleFraction,
+                         "rowSampleFraction",
+                         "rsf",
+                         "The fraction of rows to sample uniformly on each boosting round",
+                         1.0);
+
+        parser.AddOption(largeGradientFraction,
+                         "largeGradientFraction",
+                         "lgf",
+                         "The fraction of rows with the largest gradients to keep on each boosting round, in addition to the uniformly sampled rows",
+                         0.0);
+
+        parser.AddOption(featureSampleFraction,
+                         "featureSampleFraction",
+                         "fsf",
+                         "The fraction of features that split rules may use",
+                         1.0);
+
+        parser.AddOption(sampleFeaturesPerNode,
+                         "sampleFeaturesPerNode",
+                         "sfpn",
+                         "Sample features at each node instead of once per tree",
+                         false);
+
         parser.AddOption(thresholdFinderSampleSize,
                          "thresholdFinderSampleSize",
                          "tfss",
@@ -55,6 +79,12 @@ namespace common
                          "st",
                          "Use the sorting trainer instead of the histogram trainer",
                          false);
+
+        parser.AddOption(warmStartModelFilename,
+                         "warmStartModelFilename",
+                         "wsmf",
+                         "Path to a model file with a forest predictor node, whose forest training continues from",
+                         "");
     }
 }
 }
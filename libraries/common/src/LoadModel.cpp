@@ -17,6 +17,7 @@
 // nodes
 #include "BinaryOperationNode.h"
 #include "BinaryPredicateNode.h"
+#include "DTWBankNode.h"
 #include "DelayNode.h"
 #include "DotProductNode.h"
 #include "ExtremalValueNode.h"
@@ -164,6 +165,7 @@ namespace common
         context.GetTypeFactory().AddType<model::Node, nodes::ConstantNode<double>>();
         context.GetTypeFactory().AddType<model::Node, nodes::DelayNode<double>>();
         context.GetTypeFactory().AddType<model::Node, nodes::DotProductNode<double>>();
+        context.GetTypeFactory().AddType<model::Node, nodes::DTWBankNode<double>>();
         context.GetTypeFactory().AddType<model::Node, nodes::MultiplexerNode<double, bool>>();
         context.GetTypeFactory().AddType<model::Node, nodes::MultiplexerNode<bool, bool>>();
         context.GetTypeFactory().AddType<model::Node, nodes::MovingAverageNode<double>>();
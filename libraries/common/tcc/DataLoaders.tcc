@@ -6,6 +6,12 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// stl
+#include <algorithm>
+#include <future>
+#include <thread>
+#include <vector>
+
 namespace ell
 {
 namespace common
@@ -14,34 +20,123 @@ namespace common
     template <typename DatasetType>
     DatasetType GetDataset(const DataLoadArguments& dataLoadArguments)
     {
-        auto dataIterator = GetDataIterator(dataLoadArguments);
         DatasetType dataset;
+        if (IsLoadedAsCompactDataset(dataLoadArguments))
+        {
+            // the data file is memory-mapped if it is binary and parsed in chunks otherwise, and its examples are then copied into the dataset
+            auto compactDataset = GetDataset<data::CompactDataset>(dataLoadArguments);
+            for (size_t index = 0; index < compactDataset.NumExamples(); ++index)
+            {
+                dataset.AddExample(typename DatasetType::DatasetExampleType(compactDataset.GetDataVector(index), compactDataset.GetMetadata(index)));
+            }
+            return dataset;
+        }
+
+        auto dataIterator = GetDataIterator(dataLoadArguments);
         while (dataIterator->IsValid())
         {
             dataset.AddExample(dataIterator->Get());
             dataIterator->Next();
         }
-
         return dataset;
     }
 
     template <typename DatasetType>
     DatasetType GetMappedDataset(const DataLoadArguments& dataLoadArguments, const model::DynamicMap& map)
     {
+        if (IsLoadedAsCompactDataset(dataLoadArguments) || dataLoadArguments.numMapThreads != 1)
+        {
+            // the rows of the CompactDataset go through the map as views
+            return GetMappedDataset<DatasetType>(GetDataset<data::CompactDataset>(dataLoadArguments), map, dataLoadArguments.numMapThreads);
+        }
+
+        // generate mapped dataset, one parsed example at a time
         auto dataIterator = GetDataIterator(dataLoadArguments);
         DatasetType dataset;
-
-        // generate mapped dataset
         while (dataIterator->IsValid())
         {
             auto example = dataIterator->Get();
             auto mappedDataVector = map.Compute<data::DoubleDataVector>(example.GetDataVector());
-            auto mappedExample = typename DatasetType::DatasetExampleType(std::move(mappedDataVector), example.GetMetadata());
-            dataset.AddExample(mappedExample);
-
+            dataset.AddExample(typename DatasetType::DatasetExampleType(std::move(mappedDataVector), example.GetMetadata()));
             dataIterator->Next();
         }
         return dataset;
     }
+
+    template <typename DatasetType>
+    DatasetType GetMappedDataset(const data::CompactDataset& dataset, const model::DynamicMap& map, size_t numMapThreads)
+    {
+        size_t numExamples = dataset.NumExamples();
+        size_t numThreads = numMapThreads == 0 ? std::max(std::thread::hardware_concurrency(), 1u) : numMapThreads;
+        numThreads = std::max(std::min(numThreads, numExamples), size_t{ 1 });
+
+        // the output of a map with state depends on all the examples before, so only a single thread can map them
+        if (map.HasState())
+        {
+            numThreads = 1;
+        }
+
+        // each thread maps a contiguous range of examples with its own copy of a map without state
+        std::vector<size_t> rangeBegins;
+        for (size_t threadIndex = 0; threadIndex <= numThreads; ++threadIndex)
+        {
+            rangeBegins.push_back(numExamples * threadIndex / numThreads);
+        }
+        std::vector<std::vector<typename DatasetType::DatasetExampleType>> mappedRanges(numThreads);
+        auto mapRange = [&](const model::DynamicMap& rangeMap, size_t threadIndex) {
+            auto& mappedRange = mappedRanges[threadIndex];
+            mappedRange.reserve(rangeBegins[threadIndex + 1] - rangeBegins[threadIndex]);
+            for (size_t index = rangeBegins[threadIndex]; index < rangeBegins[threadIndex + 1]; ++index)
+            {
+                auto mappedDataVector = rangeMap.template Compute<data::DoubleDataVector>(dataset.GetDataVector(index));
+                mappedRange.emplace_back(std::move(mappedDataVector), dataset.GetMetadata(index));
+            }
+        };
+
+        if (numThreads == 1)
+        {
+            mapRange(map, 0);
+        }
+        else
+        {
+            // computing a map writes the outputs of its nodes, so each thread gets its own copy
+            std::vector<model::DynamicMap> threadMaps;
+            threadMaps.reserve(numThreads);
+            for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+            {
+                threadMaps.push_back(map.Clone());
+            }
+
+            std::vector<std::future<void>> futures;
+            for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+            {
+                futures.push_back(std::async(std::launch::async, [&, threadIndex]() { mapRange(threadMaps[threadIndex], threadIndex); }));
+            }
+            for (auto& future : futures)
+            {
+                future.get();
+            }
+        }
+
+        DatasetType mappedDataset;
+        for (auto& mappedRange : mappedRanges)
+        {
+            for (auto& mappedExample : mappedRange)
+            {
+                mappedDataset.AddExample(std::move(mappedExample));
+            }
+        }
+        return mappedDataset;
+    }
+
+    template <typename DatasetType>
+    std::unique_ptr<data::DatasetBlockIterator<DatasetType>> GetMappedDatasetBlockIterator(const DataLoadArguments& dataLoadArguments, const model::DynamicMap& map, size_t blockSize)
+    {
+        auto mapExample = [&map](const data::AutoSupervisedExample& example) {
+            auto mappedDataVector = map.Compute<data::DoubleDataVector>(example.GetDataVector());
+            return typename DatasetType::DatasetExampleType(std::move(mappedDataVector), example.GetMetadata());
+        };
+        return std::make_unique<data::DatasetBlockIterator<DatasetType>>(GetDataIterator(dataLoadArguments), blockSize, mapExample);
+    }
 }
 }
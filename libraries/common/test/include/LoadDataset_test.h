@@ -9,4 +9,6 @@ namespace ell
 {
 void TestLoadDataset();
 void TestLoadMappedDataset();
+void TestLoadMappedDatasetInParallel();
+void TestLoadMappedDatasetWithState();
 }
\ No newline at end of file
@@ -14,6 +14,18 @@
 // testing
 #include "testing.h"
 
+// data
+#include "CompactDataset.h"
+#include "Dataset.h"
+
+// model
+#include "DynamicMap.h"
+#include "InputNode.h"
+#include "Model.h"
+
+// nodes
+#include "MovingAverageNode.h"
+
 // stl
 #include <iostream>
 
@@ -26,10 +38,53 @@ common::DataLoadArguments GetDataLoadArguments()
     args.inputDataFilename = "../../../examples/data/testData.txt";
     return args;
 }
+
+// returns true if two datasets have the same examples, in the same order
+template <typename DatasetType>
+bool IsEqualDataset(const DatasetType& a, const DatasetType& b)
+{
+    if (a.NumExamples() != b.NumExamples())
+    {
+        return false;
+    }
+
+    for (size_t index = 0; index < a.NumExamples(); ++index)
+    {
+        const auto& exampleA = a.GetExample(index);
+        const auto& exampleB = b.GetExample(index);
+        if (exampleA.GetMetadata().weight != exampleB.GetMetadata().weight || exampleA.GetMetadata().label != exampleB.GetMetadata().label || !testing::IsEqual(exampleA.GetDataVector().ToArray(), exampleB.GetDataVector().ToArray(), 0.0))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// repeats the examples of the test data until there are more than numExamples of them, giving each one its own weight so that the order can be checked
+data::CompactDataset GetRepeatedTestData(size_t numExamples)
+{
+    auto dataset = common::GetDataset(GetDataLoadArguments());
+    data::CompactDataset compactDataset;
+    while (compactDataset.NumExamples() <= numExamples)
+    {
+        for (size_t index = 0; index < dataset.NumExamples(); ++index)
+        {
+            const auto& example = dataset.GetExample(index);
+            compactDataset.AddExample(example.GetDataVector(), data::WeightLabel{ static_cast<double>(compactDataset.NumExamples() + 1), example.GetMetadata().label });
+        }
+    }
+    return compactDataset;
+}
+
 void TestLoadDataset()
 {
     auto dataLoadArguments = GetDataLoadArguments();
     auto dataset = common::GetDataset(dataLoadArguments);
+
+    // parsing the file in chunks gives the same examples as parsing it line by line
+    dataLoadArguments.numParseThreads = 4;
+    auto chunkParsedDataset = common::GetDataset(dataLoadArguments);
+    testing::ProcessTest("GetDataset with several parsing threads matches the line-by-line result", IsEqualDataset(chunkParsedDataset, dataset));
 }
 
 void TestLoadMappedDataset()
@@ -43,4 +98,39 @@ void TestLoadMappedDataset()
     auto dataLoadArguments = GetDataLoadArguments();
     auto dataset = common::GetMappedDataset(dataLoadArguments, map);
 }
+
+void TestLoadMappedDatasetInParallel()
+{
+    common::MapLoadArguments args;
+    args.inputModelFilename = "../../../examples/data/model_1.model";
+    args.modelInputsString = "";
+    args.modelOutputsString = "1017.output";
+    auto map = common::LoadMap(args);
+
+    // each thread runs a contiguous range of a few hundred examples through its own copy of the map
+    const size_t numMapThreads = 4;
+    auto compactDataset = GetRepeatedTestData(numMapThreads * 256);
+    auto serialDataset = common::GetMappedDataset(compactDataset, map, 1);
+    auto parallelDataset = common::GetMappedDataset(compactDataset, map, numMapThreads);
+
+    bool ok = serialDataset.NumExamples() == compactDataset.NumExamples() && IsEqualDataset(parallelDataset, serialDataset);
+    testing::ProcessTest("GetMappedDataset with several threads matches the serial result, in order", ok);
+}
+
+void TestLoadMappedDatasetWithState()
+{
+    // the moving average of each example depends on the examples before it
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(3);
+    auto movingAverageNode = model.AddNode<nodes::MovingAverageNode<double>>(inputNode->output, 5);
+    model::DynamicMap map(model, { { "input", inputNode } }, { { "output", movingAverageNode->output } });
+
+    const size_t numMapThreads = 4;
+    auto compactDataset = GetRepeatedTestData(numMapThreads * 256);
+    auto serialDataset = common::GetMappedDataset(compactDataset, map.Clone(), 1);
+    auto parallelDataset = common::GetMappedDataset(compactDataset, map.Clone(), numMapThreads);
+
+    bool ok = map.HasState() && serialDataset.NumExamples() == compactDataset.NumExamples() && IsEqualDataset(parallelDataset, serialDataset);
+    testing::ProcessTest("GetMappedDataset with several threads matches the serial result for a map with state", ok);
+}
 }
@@ -39,6 +39,8 @@ int main()
 
         TestLoadDataset();
         TestLoadMappedDataset();
+        TestLoadMappedDatasetInParallel();
+        TestLoadMappedDatasetWithState();
     }
     catch (const utilities::Exception& exception)
     {
@@ -0,0 +1,291 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CompactDataset.h (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "DataVectorView.h"
+#include "Dataset.h"
+#include "Example.h"
+#include "ExampleIterator.h"
+
+// math
+#include "SparseMatrix.h"
+
+// utilities
+#include "MemoryMappedFile.h"
+
+// stl
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace data
+{
+    /// <summary> A supervised example whose data vector is a view into a CompactDataset. </summary>
+    typedef Example<DataVectorView, WeightLabel> ViewSupervisedExample;
+
+    /// <summary> A supervised dataset that keeps all of its examples in a few contiguous arrays, rather than
+    /// one heap-allocated data vector per example. Sparse datasets are stored in compressed sparse row (CSR)
+    /// format; dense datasets are stored as a single row-major block of values, where each row holds the
+    /// prefix of its example. Examples are exposed as non-owning DataVectorViews, which remain valid until
+    /// the next call to AddExample or Reset.
+    ///
+    /// A CompactDataset can be written to a binary file and later memory-mapped from it, in which case
+    /// examples are served directly from the mapping without any parsing or copying. The binary format
+    /// consists of a header of six uint64 values (magic number, format version, layout, number of
+    /// examples, number of features, number of stored values), followed by the row offsets (uint64, one
+    /// more than the number of examples), the metadata (WeightLabel per example), the values (double per
+    /// stored value) and, in the sparse layout, the indices (uint32 per stored value). All numbers are
+    /// stored in native byte order. </summary>
+    class CompactDataset : public DatasetBase
+    {
+    public:
+        /// <summary> The storage layout. </summary>
+        enum class Layout
+        {
+            dense,
+            sparse
+        };
+
+        /// <summary> Iterator class. </summary>
+        template <typename IteratorExampleType>
+        class CompactDatasetExampleIterator : public IExampleIterator<IteratorExampleType>
+        {
+        public:
+            /// <summary> Constructs an iterator over a contiguous range of examples, or over the examples
+            /// whose indices appear in a range of an index vector. </summary>
+            ///
+            /// <param name="dataset"> The dataset. </param>
+            /// <param name="pExampleIndices"> Pointer to the first example index, or nullptr to iterate over a contiguous range. </param>
+            /// <param name="fromIndex"> Zero-based index of the first example, used when pExampleIndices is nullptr. </param>
+            /// <param name="size"> The number of examples to iterate over. </param>
+            CompactDatasetExampleIterator(const CompactDataset& dataset, const size_t* pExampleIndices, size_t fromIndex, size_t size);
+
+            /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+            ///
+            /// <returns> true if it succeeds, false if it fails. </returns>
+            virtual bool IsValid() const override { return _current < _size; }
+
+            /// <summary> Proceeds to the Next iterate. </summary>
+            virtual void Next() override { ++_current; }
+
+            /// <summary> Gets the current example pointer to by the iterator. </summary>
+            ///
+            /// <returns> The example. </returns>
+            virtual IteratorExampleType Get() const override;
+
+        private:
+            const CompactDataset& _dataset;
+            const size_t* _pExampleIndices;
+            size_t _fromIndex;
+            size_t _size;
+            size_t _current = 0;
+        };
+
+        /// <summary> Constructs an empty CompactDataset. </summary>
+        ///
+        /// <param name="layout"> The storage layout. </param>
+        CompactDataset(Layout layout = Layout::sparse);
+
+        /// <summary> Constructs a CompactDataset from the examples of an AnyDataset. </summary>
+        ///
+        /// <param name="anyDataset"> The AnyDataset. </param>
+        /// <param name="layout"> The storage layout. </param>
+        CompactDataset(const AnyDataset& anyDataset, Layout layout = Layout::sparse);
+
+        /// <summary> Constructs a CompactDataset by memory-mapping a binary file that was written by Write.
+        /// Examples can be modified in memory, but cannot be added, and changes are not written back to the file. </summary>
+        ///
+        /// <param name="filepath"> Path to the binary dataset file. </param>
+        CompactDataset(const std::string& filepath);
+
+        /// <summary> Constructs a CompactDataset that takes ownership of arrays that are already in its storage format. </summary>
+        ///
+        /// <param name="layout"> The storage layout. </param>
+        /// <param name="rowOffsets"> The offset of each row in the values array, followed by the total number of values. </param>
+        /// <param name="metadata"> The metadata of each example. </param>
+        /// <param name="values"> The stored values. </param>
+        /// <param name="indices"> The index of each stored value in the sparse layout, or an empty vector in the dense layout. </param>
+        /// <param name="numFeatures"> The maximal size of any example. </param>
+        CompactDataset(Layout layout, std::vector<uint64_t> rowOffsets, std::vector<WeightLabel> metadata, std::vector<double> values, std::vector<uint32_t> indices, size_t numFeatures);
+
+        CompactDataset(CompactDataset&&) = default;
+
+        CompactDataset(const CompactDataset&) = delete;
+
+        CompactDataset& operator=(CompactDataset&&) = default;
+
+        CompactDataset& operator=(const CompactDataset&) = delete;
+
+        /// <summary> Returns the storage layout. </summary>
+        ///
+        /// <returns> The storage layout. </returns>
+        Layout GetLayout() const { return _layout; }
+
+        /// <summary> Returns the number of examples in the data set. </summary>
+        ///
+        /// <returns> The number of examples. </returns>
+        size_t NumExamples() const { return _numExamples; }
+
+        /// <summary> Returns the maximal size of any example. </summary>
+        ///
+        /// <returns> The maximal size of any example. </returns>
+        size_t NumFeatures() const { return _numFeatures; }
+
+        /// <summary> Returns the total number of values stored in the dataset. </summary>
+        ///
+        /// <returns> The number of stored values. </returns>
+        size_t NumStoredValues() const { return _numValues; }
+
+        /// <summary> Returns true if this dataset is served from a memory-mapped file. </summary>
+        ///
+        /// <returns> true if memory-mapped. </returns>
+        bool IsMemoryMapped() const { return _mappedFile != nullptr; }
+
+        /// <summary> Gets a view of the data vector of an example. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the example. </param>
+        ///
+        /// <returns> A non-owning view of the data vector. </returns>
+        DataVectorView GetDataVector(size_t index) const;
+
+        /// <summary> Gets the metadata of an example. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the example. </param>
+        ///
+        /// <returns> Const reference to the metadata. </returns>
+        const WeightLabel& GetMetadata(size_t index) const { return _pMetadata[index]; }
+
+        /// <summary> Gets the metadata of an example. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the example. </param>
+        ///
+        /// <returns> Reference to the metadata. </returns>
+        WeightLabel& GetMetadata(size_t index) { return _pMetadata[index]; }
+
+        /// <summary> Gets an example whose data vector is a view into this dataset. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the example. </param>
+        ///
+        /// <returns> The example. </returns>
+        ViewSupervisedExample GetExample(size_t index) const;
+
+        /// <summary> Returns an iterator that traverses the examples. </summary>
+        ///
+        /// <param name="fromIndex"> Zero-based index of the first example to iterate over. </param>
+        /// <param name="size"> The number of examples to iterate over, a value of zero means all
+        /// the way to the end. </param>
+        ///
+        /// <returns> The iterator. </returns>
+        template <typename IteratorExampleType = ViewSupervisedExample>
+        ExampleIterator<IteratorExampleType> GetExampleIterator(size_t fromIndex = 0, size_t size = 0) const;
+
+        /// <summary> Returns an iterator that traverses the examples in the order given by a vector of example indices. </summary>
+        ///
+        /// <param name="exampleIndices"> Indices of the examples to iterate over. </param>
+        /// <param name="fromIndex"> Zero-based position in the index vector of the first example to iterate over. </param>
+        /// <param name="size"> The number of examples to iterate over. </param>
+        ///
+        /// <returns> The iterator. </returns>
+        template <typename IteratorExampleType = ViewSupervisedExample>
+        ExampleIterator<IteratorExampleType> GetExampleIterator(const std::vector<size_t>& exampleIndices, size_t fromIndex, size_t size) const;
+
+        /// <summary> Returns an AnyDataset that represents an interval of examples from this dataset. </summary>
+        ///
+        /// <param name="fromIndex"> Zero-based index of the first example in the AnyDataset. </param>
+        /// <param name="size"> The number of examples to include, a value of zero means all
+        /// the way to the end. </param>
+        ///
+        /// <returns> The AnyDataset. </returns>
+        AnyDataset GetAnyDataset(size_t fromIndex = 0, size_t size = 0) const { return AnyDataset(this, fromIndex, CorrectRangeSize(fromIndex, size)); }
+
+        /// <summary> Copies an interval of examples into a sparse matrix in CSR format, one row per example.
+        /// The sparse layout is already CSR, so its arrays are copied directly; the dense layout drops its zeros. </summary>
+        ///
+        /// <param name="fromIndex"> Zero-based index of the first example. </param>
+        /// <param name="size"> The number of examples to include, a value of zero means all
+        /// the way to the end. </param>
+        ///
+        /// <returns> The sparse matrix. </returns>
+        math::SparseMatrix<double, math::MatrixLayout::rowMajor> GetSparseMatrix(size_t fromIndex = 0, size_t size = 0) const;
+
+        /// <summary> Appends an example to the dataset, copying its data vector into the contiguous storage. </summary>
+        ///
+        /// <param name="dataVector"> The data vector. </param>
+        /// <param name="metadata"> The metadata. </param>
+        void AddExample(const IDataVector& dataVector, const WeightLabel& metadata);
+
+        /// <summary> Appends an example to the dataset, copying its data vector into the contiguous storage. </summary>
+        ///
+        /// <typeparam name="ExampleType"> The example type. </typeparam>
+        /// <param name="example"> The example. </param>
+        template <typename ExampleType>
+        void AddExample(const ExampleType& example);
+
+        /// <summary> Reserves memory for a given number of examples and stored values. </summary>
+        ///
+        /// <param name="numExamples"> The number of examples. </param>
+        /// <param name="numStoredValues"> The total number of values (non-zeros in the sparse layout). </param>
+        void Reserve(size_t numExamples, size_t numStoredValues);
+
+        /// <summary> Erases all of the examples in the dataset, and releases the memory mapping, if any. </summary>
+        void Reset();
+
+        /// <summary> Writes the dataset in the binary format that can be memory-mapped by the CompactDataset(filepath) constructor. </summary>
+        ///
+        /// <param name="stream"> [in,out] The output stream, which should be opened in binary mode. </param>
+        void Write(std::ostream& stream) const;
+
+        /// <summary> Prints this object. </summary>
+        ///
+        /// <param name="os"> [in,out] Stream to write data to. </param>
+        /// <param name="tabs"> The number of tabs. </param>
+        /// <param name="fromIndex"> Zero-based index of the first row to print. </param>
+        /// <param name="size"> The number of rows to print, or 0 to print until the end. </param>
+        void Print(std::ostream& os, size_t tabs = 0, size_t fromIndex = 0, size_t size = 0) const;
+
+    private:
+        size_t CorrectRangeSize(size_t fromIndex, size_t size) const;
+        void UpdatePointers();
+
+        Layout _layout;
+        size_t _numExamples = 0;
+        size_t _numFeatures = 0;
+        size_t _numValues = 0;
+
+        // storage for datasets that are built in memory
+        std::vector<double> _values;
+        std::vector<uint32_t> _indices;
+        std::vector<uint64_t> _rowOffsets;
+        std::vector<WeightLabel> _metadata;
+
+        // storage for datasets that are mapped from a file
+        std::shared_ptr<utilities::MemoryMappedFile> _mappedFile;
+
+        // pointers to either the vectors or the mapped file
+        double* _pValues = nullptr;
+        uint32_t* _pIndices = nullptr;
+        uint64_t* _pRowOffsets = nullptr;
+        WeightLabel* _pMetadata = nullptr;
+    };
+
+    /// <summary> Checks whether a file is a binary CompactDataset file. </summary>
+    ///
+    /// <param name="filepath"> The file path. </param>
+    ///
+    /// <returns> true if the file exists and starts with the CompactDataset magic number. </returns>
+    bool IsCompactDatasetFile(const std::string& filepath);
+}
+}
+
+#include "../tcc/CompactDataset.tcc"
@@ -43,7 +43,8 @@ namespace data
             SparseShortDataVector,
             SparseByteDataVector,
             SparseBinaryDataVector,
-            AutoDataVector
+            AutoDataVector,
+            DataVectorView
         };
 
         virtual ~IDataVector() = default;
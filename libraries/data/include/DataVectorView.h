@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DataVectorView.h (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "DataVector.h"
+#include "IndexValue.h"
+
+#ifndef DATAVECTORVIEW_H
+#define DATAVECTORVIEW_H
+
+// stl
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ell
+{
+namespace data
+{
+    /// <summary> A data vector that does not own its memory. It refers to a row of contiguous values,
+    /// and optionally to a matching row of indices, that are owned by someone else (for example, a
+    /// CompactDataset). If the index pointer is null, the values are dense and start at index zero;
+    /// otherwise, the view is sparse and the indices are strictly increasing. </summary>
+    class DataVectorView : public DataVectorBase<DataVectorView>
+    {
+    public:
+        /// <summary> An index-value iterator over the non-zero entries of the view. </summary>
+        class Iterator : public IIndexValueIterator
+        {
+        public:
+            Iterator(const Iterator&) = default;
+
+            Iterator(Iterator&&) = default;
+
+            /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+            ///
+            /// <returns> true if the iterator is valid. </returns>
+            bool IsValid() const { return _current < _size; }
+
+            /// <summary> Proceeds to the Next iterate. </summary>
+            void Next();
+
+            /// <summary> Gets the current index-value pair. </summary>
+            ///
+            /// <returns> The current index-value pair. </returns>
+            IndexValue Get() const { return IndexValue{ _pIndices == nullptr ? _current : _pIndices[_current], _pValues[_current] }; }
+
+        private:
+            // private ctor, can only be called from DataVectorView class
+            Iterator(const double* pValues, const uint32_t* pIndices, size_t size);
+            friend DataVectorView;
+            void SkipZeros();
+
+            const double* _pValues;
+            const uint32_t* _pIndices;
+            size_t _size;
+            size_t _current = 0;
+        };
+
+        /// <summary> Constructs a dense view. </summary>
+        ///
+        /// <param name="pValues"> Pointer to the values. </param>
+        /// <param name="size"> The number of values. </param>
+        DataVectorView(const double* pValues, size_t size);
+
+        /// <summary> Constructs a sparse view. </summary>
+        ///
+        /// <param name="pValues"> Pointer to the non-zero values. </param>
+        /// <param name="pIndices"> Pointer to the strictly increasing indices of the non-zero values. </param>
+        /// <param name="size"> The number of non-zero values. </param>
+        DataVectorView(const double* pValues, const uint32_t* pIndices, size_t size);
+
+        /// <summary> Gets the data vector type. </summary>
+        ///
+        /// <returns> The data vector type. </returns>
+        virtual IDataVector::Type GetType() const override { return IDataVector::Type::DataVectorView; }
+
+        /// <summary> Returns true if this view is sparse. </summary>
+        ///
+        /// <returns> true if sparse. </returns>
+        bool IsSparse() const { return _pIndices != nullptr; }
+
+        /// <summary> Gets an index-value iterator over the non-zero entries. </summary>
+        ///
+        /// <returns> The iterator. </returns>
+        Iterator GetIterator() const { return Iterator(_pValues, _pIndices, _size); }
+
+        /// <summary> Views cannot be modified, so this function always throws. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the element. </param>
+        /// <param name="value"> The value. </param>
+        virtual void AppendElement(size_t index, double value) override;
+
+        /// <summary> Returns the first index in the suffix of zeros at the end of this vector. </summary>
+        ///
+        /// <returns> The prefix length. </returns>
+        virtual size_t PrefixLength() const override;
+
+        /// <summary> Computes the 2-norm of the vector (not the squared 2-norm). </summary>
+        ///
+        /// <returns> The vector 2-norm. </returns>
+        virtual double Norm2() const override;
+
+        /// <summary> Computes the dot product with another vector. </summary>
+        ///
+        /// <param name="vector"> The other vector. </param>
+        ///
+        /// <returns> A dot product. </returns>
+        virtual double Dot(const math::UnorientedConstVectorReference<double> vector) const override;
+
+        /// <summary> Performs the operation: vector += scalar * (*this). </summary>
+        ///
+        /// <param name="vector"> [in,out] The vector to which this data vector is added. </param>
+        /// <param name="scalar"> The scalar. </param>
+        virtual void AddTo(math::RowVectorReference<double> vector, double scalar = 1.0) const override;
+
+    private:
+        const double* _pValues;
+        const uint32_t* _pIndices;
+        size_t _size;
+    };
+}
+}
+
+#endif // DATAVECTORVIEW_H
@@ -13,6 +13,9 @@
 #include "Example.h"
 #include "ExampleIterator.h"
 
+// math
+#include "SparseMatrix.h"
+
 // utilities
 #include "AbstractInvoker.h"
 #include "StlReferenceIterator.h"
@@ -32,6 +35,9 @@ namespace data
     template <typename ExampleType>
     class Dataset;
 
+    // forward declaration of CompactDataset, for the same reason
+    class CompactDataset;
+
     /// <summary> A functor class that calls the GetExampleIterator member of a Dataset. </summary>
     ///
     /// <typeparam name="IteratorExampleType"> Example type. </typeparam>
@@ -48,16 +54,24 @@ namespace data
         /// <param name="size"> The number of examples referenced by the iterator. </param>
         GetExampleIteratorFunctor(size_t fromIndex, size_t size);
 
+        /// <summary> Constructor. </summary>
+        ///
+        /// <param name="pExampleIndices"> Pointer to a vector of example indices that determines the order of the examples, or nullptr. </param>
+        /// <param name="fromIndex"> Zero-based index of the first example referenced by the iterator. </param>
+        /// <param name="size"> The number of examples referenced by the iterator. </param>
+        GetExampleIteratorFunctor(const std::vector<size_t>* pExampleIndices, size_t fromIndex, size_t size);
+
         /// <summary> Function call operator. Calls a dataset's GetExampleIterator member. </summary>
         ///
-        /// <typeparam name="ExampleType"> Type of example kept by the Dataset. </typeparam>
+        /// <typeparam name="DatasetType"> Type of dataset, either a Dataset or a CompactDataset. </typeparam>
         /// <param name="dataset"> The dataset. </param>
         ///
         /// <returns> The example iterator returned by the call to GetExampleIterator. </returns>
-        template <typename ExampleType>
-        ReturnType operator()(const Dataset<ExampleType>& dataset) const;
+        template <typename DatasetType>
+        ReturnType operator()(const DatasetType& dataset) const;
 
     private:
+        const std::vector<size_t>* _pExampleIndices = nullptr;
         size_t _fromIndex;
         size_t _size;
     };
@@ -79,6 +93,14 @@ namespace data
         /// <param name="size"> The number of examples referenced by the iterator. </param>
         AnyDataset(const DatasetBase* pDataset, size_t fromIndex, size_t size);
 
+        /// <summary> Constructs an instance of AnyDataset that references examples through a vector of indices. </summary>
+        ///
+        /// <param name="pDataset"> Pointer to an DatasetBase. </param>
+        /// <param name="pExampleIndices"> Pointer to a vector of indices into the dataset, which must outlive the AnyDataset. </param>
+        /// <param name="fromIndex"> Zero-based position in the index vector of the first example referenced by the iterator. </param>
+        /// <param name="size"> The number of examples referenced by the iterator. </param>
+        AnyDataset(const DatasetBase* pDataset, const std::vector<size_t>* pExampleIndices, size_t fromIndex, size_t size);
+
         /// <summary> Gets an example iterator of a given example type. </summary>
         ///
         /// <typeparam name="ExampleType"> Example type. </typeparam>
@@ -92,8 +114,24 @@ namespace data
         /// <returns> Number of examples. </returns>
         size_t NumExamples() const { return _size; }
 
+        /// <summary> Gets the indices, in the underlying dataset, of the examples referenced by this AnyDataset. </summary>
+        ///
+        /// <returns> A vector of example indices. </returns>
+        std::vector<size_t> GetExampleIndices() const;
+
+        /// <summary> Returns an AnyDataset that references examples of the same underlying dataset, in the order
+        /// given by a vector of example indices. This avoids copying or moving the examples themselves. </summary>
+        ///
+        /// <param name="exampleIndices"> Indices into the underlying dataset (see GetExampleIndices), which must outlive the returned AnyDataset. </param>
+        /// <param name="fromIndex"> Zero-based position in the index vector of the first example. </param>
+        /// <param name="size"> The number of examples to include. </param>
+        ///
+        /// <returns> The AnyDataset. </returns>
+        AnyDataset GetIndexedAnyDataset(const std::vector<size_t>& exampleIndices, size_t fromIndex, size_t size) const;
+
     private:
         const DatasetBase* _pDataset;
+        const std::vector<size_t>* _pExampleIndices = nullptr;
         size_t _fromIndex;
         size_t _size;
     };
@@ -132,6 +170,33 @@ namespace data
             InternalIteratorType _end;
         };
 
+        /// <summary> Iterator class that visits examples in the order given by a vector of example indices. </summary>
+        template <typename IteratorExampleType>
+        class DatasetIndexedExampleIterator : public IExampleIterator<IteratorExampleType>
+        {
+        public:
+            /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+            ///
+            /// <returns> true if it succeeds, false if it fails. </returns>
+            virtual bool IsValid() const override { return _current < _end; }
+
+            /// <summary> Proceeds to the Next iterate. </summary>
+            virtual void Next() override { ++_current; }
+
+            /// <summary> Gets the current example pointer to by the iterator. </summary>
+            ///
+            /// <returns> The example. </returns>
+            virtual IteratorExampleType Get() const override { return _examples[*_current].template CopyAs<IteratorExampleType>(); }
+
+            using InternalIteratorType = std::vector<size_t>::const_iterator;
+            DatasetIndexedExampleIterator(const std::vector<DatasetExampleType>& examples, InternalIteratorType begin, InternalIteratorType end);
+
+        private:
+            const std::vector<DatasetExampleType>& _examples;
+            InternalIteratorType _current;
+            InternalIteratorType _end;
+        };
+
         Dataset() = default;
 
         Dataset(Dataset&&) = default;
@@ -200,6 +265,16 @@ namespace data
         template <typename IteratorExampleType = DatasetExampleType>
         ExampleIterator<IteratorExampleType> GetExampleIterator(size_t fromIndex = 0, size_t size = 0) const;
 
+        /// <summary> Returns an iterator that traverses the examples in the order given by a vector of example indices. </summary>
+        ///
+        /// <param name="exampleIndices"> Indices of the examples to iterate over. </param>
+        /// <param name="fromIndex"> Zero-based position in the index vector of the first example to iterate over. </param>
+        /// <param name="size"> The number of examples to iterate over. </param>
+        ///
+        /// <returns> The iterator. </returns>
+        template <typename IteratorExampleType = DatasetExampleType>
+        ExampleIterator<IteratorExampleType> GetExampleIterator(const std::vector<size_t>& exampleIndices, size_t fromIndex, size_t size) const;
+
         /// <summary> Gets an example reference iterator. </summary>
         ///
         /// <param name="firstExample"> Zero-based index of the first example to iterate over. </param>
@@ -216,7 +291,17 @@ namespace data
         /// the way to the end. </param>
         ///
         /// <returns> The iterator. </returns>
-        AnyDataset GetAnyDataset(size_t fromIndex = 0, size_t size = 0) const { return AnyDataset(this, fromIndex, size); }
+        AnyDataset GetAnyDataset(size_t fromIndex = 0, size_t size = 0) const { return AnyDataset(this, fromIndex, CorrectRangeSize(fromIndex, size)); }
+
+        /// <summary> Copies the data vectors of an interval of examples into a sparse matrix in CSR format,
+        /// one row per example, without densifying them. The matrix has NumFeatures() columns. </summary>
+        ///
+        /// <param name="fromIndex"> Zero-based index of the first example. </param>
+        /// <param name="size"> The number of examples to include, a value of zero means all
+        /// the way to the end. </param>
+        ///
+        /// <returns> The sparse matrix. </returns>
+        math::SparseMatrix<double, math::MatrixLayout::rowMajor> GetSparseMatrix(size_t fromIndex = 0, size_t size = 0) const;
 
         /// <summary> Adds an example at the bottom of the matrix. </summary>
         ///
@@ -283,6 +368,14 @@ namespace data
         size_t _numFeatures = 0;
     };
 
+    /// <summary> Permutes a vector of example indices so that a prefix of it is uniformly distributed. Consumes
+    /// random numbers exactly like Dataset::RandomPermute, so permuting indices and permuting examples give the same order. </summary>
+    ///
+    /// <param name="exampleIndices"> [in,out] The example indices. </param>
+    /// <param name="rng"> [in,out] The random number generator. </param>
+    /// <param name="prefixSize"> Size of the prefix that should be uniformly distributed, zero to permute the entire vector. </param>
+    void RandomPermute(std::vector<size_t>& exampleIndices, std::default_random_engine& rng, size_t prefixSize = 0);
+
     // friendly name
     typedef Dataset<AutoSupervisedExample> AutoSupervisedDataset;
     typedef Dataset<DenseSupervisedExample> DenseSupervisedDataset;
@@ -299,3 +392,5 @@ namespace data
 }
 
 #include "../tcc/Dataset.tcc"
+
+#include "CompactDataset.h"
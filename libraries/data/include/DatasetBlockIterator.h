@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DatasetBlockIterator.h (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Dataset.h"
+#include "ParsingExampleIterator.h"
+
+// stl
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+
+namespace ell
+{
+namespace data
+{
+    /// <summary>
+    /// An input iterator that reads the examples of a parsing iterator in consecutive blocks, each held in a
+    /// Dataset. The next block is read on a background thread while the current block is in use, so at most
+    /// two blocks are in memory at any time, regardless of the size of the input.
+    /// </summary>
+    ///
+    /// <typeparam name="DatasetType"> The type of Dataset that holds each block. </typeparam>
+    template <typename DatasetType>
+    class DatasetBlockIterator
+    {
+    public:
+        using DatasetExampleType = typename DatasetType::DatasetExampleType;
+
+        /// <summary> A function that converts a parsed example into a block example, called on the background thread. </summary>
+        using ExampleTransformation = std::function<DatasetExampleType(const AutoSupervisedExample&)>;
+
+        /// <summary> Constructs a DatasetBlockIterator and starts reading the first blocks. </summary>
+        ///
+        /// <param name="exampleIterator"> The iterator that the examples are read from. </param>
+        /// <param name="blockSize"> The number of examples in each block, except perhaps the last one. </param>
+        /// <param name="transformation"> A function that converts each parsed example into a block example. </param>
+        DatasetBlockIterator(std::unique_ptr<IParsingExampleIterator> exampleIterator, size_t blockSize, ExampleTransformation transformation);
+
+        /// <summary> Constructs a DatasetBlockIterator that copies the parsed examples into the blocks as they are. </summary>
+        ///
+        /// <param name="exampleIterator"> The iterator that the examples are read from. </param>
+        /// <param name="blockSize"> The number of examples in each block, except perhaps the last one. </param>
+        DatasetBlockIterator(std::unique_ptr<IParsingExampleIterator> exampleIterator, size_t blockSize);
+
+        DatasetBlockIterator(const DatasetBlockIterator&) = delete;
+
+        DatasetBlockIterator& operator=(const DatasetBlockIterator&) = delete;
+
+        /// <summary> Returns true if the iterator is currently pointing to a valid block. </summary>
+        ///
+        /// <returns> true if it succeeds, false if it fails. </returns>
+        bool IsValid() const { return _currentBlock.NumExamples() > 0; }
+
+        /// <summary> Proceeds to the next block, waiting for the background thread to finish reading it. Exceptions
+        /// thrown while reading the block are rethrown here. </summary>
+        void Next();
+
+        /// <summary> Gets the current block. </summary>
+        ///
+        /// <returns> A const reference to the current block, which remains valid until the next call to Next(). </returns>
+        const DatasetType& Get() const { return _currentBlock; }
+
+    private:
+        DatasetType ReadBlock();
+
+        std::unique_ptr<IParsingExampleIterator> _exampleIterator;
+        size_t _blockSize;
+        ExampleTransformation _transformation;
+        DatasetType _currentBlock;
+
+        // declared last, so that its destructor waits for the background thread before the members that it uses are destroyed
+        std::future<DatasetType> _nextBlock;
+    };
+}
+}
+
+#include "../tcc/DatasetBlockIterator.tcc"
@@ -0,0 +1,45 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ParallelTextParser.h (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CompactDataset.h"
+
+// stl
+#include <cstddef>
+#include <string>
+
+namespace ell
+{
+namespace data
+{
+    /// <summary> Parses text that holds one supervised example per line (a label followed by index:value
+    /// pairs, the same format that is read by SequentialLineIterator and SparseEntryParser) into a
+    /// CompactDataset. The text is split into chunks that are aligned to line boundaries. A first concurrent
+    /// pass counts the examples and stored values of each chunk, the storage of the entire dataset is then
+    /// allocated once, and a second concurrent pass parses each chunk straight into its place in it, so the
+    /// parsed values are never copied. The examples appear in the dataset in the same order as in the text. </summary>
+    ///
+    /// <param name="pBegin"> Pointer to the beginning of the text. </param>
+    /// <param name="pEnd"> Pointer to the end of the text. </param>
+    /// <param name="layout"> The storage layout of the dataset. </param>
+    /// <param name="numThreads"> The number of chunks to parse concurrently, or 0 to use the number of hardware threads. </param>
+    ///
+    /// <returns> The dataset. </returns>
+    CompactDataset ParseCompactDataset(const char* pBegin, const char* pEnd, CompactDataset::Layout layout = CompactDataset::Layout::sparse, size_t numThreads = 0);
+
+    /// <summary> Memory-maps a text file and parses it with ParseCompactDataset. </summary>
+    ///
+    /// <param name="filepath"> The file path. </param>
+    /// <param name="layout"> The storage layout of the dataset. </param>
+    /// <param name="numThreads"> The number of chunks to parse concurrently, or 0 to use the number of hardware threads. </param>
+    ///
+    /// <returns> The dataset. </returns>
+    CompactDataset ParseCompactDatasetFile(const std::string& filepath, CompactDataset::Layout layout = CompactDataset::Layout::sparse, size_t numThreads = 0);
+}
+}
@@ -121,6 +121,26 @@ namespace data
         /// <returns> The first index of the suffix of zeros at the end of this vector. </returns>
         virtual size_t PrefixLength() const override;
 
+        /// <summary> Computes the 2-norm of the vector (not the squared 2-norm). </summary>
+        ///
+        /// <returns> The vector 2-norm. </returns>
+        virtual double Norm2() const override;
+
+        /// <summary> Computes the dot product with another vector. </summary>
+        ///
+        /// <param name="vector"> The other vector. </param>
+        ///
+        /// <returns> A dot product. </returns>
+        virtual double Dot(const math::UnorientedConstVectorReference<double> vector) const override;
+
+        /// <summary>
+        /// Performs the operation: vector += scalar * (*this), where other is an array of doubles.
+        /// </summary>
+        ///
+        /// <param name="vector"> [in,out] The vector to which this data vector is added. </param>
+        /// <param name="scalar"> The scalar. </param>
+        virtual void AddTo(math::RowVectorReference<double> vector, double scalar = 1.0) const override;
+
     private:
         using DataVectorBase<SparseDataVector<ElementType, IntegerListType>>::AppendElements;
         IntegerListType _indices;
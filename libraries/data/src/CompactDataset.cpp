@@ -0,0 +1,306 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CompactDataset.cpp (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "CompactDataset.h"
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+
+namespace ell
+{
+namespace data
+{
+    namespace
+    {
+        const uint64_t compactDatasetMagicNumber = 0x00315344434C4C45ull; // "ELLCDS1" in little endian
+        const uint64_t compactDatasetFormatVersion = 1;
+
+        struct CompactDatasetHeader
+        {
+            uint64_t magicNumber;
+            uint64_t formatVersion;
+            uint64_t layout;
+            uint64_t numExamples;
+            uint64_t numFeatures;
+            uint64_t numValues;
+        };
+
+        template <typename ValueType>
+        void WriteArray(std::ostream& stream, const ValueType* pArray, size_t size)
+        {
+            stream.write(reinterpret_cast<const char*>(pArray), size * sizeof(ValueType));
+        }
+    }
+
+    CompactDataset::CompactDataset(Layout layout)
+        : _layout(layout), _rowOffsets(1, 0)
+    {
+        UpdatePointers();
+    }
+
+    CompactDataset::CompactDataset(const AnyDataset& anyDataset, Layout layout)
+        : CompactDataset(layout)
+    {
+        auto exampleIterator = anyDataset.GetExampleIterator<AutoSupervisedExample>();
+        Reserve(anyDataset.NumExamples(), 0);
+        while (exampleIterator.IsValid())
+        {
+            AddExample(exampleIterator.Get());
+            exampleIterator.Next();
+        }
+    }
+
+    CompactDataset::CompactDataset(const std::string& filepath)
+        : _mappedFile(std::make_shared<utilities::MemoryMappedFile>(filepath))
+    {
+        char* pData = _mappedFile->GetData();
+        size_t fileSize = _mappedFile->Size();
+
+        CompactDatasetHeader header;
+        if (fileSize < sizeof(header))
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::badData, "file " + filepath + " is too small to be a binary dataset");
+        }
+        std::memcpy(&header, pData, sizeof(header));
+        if (header.magicNumber != compactDatasetMagicNumber || header.formatVersion != compactDatasetFormatVersion || header.layout > static_cast<uint64_t>(Layout::sparse))
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::badData, "file " + filepath + " is not a binary dataset, or was written by an incompatible version");
+        }
+
+        _layout = static_cast<Layout>(header.layout);
+        _numExamples = static_cast<size_t>(header.numExamples);
+        _numFeatures = static_cast<size_t>(header.numFeatures);
+        _numValues = static_cast<size_t>(header.numValues);
+
+        size_t offset = sizeof(header);
+        size_t expectedSize = offset + (_numExamples + 1) * sizeof(uint64_t) + _numExamples * sizeof(WeightLabel) + _numValues * sizeof(double);
+        if (_layout == Layout::sparse)
+        {
+            expectedSize += _numValues * sizeof(uint32_t);
+        }
+        if (fileSize < expectedSize)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::badData, "binary dataset file " + filepath + " is truncated");
+        }
+
+        // every array starts at a multiple of 8 bytes, so the pointers are suitably aligned
+        _pRowOffsets = reinterpret_cast<uint64_t*>(pData + offset);
+        offset += (_numExamples + 1) * sizeof(uint64_t);
+        _pMetadata = reinterpret_cast<WeightLabel*>(pData + offset);
+        offset += _numExamples * sizeof(WeightLabel);
+        _pValues = reinterpret_cast<double*>(pData + offset);
+        offset += _numValues * sizeof(double);
+        _pIndices = _layout == Layout::sparse ? reinterpret_cast<uint32_t*>(pData + offset) : nullptr;
+
+        if (_pRowOffsets[_numExamples] != _numValues)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::badData, "binary dataset file " + filepath + " is corrupt");
+        }
+    }
+
+    CompactDataset::CompactDataset(Layout layout, std::vector<uint64_t> rowOffsets, std::vector<WeightLabel> metadata, std::vector<double> values, std::vector<uint32_t> indices, size_t numFeatures)
+        : _layout(layout), _numFeatures(numFeatures), _values(std::move(values)), _indices(std::move(indices)), _rowOffsets(std::move(rowOffsets)), _metadata(std::move(metadata))
+    {
+        if (_rowOffsets.size() != _metadata.size() + 1 || _rowOffsets.back() != _values.size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "row offsets do not match the number of examples and values");
+        }
+        if (_indices.size() != (_layout == Layout::sparse ? _values.size() : 0))
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "number of indices does not match the layout and the number of values");
+        }
+        UpdatePointers();
+    }
+
+    DataVectorView CompactDataset::GetDataVector(size_t index) const
+    {
+        size_t begin = static_cast<size_t>(_pRowOffsets[index]);
+        size_t size = static_cast<size_t>(_pRowOffsets[index + 1]) - begin;
+        if (_layout == Layout::dense)
+        {
+            return DataVectorView(_pValues + begin, size);
+        }
+        return DataVectorView(_pValues + begin, _pIndices + begin, size);
+    }
+
+    ViewSupervisedExample CompactDataset::GetExample(size_t index) const
+    {
+        return ViewSupervisedExample(GetDataVector(index), _pMetadata[index]);
+    }
+
+    math::SparseMatrix<double, math::MatrixLayout::rowMajor> CompactDataset::GetSparseMatrix(size_t fromIndex, size_t size) const
+    {
+        size = CorrectRangeSize(fromIndex, size);
+        size_t begin = static_cast<size_t>(_pRowOffsets[fromIndex]);
+        size_t end = static_cast<size_t>(_pRowOffsets[fromIndex + size]);
+
+        std::vector<size_t> offsets(size + 1);
+        std::vector<size_t> indices;
+        std::vector<double> values;
+        if (_layout == Layout::sparse)
+        {
+            for (size_t rowIndex = 0; rowIndex <= size; ++rowIndex)
+            {
+                offsets[rowIndex] = static_cast<size_t>(_pRowOffsets[fromIndex + rowIndex]) - begin;
+            }
+            indices.assign(_pIndices + begin, _pIndices + end);
+            values.assign(_pValues + begin, _pValues + end);
+        }
+        else
+        {
+            for (size_t rowIndex = 0; rowIndex < size; ++rowIndex)
+            {
+                size_t rowBegin = static_cast<size_t>(_pRowOffsets[fromIndex + rowIndex]);
+                size_t rowEnd = static_cast<size_t>(_pRowOffsets[fromIndex + rowIndex + 1]);
+                for (size_t position = rowBegin; position < rowEnd; ++position)
+                {
+                    if (_pValues[position] != 0)
+                    {
+                        indices.push_back(position - rowBegin);
+                        values.push_back(_pValues[position]);
+                    }
+                }
+                offsets[rowIndex + 1] = values.size();
+            }
+        }
+
+        return { size, _numFeatures, std::move(offsets), std::move(indices), std::move(values) };
+    }
+
+    void CompactDataset::AddExample(const IDataVector& dataVector, const WeightLabel& metadata)
+    {
+        if (IsMemoryMapped())
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "cannot add examples to a memory-mapped dataset");
+        }
+
+        size_t numFeatures = dataVector.PrefixLength();
+        if (_layout == Layout::dense)
+        {
+            auto values = dataVector.ToArray(numFeatures);
+            _values.insert(_values.end(), values.begin(), values.end());
+        }
+        else
+        {
+            if (numFeatures > static_cast<size_t>(std::numeric_limits<uint32_t>::max()) + 1)
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "CompactDataset supports feature indices up to " + std::to_string(std::numeric_limits<uint32_t>::max()));
+            }
+
+            // AutoDataVector hides IDataVector::DeepCopyAs, which cannot see through its internal representation
+            auto sparseDataVector = dataVector.GetType() == IDataVector::Type::AutoDataVector ? static_cast<const AutoDataVector&>(dataVector).DeepCopyAs<SparseDoubleDataVector>() : dataVector.DeepCopyAs<SparseDoubleDataVector>();
+            auto indexValueIterator = sparseDataVector.GetIterator();
+            while (indexValueIterator.IsValid())
+            {
+                auto indexValue = indexValueIterator.Get();
+                _indices.push_back(static_cast<uint32_t>(indexValue.index));
+                _values.push_back(indexValue.value);
+                indexValueIterator.Next();
+            }
+        }
+
+        _rowOffsets.push_back(_values.size());
+        _metadata.push_back(metadata);
+
+        if (_numFeatures < numFeatures)
+        {
+            _numFeatures = numFeatures;
+        }
+        UpdatePointers();
+    }
+
+    void CompactDataset::Reserve(size_t numExamples, size_t numStoredValues)
+    {
+        _metadata.reserve(numExamples);
+        _rowOffsets.reserve(numExamples + 1);
+        _values.reserve(numStoredValues);
+        if (_layout == Layout::sparse)
+        {
+            _indices.reserve(numStoredValues);
+        }
+        UpdatePointers();
+    }
+
+    void CompactDataset::Reset()
+    {
+        _mappedFile = nullptr;
+        _values.clear();
+        _indices.clear();
+        _rowOffsets.assign(1, 0);
+        _metadata.clear();
+        _numFeatures = 0;
+        UpdatePointers();
+    }
+
+    void CompactDataset::Write(std::ostream& stream) const
+    {
+        CompactDatasetHeader header{ compactDatasetMagicNumber, compactDatasetFormatVersion, static_cast<uint64_t>(_layout), _numExamples, _numFeatures, _numValues };
+        WriteArray(stream, &header, 1);
+        WriteArray(stream, _pRowOffsets, _numExamples + 1);
+        WriteArray(stream, _pMetadata, _numExamples);
+        WriteArray(stream, _pValues, _numValues);
+        if (_layout == Layout::sparse)
+        {
+            WriteArray(stream, _pIndices, _numValues);
+        }
+
+        if (!stream.good())
+        {
+            throw utilities::SystemException(utilities::SystemExceptionErrors::fileNotWritable, "error writing binary dataset");
+        }
+    }
+
+    void CompactDataset::Print(std::ostream& os, size_t tabs, size_t fromIndex, size_t size) const
+    {
+        size = CorrectRangeSize(fromIndex, size);
+
+        for (size_t index = fromIndex; index < fromIndex + size; ++index)
+        {
+            os << std::string(tabs * 4, ' ');
+            GetExample(index).Print(os);
+            os << "\n";
+        }
+    }
+
+    void CompactDataset::UpdatePointers()
+    {
+        _numExamples = _metadata.size();
+        _numValues = _values.size();
+        _pValues = _values.data();
+        _pIndices = _indices.data();
+        _pRowOffsets = _rowOffsets.data();
+        _pMetadata = _metadata.data();
+    }
+
+    size_t CompactDataset::CorrectRangeSize(size_t fromIndex, size_t size) const
+    {
+        if (size == 0 || fromIndex + size > NumExamples())
+        {
+            return NumExamples() - fromIndex;
+        }
+        return size;
+    }
+
+    bool IsCompactDatasetFile(const std::string& filepath)
+    {
+        std::ifstream stream(filepath, std::ios::binary);
+        CompactDatasetHeader header;
+        if (!stream.read(reinterpret_cast<char*>(&header), sizeof(header)))
+        {
+            return false;
+        }
+        return header.magicNumber == compactDatasetMagicNumber;
+    }
+}
+}
@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DataVectorView.cpp (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "DataVectorView.h"
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <cmath>
+
+namespace ell
+{
+namespace data
+{
+    DataVectorView::Iterator::Iterator(const double* pValues, const uint32_t* pIndices, size_t size)
+        : _pValues(pValues), _pIndices(pIndices), _size(size)
+    {
+        SkipZeros();
+    }
+
+    void DataVectorView::Iterator::Next()
+    {
+        ++_current;
+        SkipZeros();
+    }
+
+    void DataVectorView::Iterator::SkipZeros()
+    {
+        while (_current < _size && _pValues[_current] == 0)
+        {
+            ++_current;
+        }
+    }
+
+    DataVectorView::DataVectorView(const double* pValues, size_t size)
+        : _pValues(pValues), _pIndices(nullptr), _size(size)
+    {
+    }
+
+    DataVectorView::DataVectorView(const double* pValues, const uint32_t* pIndices, size_t size)
+        : _pValues(pValues), _pIndices(pIndices), _size(size)
+    {
+    }
+
+    void DataVectorView::AppendElement(size_t index, double value)
+    {
+        throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented, "Append element not supported for DataVectorView");
+    }
+
+    size_t DataVectorView::PrefixLength() const
+    {
+        if (_size == 0)
+        {
+            return 0;
+        }
+        return _pIndices == nullptr ? _size : _pIndices[_size - 1] + 1;
+    }
+
+    double DataVectorView::Norm2() const
+    {
+        double result = 0.0;
+        for (size_t i = 0; i < _size; ++i)
+        {
+            result += _pValues[i] * _pValues[i];
+        }
+        return std::sqrt(result);
+    }
+
+    double DataVectorView::Dot(const math::UnorientedConstVectorReference<double> vector) const
+    {
+        const double* pVector = vector.GetDataPointer();
+        const size_t increment = vector.GetIncrement();
+        const size_t vectorSize = vector.Size();
+
+        double result = 0.0;
+        if (_pIndices == nullptr)
+        {
+            size_t size = _size < vectorSize ? _size : vectorSize;
+            for (size_t i = 0; i < size; ++i)
+            {
+                result += _pValues[i] * pVector[i * increment];
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < _size && _pIndices[i] < vectorSize; ++i)
+            {
+                result += _pValues[i] * pVector[_pIndices[i] * increment];
+            }
+        }
+        return result;
+    }
+
+    void DataVectorView::AddTo(math::RowVectorReference<double> vector, double scalar) const
+    {
+        if (PrefixLength() > vector.Size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "vector size is smaller than data vector prefix length");
+        }
+
+        double* pVector = vector.GetDataPointer();
+        const size_t increment = vector.GetIncrement();
+        if (_pIndices == nullptr)
+        {
+            for (size_t i = 0; i < _size; ++i)
+            {
+                pVector[i * increment] += scalar * _pValues[i];
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < _size; ++i)
+            {
+                pVector[_pIndices[i] * increment] += scalar * _pValues[i];
+            }
+        }
+    }
+}
+}
@@ -8,6 +8,9 @@
 
 #include "Dataset.h"
 
+// stl
+#include <numeric>
+
 namespace ell
 {
 namespace data
@@ -16,5 +19,43 @@ namespace data
         : _pDataset(pDataset), _fromIndex(fromIndex), _size(size)
     {
     }
+
+    AnyDataset::AnyDataset(const DatasetBase* pDataset, const std::vector<size_t>* pExampleIndices, size_t fromIndex, size_t size)
+        : _pDataset(pDataset), _pExampleIndices(pExampleIndices), _fromIndex(fromIndex), _size(size)
+    {
+    }
+
+    std::vector<size_t> AnyDataset::GetExampleIndices() const
+    {
+        if (_pExampleIndices != nullptr)
+        {
+            return std::vector<size_t>(_pExampleIndices->cbegin() + _fromIndex, _pExampleIndices->cbegin() + _fromIndex + _size);
+        }
+
+        std::vector<size_t> exampleIndices(_size);
+        std::iota(exampleIndices.begin(), exampleIndices.end(), _fromIndex);
+        return exampleIndices;
+    }
+
+    AnyDataset AnyDataset::GetIndexedAnyDataset(const std::vector<size_t>& exampleIndices, size_t fromIndex, size_t size) const
+    {
+        return AnyDataset(_pDataset, &exampleIndices, fromIndex, size);
+    }
+
+    void RandomPermute(std::vector<size_t>& exampleIndices, std::default_random_engine& rng, size_t prefixSize)
+    {
+        using std::swap;
+        const auto size = exampleIndices.size();
+        if (prefixSize == 0 || prefixSize > size)
+        {
+            prefixSize = size;
+        }
+
+        for (size_t i = 0; i < prefixSize; ++i)
+        {
+            std::uniform_int_distribution<size_t> dist(i, size - 1);
+            swap(exampleIndices[i], exampleIndices[dist(rng)]);
+        }
+    }
 }
 }
\ No newline at end of file
@@ -0,0 +1,246 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ParallelTextParser.cpp (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ParallelTextParser.h"
+#include "SparseEntryParser.h"
+
+// utilities
+#include "Exception.h"
+#include "MemoryMappedFile.h"
+#include "Parser.h"
+
+// stl
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace ell
+{
+namespace data
+{
+    namespace
+    {
+        // the size of a chunk of text, counted before it is parsed
+        struct ChunkSize
+        {
+            size_t numExamples = 0;
+            size_t numValues = 0;
+        };
+
+        // where the examples of a chunk of text are written in the storage of the entire dataset
+        struct ChunkOutput
+        {
+            uint64_t* pRowOffsets;
+            WeightLabel* pMetadata;
+            double* pValues;
+            uint32_t* pIndices;
+            size_t valueOffset;
+        };
+
+        void HandleLabelErrors(utilities::ParseResult result, const std::string& str)
+        {
+            if (result == utilities::ParseResult::badFormat)
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::badStringFormat, "bad format in '" + str + "'");
+            }
+            else if (result == utilities::ParseResult::endOfString || result == utilities::ParseResult::beginComment)
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::badStringFormat, "premature end-of-std::string or comment in '" + str + "'");
+            }
+            else if (result == utilities::ParseResult::outOfRange)
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::badStringFormat, "real value out of double precision range in '" + str + "'");
+            }
+        }
+
+        // parses a line, calls a function on each of its nonzeros, and returns the row size. Zeros are not stored,
+        // and each row is as long as its last nonzero, exactly like the data vectors built by AddExample
+        template <typename NonzeroFunctionType>
+        size_t ParseLine(const std::shared_ptr<std::string>& spLine, double& label, NonzeroFunctionType nonzeroFunction)
+        {
+            const char* pStr = spLine->c_str();
+
+            auto result = utilities::Parse(pStr, label);
+            if (result != utilities::ParseResult::success)
+            {
+                HandleLabelErrors(result, *spLine);
+            }
+
+            size_t rowSize = 0;
+            SparseEntryParser parser;
+            auto indexValueIterator = parser.GetIterator(spLine, pStr);
+            while (indexValueIterator.IsValid())
+            {
+                auto indexValue = indexValueIterator.Get();
+                if (indexValue.value != 0)
+                {
+                    if (indexValue.index < rowSize)
+                    {
+                        throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "Can only append values to the end of a data vector");
+                    }
+                    if (indexValue.index > std::numeric_limits<uint32_t>::max())
+                    {
+                        throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "CompactDataset supports feature indices up to " + std::to_string(std::numeric_limits<uint32_t>::max()));
+                    }
+                    nonzeroFunction(indexValue);
+                    rowSize = indexValue.index + 1;
+                }
+                indexValueIterator.Next();
+            }
+            return rowSize;
+        }
+
+        // calls a function on each line of a chunk of text. The line buffer is reused, so parsing does not
+        // allocate per example once the buffer is large enough
+        template <typename LineFunctionType>
+        void ForEachLine(const char* pBegin, const char* pEnd, LineFunctionType lineFunction)
+        {
+            auto spLine = std::make_shared<std::string>();
+            while (pBegin < pEnd)
+            {
+                auto pLineEnd = static_cast<const char*>(std::memchr(pBegin, '\n', pEnd - pBegin));
+                if (pLineEnd == nullptr)
+                {
+                    pLineEnd = pEnd;
+                }
+                spLine->assign(pBegin, pLineEnd);
+                lineFunction(spLine);
+                pBegin = pLineEnd + 1;
+            }
+        }
+
+        ChunkSize CountChunk(const char* pBegin, const char* pEnd, CompactDataset::Layout layout)
+        {
+            ChunkSize size;
+            ForEachLine(pBegin, pEnd, [&](const std::shared_ptr<std::string>& spLine) {
+                double label;
+                size_t numNonzeros = 0;
+                auto rowSize = ParseLine(spLine, label, [&](const IndexValue&) { ++numNonzeros; });
+                ++size.numExamples;
+                size.numValues += layout == CompactDataset::Layout::dense ? rowSize : numNonzeros;
+            });
+            return size;
+        }
+
+        // parses a chunk of text straight into its place in the storage of the entire dataset, and returns the maximal row size
+        size_t ParseChunk(const char* pBegin, const char* pEnd, CompactDataset::Layout layout, ChunkOutput output)
+        {
+            size_t numFeatures = 0;
+            size_t valueOffset = output.valueOffset;
+            ForEachLine(pBegin, pEnd, [&](const std::shared_ptr<std::string>& spLine) {
+                double label;
+                size_t rowBegin = valueOffset;
+                auto rowSize = ParseLine(spLine, label, [&](const IndexValue& indexValue) {
+                    if (layout == CompactDataset::Layout::dense)
+                    {
+                        // the values array is zero-initialized, so only the nonzeros are written
+                        output.pValues[rowBegin + indexValue.index] = indexValue.value;
+                    }
+                    else
+                    {
+                        output.pIndices[valueOffset] = static_cast<uint32_t>(indexValue.index);
+                        output.pValues[valueOffset] = indexValue.value;
+                        ++valueOffset;
+                    }
+                });
+                if (layout == CompactDataset::Layout::dense)
+                {
+                    valueOffset += rowSize;
+                }
+
+                *output.pMetadata++ = WeightLabel{ 1.0, label };
+                *++output.pRowOffsets = valueOffset;
+                numFeatures = std::max(numFeatures, rowSize);
+            });
+            return numFeatures;
+        }
+
+        // returns a pointer to the beginning of the line that follows the one that contains pPosition
+        const char* GetNextLineBegin(const char* pPosition, const char* pEnd)
+        {
+            auto pNewLine = static_cast<const char*>(std::memchr(pPosition, '\n', pEnd - pPosition));
+            return pNewLine == nullptr ? pEnd : pNewLine + 1;
+        }
+
+        // runs a function on each chunk concurrently
+        template <typename ChunkFunctionType>
+        void ForEachChunk(size_t numChunks, ChunkFunctionType chunkFunction)
+        {
+            std::vector<std::future<void>> futures;
+            for (size_t chunkIndex = 0; chunkIndex < numChunks; ++chunkIndex)
+            {
+                futures.push_back(std::async(std::launch::async, chunkFunction, chunkIndex));
+            }
+            for (auto& future : futures)
+            {
+                future.get();
+            }
+        }
+    }
+
+    CompactDataset ParseCompactDataset(const char* pBegin, const char* pEnd, CompactDataset::Layout layout, size_t numThreads)
+    {
+        if (numThreads == 0)
+        {
+            numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+        size_t textSize = static_cast<size_t>(pEnd - pBegin);
+        size_t numChunks = std::max(std::min(numThreads, textSize), size_t{ 1 });
+
+        // split the text into chunks, each of which starts at the beginning of a line
+        std::vector<const char*> chunkBegins(1, pBegin);
+        for (size_t chunkIndex = 1; chunkIndex < numChunks; ++chunkIndex)
+        {
+            const char* pSplit = std::max(pBegin + (textSize * chunkIndex) / numChunks, chunkBegins.back());
+            chunkBegins.push_back(pSplit == pBegin ? pBegin : GetNextLineBegin(pSplit - 1, pEnd));
+        }
+        chunkBegins.push_back(pEnd);
+
+        // count the examples and stored values of each chunk, so that the storage of the entire dataset can be
+        // allocated up front and each chunk can be parsed straight into its place in it
+        std::vector<ChunkSize> chunkSizes(numChunks);
+        ForEachChunk(numChunks, [&](size_t chunkIndex) {
+            chunkSizes[chunkIndex] = CountChunk(chunkBegins[chunkIndex], chunkBegins[chunkIndex + 1], layout);
+        });
+
+        std::vector<size_t> exampleOffsets(1, 0);
+        std::vector<size_t> valueOffsets(1, 0);
+        for (const auto& chunkSize : chunkSizes)
+        {
+            exampleOffsets.push_back(exampleOffsets.back() + chunkSize.numExamples);
+            valueOffsets.push_back(valueOffsets.back() + chunkSize.numValues);
+        }
+        std::vector<uint64_t> rowOffsets(exampleOffsets.back() + 1, 0);
+        std::vector<WeightLabel> metadata(exampleOffsets.back());
+        std::vector<double> values(valueOffsets.back());
+        std::vector<uint32_t> indices(layout == CompactDataset::Layout::sparse ? valueOffsets.back() : 0);
+
+        // parse the chunks concurrently
+        std::vector<size_t> chunkNumFeatures(numChunks);
+        ForEachChunk(numChunks, [&](size_t chunkIndex) {
+            auto exampleOffset = exampleOffsets[chunkIndex];
+            ChunkOutput output{ rowOffsets.data() + exampleOffset, metadata.data() + exampleOffset, values.data(), indices.data(), valueOffsets[chunkIndex] };
+            chunkNumFeatures[chunkIndex] = ParseChunk(chunkBegins[chunkIndex], chunkBegins[chunkIndex + 1], layout, output);
+        });
+        size_t numFeatures = *std::max_element(chunkNumFeatures.begin(), chunkNumFeatures.end());
+
+        return CompactDataset(layout, std::move(rowOffsets), std::move(metadata), std::move(values), std::move(indices), numFeatures);
+    }
+
+    CompactDataset ParseCompactDatasetFile(const std::string& filepath, CompactDataset::Layout layout, size_t numThreads)
+    {
+        utilities::MemoryMappedFile file(filepath);
+        const char* pBegin = file.GetData();
+        return ParseCompactDataset(pBegin, pBegin + file.Size(), layout, numThreads);
+    }
+}
+}
@@ -0,0 +1,58 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CompactDataset.tcc (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <memory>
+
+namespace ell
+{
+namespace data
+{
+    template <typename IteratorExampleType>
+    CompactDataset::CompactDatasetExampleIterator<IteratorExampleType>::CompactDatasetExampleIterator(const CompactDataset& dataset, const size_t* pExampleIndices, size_t fromIndex, size_t size)
+        : _dataset(dataset), _pExampleIndices(pExampleIndices), _fromIndex(fromIndex), _size(size)
+    {
+    }
+
+    template <typename IteratorExampleType>
+    IteratorExampleType CompactDataset::CompactDatasetExampleIterator<IteratorExampleType>::Get() const
+    {
+        size_t index = _pExampleIndices == nullptr ? _fromIndex + _current : _pExampleIndices[_current];
+        using MetadataType = typename IteratorExampleType::MetadataType;
+
+        // the Example constructors make a shallow copy of the view if IteratorExampleType holds a DataVectorView, and a deep copy otherwise
+        return IteratorExampleType(_dataset.GetDataVector(index), MetadataType(_dataset.GetMetadata(index)));
+    }
+
+    template <typename IteratorExampleType>
+    ExampleIterator<IteratorExampleType> CompactDataset::GetExampleIterator(size_t fromIndex, size_t size) const
+    {
+        size = CorrectRangeSize(fromIndex, size);
+        return ExampleIterator<IteratorExampleType>(std::make_unique<CompactDatasetExampleIterator<IteratorExampleType>>(*this, nullptr, fromIndex, size));
+    }
+
+    template <typename IteratorExampleType>
+    ExampleIterator<IteratorExampleType> CompactDataset::GetExampleIterator(const std::vector<size_t>& exampleIndices, size_t fromIndex, size_t size) const
+    {
+        if (fromIndex + size > exampleIndices.size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange);
+        }
+        return ExampleIterator<IteratorExampleType>(std::make_unique<CompactDatasetExampleIterator<IteratorExampleType>>(*this, exampleIndices.data() + fromIndex, 0, size));
+    }
+
+    template <typename ExampleType>
+    void CompactDataset::AddExample(const ExampleType& example)
+    {
+        AddExample(example.GetDataVector(), WeightLabel(example.GetMetadata()));
+    }
+}
+}
@@ -6,6 +6,7 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "DataVectorView.h"
 #include "DenseDataVector.h"
 #include "SparseBinaryDataVector.h"
 #include "SparseDataVector.h"
@@ -50,6 +51,9 @@ namespace data
             case Type::SparseBinaryDataVector:
                 return ReturnType(static_cast<const SparseBinaryDataVector*>(this)->GetIterator());
 
+            case Type::DataVectorView:
+                return ReturnType(static_cast<const DataVectorView*>(this)->GetIterator());
+
             default:
                 throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "attempted to cast unsupported data vector type");
         }
@@ -87,6 +91,9 @@ namespace data
             case Type::SparseBinaryDataVector:
                 return ReturnType(MakeTransformingIndexValueIterator(static_cast<const SparseBinaryDataVector*>(this)->GetIterator(), std::move(nonZeroTransform)));
 
+            case Type::DataVectorView:
+                return ReturnType(MakeTransformingIndexValueIterator(static_cast<const DataVectorView*>(this)->GetIterator(), std::move(nonZeroTransform)));
+
             default:
                 throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "attempted to cast unsupported data vector type");
         }
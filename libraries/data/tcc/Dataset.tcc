@@ -26,19 +26,29 @@ namespace data
     }
 
     template <typename IteratorExampleType>
-    template <typename ExampleType>
-    auto GetExampleIteratorFunctor<IteratorExampleType>::operator()(const Dataset<ExampleType>& dataset) const -> ReturnType
+    GetExampleIteratorFunctor<IteratorExampleType>::GetExampleIteratorFunctor(const std::vector<size_t>* pExampleIndices, size_t fromIndex, size_t size)
+        : _pExampleIndices(pExampleIndices), _fromIndex(fromIndex), _size(size)
+    {
+    }
+
+    template <typename IteratorExampleType>
+    template <typename DatasetType>
+    auto GetExampleIteratorFunctor<IteratorExampleType>::operator()(const DatasetType& dataset) const -> ReturnType
     {
+        if (_pExampleIndices != nullptr)
+        {
+            return dataset.template GetExampleIterator<IteratorExampleType>(*_pExampleIndices, _fromIndex, _size);
+        }
         return dataset.template GetExampleIterator<IteratorExampleType>(_fromIndex, _size);
     }
 
     template <typename ExampleType>
     ExampleIterator<ExampleType> AnyDataset::GetExampleIterator() const
     {
-        GetExampleIteratorFunctor<ExampleType> abstractor(_fromIndex, _size);
+        GetExampleIteratorFunctor<ExampleType> abstractor(_pExampleIndices, _fromIndex, _size);
 
         // all Dataset types for which GetAnyDataset() is called must be listed below, in the variadic template argument.
-        return utilities::AbstractInvoker<DatasetBase, Dataset<data::AutoSupervisedExample>, Dataset<data::DenseSupervisedExample>>::Invoke(abstractor, *_pDataset);
+        return utilities::AbstractInvoker<DatasetBase, Dataset<data::AutoSupervisedExample>, Dataset<data::DenseSupervisedExample>, CompactDataset>::Invoke(abstractor, *_pDataset);
     }
 
     template <typename DatasetExampleType>
@@ -48,6 +58,13 @@ namespace data
     {
     }
 
+    template <typename DatasetExampleType>
+    template <typename IteratorExampleType>
+    Dataset<DatasetExampleType>::DatasetIndexedExampleIterator<IteratorExampleType>::DatasetIndexedExampleIterator(const std::vector<DatasetExampleType>& examples, InternalIteratorType begin, InternalIteratorType end)
+        : _examples(examples), _current(begin), _end(end)
+    {
+    }
+
     template <typename DatasetExampleType>
     Dataset<DatasetExampleType>::Dataset(ExampleIterator<DatasetExampleType> exampleIterator)
     {
@@ -96,6 +113,17 @@ namespace data
         return ExampleIterator<IteratorExampleType>(std::make_unique<DatasetExampleIterator<IteratorExampleType>>(_examples.cbegin() + fromIndex, _examples.cbegin() + fromIndex + size));
     }
 
+    template <typename DatasetExampleType>
+    template <typename IteratorExampleType>
+    ExampleIterator<IteratorExampleType> Dataset<DatasetExampleType>::GetExampleIterator(const std::vector<size_t>& exampleIndices, size_t fromIndex, size_t size) const
+    {
+        if (fromIndex + size > exampleIndices.size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange);
+        }
+        return ExampleIterator<IteratorExampleType>(std::make_unique<DatasetIndexedExampleIterator<IteratorExampleType>>(_examples, exampleIndices.cbegin() + fromIndex, exampleIndices.cbegin() + fromIndex + size));
+    }
+
     template <typename DatasetExampleType>
     auto Dataset<DatasetExampleType>::GetExampleReferenceIterator(size_t fromIndex, size_t size) const -> ExampleReferenceIterator
     {
@@ -103,6 +131,32 @@ namespace data
         return ExampleReferenceIterator(_examples.cbegin() + fromIndex, _examples.cbegin() + fromIndex + size);
     }
 
+    template <typename DatasetExampleType>
+    math::SparseMatrix<double, math::MatrixLayout::rowMajor> Dataset<DatasetExampleType>::GetSparseMatrix(size_t fromIndex, size_t size) const
+    {
+        size = CorrectRangeSize(fromIndex, size);
+
+        std::vector<size_t> offsets(1, 0);
+        std::vector<size_t> indices;
+        std::vector<double> values;
+        offsets.reserve(size + 1);
+        for (size_t rowIndex = fromIndex; rowIndex < fromIndex + size; ++rowIndex)
+        {
+            auto sparseDataVector = _examples[rowIndex].GetDataVector().template DeepCopyAs<SparseDoubleDataVector>();
+            auto indexValueIterator = sparseDataVector.GetIterator();
+            while (indexValueIterator.IsValid())
+            {
+                auto indexValue = indexValueIterator.Get();
+                indices.push_back(indexValue.index);
+                values.push_back(indexValue.value);
+                indexValueIterator.Next();
+            }
+            offsets.push_back(values.size());
+        }
+
+        return { size, _numFeatures, std::move(offsets), std::move(indices), std::move(values) };
+    }
+
     template <typename DatasetExampleType>
     void Dataset<DatasetExampleType>::AddExample(DatasetExampleType example)
     {
@@ -0,0 +1,64 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DatasetBlockIterator.tcc (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// stl
+#include <utility>
+
+namespace ell
+{
+namespace data
+{
+    template <typename DatasetType>
+    DatasetBlockIterator<DatasetType>::DatasetBlockIterator(std::unique_ptr<IParsingExampleIterator> exampleIterator, size_t blockSize, ExampleTransformation transformation)
+        : _exampleIterator(std::move(exampleIterator)), _blockSize(blockSize), _transformation(std::move(transformation))
+    {
+        if (_blockSize == 0)
+        {
+            _blockSize = 1;
+        }
+
+        _nextBlock = std::async(std::launch::async, [this]() { return ReadBlock(); });
+        Next();
+    }
+
+    template <typename DatasetType>
+    DatasetBlockIterator<DatasetType>::DatasetBlockIterator(std::unique_ptr<IParsingExampleIterator> exampleIterator, size_t blockSize)
+        : DatasetBlockIterator(std::move(exampleIterator), blockSize, [](const AutoSupervisedExample& example) { return example.template CopyAs<DatasetExampleType>(); })
+    {
+    }
+
+    template <typename DatasetType>
+    void DatasetBlockIterator<DatasetType>::Next()
+    {
+        if (!_nextBlock.valid())
+        {
+            _currentBlock = DatasetType();
+            return;
+        }
+
+        // swap in the block that was read in the background, and start reading the one after it
+        _currentBlock = _nextBlock.get();
+        if (_currentBlock.NumExamples() == _blockSize)
+        {
+            _nextBlock = std::async(std::launch::async, [this]() { return ReadBlock(); });
+        }
+    }
+
+    template <typename DatasetType>
+    DatasetType DatasetBlockIterator<DatasetType>::ReadBlock()
+    {
+        DatasetType block;
+        while (block.NumExamples() < _blockSize && _exampleIterator->IsValid())
+        {
+            block.AddExample(_transformation(_exampleIterator->Get()));
+            _exampleIterator->Next();
+        }
+        return block;
+    }
+}
+}
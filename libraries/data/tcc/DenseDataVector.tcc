@@ -10,11 +10,59 @@
 
 // stl
 #include <cassert>
+#include <cmath>
 
 namespace ell
 {
 namespace data
 {
+    namespace DenseDataVectorImpl
+    {
+        // four independent partial sums let the compiler vectorize the loop without reassociating a single sum
+        template <typename ElementType>
+        double DotContiguous(const ElementType* pData, const double* pVector, size_t size)
+        {
+            double sum0 = 0.0, sum1 = 0.0, sum2 = 0.0, sum3 = 0.0;
+            size_t i = 0;
+            for (; i + 4 <= size; i += 4)
+            {
+                sum0 += static_cast<double>(pData[i]) * pVector[i];
+                sum1 += static_cast<double>(pData[i + 1]) * pVector[i + 1];
+                sum2 += static_cast<double>(pData[i + 2]) * pVector[i + 2];
+                sum3 += static_cast<double>(pData[i + 3]) * pVector[i + 3];
+            }
+            for (; i < size; ++i)
+            {
+                sum0 += static_cast<double>(pData[i]) * pVector[i];
+            }
+            return (sum0 + sum1) + (sum2 + sum3);
+        }
+
+        template <typename ElementType>
+        double SumOfSquares(const ElementType* pData, size_t size)
+        {
+            double sum0 = 0.0, sum1 = 0.0, sum2 = 0.0, sum3 = 0.0;
+            size_t i = 0;
+            for (; i + 4 <= size; i += 4)
+            {
+                double value0 = static_cast<double>(pData[i]);
+                double value1 = static_cast<double>(pData[i + 1]);
+                double value2 = static_cast<double>(pData[i + 2]);
+                double value3 = static_cast<double>(pData[i + 3]);
+                sum0 += value0 * value0;
+                sum1 += value1 * value1;
+                sum2 += value2 * value2;
+                sum3 += value3 * value3;
+            }
+            for (; i < size; ++i)
+            {
+                double value = static_cast<double>(pData[i]);
+                sum0 += value * value;
+            }
+            return (sum0 + sum1) + (sum2 + sum3);
+        }
+    }
+
     template <typename ElementType>
     DenseDataVector<ElementType>::DenseDataVector()
         : _numNonzeros(0)
@@ -83,5 +131,59 @@ namespace data
         _data[index] = storedValue;
         ++_numNonzeros;
     }
+
+    template <typename ElementType>
+    double DenseDataVector<ElementType>::Norm2() const
+    {
+        return std::sqrt(DenseDataVectorImpl::SumOfSquares(_data.data(), _data.size()));
+    }
+
+    template <typename ElementType>
+    double DenseDataVector<ElementType>::Dot(const math::UnorientedConstVectorReference<double> vector) const
+    {
+        const double* pVector = vector.GetDataPointer();
+        const size_t increment = vector.GetIncrement();
+        const size_t size = _data.size() < vector.Size() ? _data.size() : vector.Size();
+        if (increment == 1)
+        {
+            return DenseDataVectorImpl::DotContiguous(_data.data(), pVector, size);
+        }
+
+        double result = 0.0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            result += static_cast<double>(_data[i]) * pVector[i * increment];
+        }
+        return result;
+    }
+
+    template <typename ElementType>
+    void DenseDataVector<ElementType>::AddTo(math::RowVectorReference<double> vector, double scalar) const
+    {
+        // the last stored element is always nonzero, so the prefix length is the size of the stored data
+        const size_t size = _data.size();
+        if (size > vector.Size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "vector size is smaller than data vector prefix length");
+        }
+
+        double* pVector = vector.GetDataPointer();
+        const size_t increment = vector.GetIncrement();
+        const ElementType* pData = _data.data();
+        if (increment == 1)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                pVector[i] += scalar * static_cast<double>(pData[i]);
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                pVector[i * increment] += scalar * static_cast<double>(pData[i]);
+            }
+        }
+    }
 }
 }
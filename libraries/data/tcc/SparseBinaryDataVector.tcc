@@ -82,27 +82,36 @@ namespace data
     template <typename IntegerListType>
     double SparseBinaryDataVectorBase<IntegerListType>::Dot(const math::UnorientedConstVectorReference<double> vector) const
     {
-        double value = 0.0;
-
-        auto iter = _indices.GetIterator();
-        while (iter.IsValid())
-        {
-            value += vector[iter.Get()];
-            iter.Next();
-        }
+        const double* pVector = vector.GetDataPointer();
+        const size_t increment = vector.GetIncrement();
+        const size_t size = vector.Size();
 
+        double value = 0.0;
+        _indices.DecodeBatches([&](const size_t* pIndices, size_t, size_t count) {
+            for (size_t i = 0; i < count && pIndices[i] < size; ++i)
+            {
+                value += pVector[pIndices[i] * increment];
+            }
+        });
         return value;
     }
 
     template <typename IntegerListType>
     void SparseBinaryDataVectorBase<IntegerListType>::AddTo(math::RowVectorReference<double> vector, double scalar) const
     {
-        auto iter = _indices.GetIterator();
-        while (iter.IsValid())
+        if (PrefixLength() > vector.Size())
         {
-            vector[iter.Get()] += scalar;
-            iter.Next();
+            throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "vector size is smaller than data vector prefix length");
         }
+
+        double* pVector = vector.GetDataPointer();
+        const size_t increment = vector.GetIncrement();
+        _indices.DecodeBatches([&](const size_t* pIndices, size_t, size_t count) {
+            for (size_t i = 0; i < count; ++i)
+            {
+                pVector[pIndices[i] * increment] += scalar;
+            }
+        });
     }
 }
 }
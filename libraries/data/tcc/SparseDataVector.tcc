@@ -9,6 +9,9 @@
 // utilities
 #include "Exception.h"
 
+// stl
+#include <cmath>
+
 namespace ell
 {
 namespace data
@@ -100,5 +103,59 @@ namespace data
             return _indices.Max() + 1;
         }
     }
+
+    template <typename ElementType, typename IntegerListType>
+    double SparseDataVector<ElementType, IntegerListType>::Norm2() const
+    {
+        // the indices are not needed, so this is a contiguous loop over the values
+        double result = 0.0;
+        for (ElementType value : _values)
+        {
+            result += static_cast<double>(value) * static_cast<double>(value);
+        }
+        return std::sqrt(result);
+    }
+
+    template <typename ElementType, typename IntegerListType>
+    double SparseDataVector<ElementType, IntegerListType>::Dot(const math::UnorientedConstVectorReference<double> vector) const
+    {
+        const double* pVector = vector.GetDataPointer();
+        const size_t increment = vector.GetIncrement();
+        const size_t size = vector.Size();
+        const ElementType* pValues = _values.data();
+
+        double result = 0.0;
+        _indices.DecodeBatches([&](const size_t* pIndices, size_t position, size_t count) {
+            for (size_t i = 0; i < count; ++i)
+            {
+                // indices are increasing, so the remaining entries are beyond the end of the vector as well
+                if (pIndices[i] >= size)
+                {
+                    break;
+                }
+                result += static_cast<double>(pValues[position + i]) * pVector[pIndices[i] * increment];
+            }
+        });
+        return result;
+    }
+
+    template <typename ElementType, typename IntegerListType>
+    void SparseDataVector<ElementType, IntegerListType>::AddTo(math::RowVectorReference<double> vector, double scalar) const
+    {
+        if (PrefixLength() > vector.Size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "vector size is smaller than data vector prefix length");
+        }
+
+        double* pVector = vector.GetDataPointer();
+        const size_t increment = vector.GetIncrement();
+        const ElementType* pValues = _values.data();
+        _indices.DecodeBatches([&](const size_t* pIndices, size_t position, size_t count) {
+            for (size_t i = 0; i < count; ++i)
+            {
+                pVector[pIndices[i] * increment] += scalar * static_cast<double>(pValues[position + i]);
+            }
+        });
+    }
 }
 }
@@ -11,4 +11,8 @@
 namespace ell
 {
 void DatasetCastingTests();
+void DatasetIndexedAnyDatasetTest();
+void CompactDatasetTests();
+void ParallelTextParserTests();
+void DatasetBlockIteratorTest();
 }
\ No newline at end of file
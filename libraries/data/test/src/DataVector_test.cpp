@@ -17,6 +17,7 @@
 #include "SparseDataVector.h"
 
 // math
+#include "Matrix.h"
 #include "Vector.h"
 
 // testing
@@ -27,6 +28,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 namespace ell
 {
@@ -68,6 +70,61 @@ void IDataVectorBinaryTest()
     testing::ProcessTest("Testing " + std::string(typeid(DataVectorType).name()) + "::Print()", sss == "0:1\t3:1\t4:1");
 }
 
+template <typename DataVectorType>
+void IDataVectorKernelTest(bool isBinary)
+{
+    // long vectors with gaps of different sizes exercise the multi-byte index encodings, several decoding batches, and the vectorized loops
+    std::vector<data::IndexValue> entries;
+    size_t index = 0;
+    for (size_t i = 0; i < 200; ++i)
+    {
+        index += (i % 50 == 49) ? 20000 : (i % 10 == 9 ? 100 : 1 + i % 3);
+        entries.push_back({ index, isBinary ? 1.0 : static_cast<double>(1 + i % 5) });
+    }
+    DataVectorType u(entries);
+    size_t prefixLength = index + 1;
+
+    // reference results, computed from the index-value iterator
+    double norm2 = 0.0;
+    for (const auto& entry : entries)
+    {
+        norm2 += entry.value * entry.value;
+    }
+    norm2 = std::sqrt(norm2);
+
+    // contiguous vectors, and strided rows of a column-major matrix
+    math::RowVector<double> w(prefixLength);
+    math::Matrix<double, math::MatrixLayout::columnMajor> m(3, prefixLength);
+    for (size_t i = 0; i < prefixLength; ++i)
+    {
+        w[i] = static_cast<double>(i % 7) - 3.0;
+        m(1, i) = w[i];
+    }
+
+    auto truncatedSize = prefixLength / 2;
+    double dot = 0.0;
+    double truncatedDot = 0.0;
+    for (const auto& entry : entries)
+    {
+        dot += entry.value * w[entry.index];
+        truncatedDot += entry.index < truncatedSize ? entry.value * w[entry.index] : 0.0;
+    }
+
+    bool isCorrect = testing::IsEqual(u.Norm2(), norm2) && testing::IsEqual(u.Dot(w), dot) && testing::IsEqual(u.Dot(m.GetRow(1)), dot) && testing::IsEqual(u.Dot(w.GetSubVector(0, truncatedSize)), truncatedDot);
+
+    math::RowVector<double> z(prefixLength);
+    u.AddTo(z, 2.0);
+    u.AddTo(m.GetRow(2), 2.0);
+    for (const auto& entry : entries)
+    {
+        isCorrect = isCorrect && z[entry.index] == 2.0 * entry.value && m(2, entry.index) == 2.0 * entry.value;
+        z[entry.index] = 0.0;
+    }
+    isCorrect = isCorrect && z == math::RowVector<double>(prefixLength);
+
+    testing::ProcessTest("Testing " + std::string(typeid(DataVectorType).name()) + " Norm2/Dot/AddTo kernels", isCorrect);
+}
+
 void IDataVectorTests()
 {
     IDataVectorTest<data::DoubleDataVector>();
@@ -90,6 +147,16 @@ void IDataVectorTests()
     IDataVectorBinaryTest<data::SparseByteDataVector>();
     IDataVectorBinaryTest<data::AutoDataVector>();
     IDataVectorBinaryTest<data::SparseBinaryDataVector>();
+
+    IDataVectorKernelTest<data::DoubleDataVector>(false);
+    IDataVectorKernelTest<data::FloatDataVector>(false);
+    IDataVectorKernelTest<data::ShortDataVector>(false);
+    IDataVectorKernelTest<data::ByteDataVector>(false);
+    IDataVectorKernelTest<data::SparseDoubleDataVector>(false);
+    IDataVectorKernelTest<data::SparseFloatDataVector>(false);
+    IDataVectorKernelTest<data::SparseShortDataVector>(false);
+    IDataVectorKernelTest<data::SparseByteDataVector>(false);
+    IDataVectorKernelTest<data::SparseBinaryDataVector>(true);
 }
 
 template <typename DataVectorType1, typename DataVectorType2>
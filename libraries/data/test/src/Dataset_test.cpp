@@ -7,12 +7,23 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "Dataset_test.h"
+#include "CompactDataset.h"
 #include "Dataset.h"
+#include "DatasetBlockIterator.h"
+#include "ParallelTextParser.h"
+#include "ParsingExampleIterator.h"
+#include "SequentialLineIterator.h"
+#include "SparseEntryParser.h"
+
+// math
+#include "Operations.h"
 
 // testing
 #include "testing.h"
 
 // stl
+#include <cstdio>
+#include <fstream>
 #include <sstream>
 
 namespace ell
@@ -66,4 +77,206 @@ void DatasetCastingTests()
     DatasetCastingTestDispatch<data::AutoSupervisedExample>();
     DatasetCastingTestDispatch<data::DenseSupervisedExample>();
 }
-}
\ No newline at end of file
+
+void DatasetIndexedAnyDatasetTest()
+{
+    data::AutoSupervisedDataset dataset;
+    data::AutoSupervisedDataset permutedDataset;
+    for (size_t i = 0; i < 10; ++i)
+    {
+        auto dataVector = std::make_shared<data::AutoDataVector>(data::AutoDataVector{ static_cast<double>(i) });
+        dataset.AddExample(data::AutoSupervisedExample(dataVector, data::WeightLabel{ 1, static_cast<double>(i) }));
+        permutedDataset.AddExample(data::AutoSupervisedExample(dataVector, data::WeightLabel{ 1, static_cast<double>(i) }));
+    }
+
+    auto anyDataset = dataset.GetAnyDataset(2, 6);
+    auto exampleIndices = anyDataset.GetExampleIndices();
+    bool isSame = exampleIndices == std::vector<size_t>{ 2, 3, 4, 5, 6, 7 };
+
+    // permuting indices must give the same order as permuting the examples
+    std::default_random_engine rng1(123);
+    std::default_random_engine rng2(123);
+    data::RandomPermute(exampleIndices, rng1, 4);
+    permutedDataset.RandomPermute(rng2, 2, 6, 4);
+
+    auto iterator = anyDataset.GetIndexedAnyDataset(exampleIndices, 0, 4).GetExampleIterator<data::DenseSupervisedExample>();
+    size_t count = 0;
+    while (iterator.IsValid())
+    {
+        isSame = isSame && iterator.Get().GetMetadata().label == permutedDataset[2 + count].GetMetadata().label;
+        iterator.Next();
+        ++count;
+    }
+
+    testing::ProcessTest("Dataset::GetIndexedAnyDataset", isSame && count == 4);
+}
+
+void CompactDatasetTest(data::CompactDataset::Layout layout, const std::string& layoutName)
+{
+    data::AutoSupervisedDataset dataset;
+    dataset.AddExample(data::AutoSupervisedExample(std::make_shared<data::AutoDataVector>(data::AutoDataVector{ 1, 0, 2.5, 0, 0, 3 }), data::WeightLabel{ 1, 1 }));
+    dataset.AddExample(data::AutoSupervisedExample(std::make_shared<data::AutoDataVector>(data::AutoDataVector{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7 }), data::WeightLabel{ 2, -1 }));
+    dataset.AddExample(data::AutoSupervisedExample(std::make_shared<data::AutoDataVector>(data::AutoDataVector{ 0.25, 0.5, 0.75 }), data::WeightLabel{ 1, 1 }));
+
+    data::CompactDataset compactDataset(dataset.GetAnyDataset(), layout);
+
+    std::stringstream ss1, ss2;
+    dataset.Print(ss1);
+    compactDataset.Print(ss2);
+    bool isSame = ss1.str() == ss2.str() && compactDataset.NumExamples() == 3 && compactDataset.NumFeatures() == dataset.NumFeatures();
+
+    // views implement the IDataVector interface
+    math::RowVector<double> w{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    math::RowVector<double> u1(12), u2(12);
+    for (size_t i = 0; i < dataset.NumExamples(); ++i)
+    {
+        const auto& dataVector = dataset[i].GetDataVector();
+        auto view = compactDataset.GetDataVector(i);
+        isSame = isSame && testing::IsEqual(dataVector.Dot(w), view.Dot(w)) && testing::IsEqual(dataVector.Norm2(), view.Norm2()) && dataVector.PrefixLength() == view.PrefixLength();
+        dataVector.AddTo(u1, 2.0);
+        view.AddTo(u2, 2.0);
+    }
+    isSame = isSame && u1 == u2;
+
+    // iterating through an AnyDataset converts the views to the requested example type
+    auto iterator = compactDataset.GetAnyDataset(1).GetExampleIterator<data::AutoSupervisedExample>();
+    size_t index = 1;
+    while (iterator.IsValid())
+    {
+        std::stringstream ss3, ss4;
+        iterator.Get().Print(ss3);
+        dataset[index].Print(ss4);
+        isSame = isSame && ss3.str() == ss4.str();
+        iterator.Next();
+        ++index;
+    }
+
+    testing::ProcessTest("CompactDataset (" + layoutName + ")", isSame && index == 3);
+
+    // both datasets convert to the same sparse matrix, whose rows are the examples
+    auto matrix = compactDataset.GetSparseMatrix();
+    bool isMatrixSame = matrix == dataset.GetSparseMatrix() && matrix.NumRows() == 3 && matrix.NumColumns() == 12 && matrix.NumNonzeros() == 7;
+    isMatrixSame = isMatrixSame && compactDataset.GetSparseMatrix(1, 2) == dataset.GetSparseMatrix(1) && matrix(1, 11) == 7 && matrix(2, 1) == 0.5;
+    math::ColumnVector<double> scores(3);
+    math::Operations::Multiply(1.0, matrix, w.Transpose(), 0.0, scores);
+    for (size_t i = 0; i < dataset.NumExamples(); ++i)
+    {
+        isMatrixSame = isMatrixSame && testing::IsEqual(scores[i], dataset[i].GetDataVector().Dot(w));
+    }
+    testing::ProcessTest("CompactDataset::GetSparseMatrix (" + layoutName + ")", isMatrixSame);
+
+    // write to a binary file and memory-map it back
+    std::string filename = "CompactDataset_" + layoutName + ".bin";
+    {
+        std::ofstream stream(filename, std::ios::binary);
+        compactDataset.Write(stream);
+    }
+    bool isMappedSame = data::IsCompactDatasetFile(filename);
+    {
+        data::CompactDataset mappedDataset(filename);
+        std::stringstream ss5;
+        mappedDataset.Print(ss5);
+        isMappedSame = isMappedSame && mappedDataset.IsMemoryMapped() && mappedDataset.GetLayout() == layout && mappedDataset.NumFeatures() == compactDataset.NumFeatures() && ss5.str() == ss1.str();
+    }
+    std::remove(filename.c_str());
+
+    testing::ProcessTest("CompactDataset memory-mapped (" + layoutName + ")", isMappedSame);
+}
+
+void CompactDatasetTests()
+{
+    CompactDatasetTest(data::CompactDataset::Layout::dense, "dense");
+    CompactDatasetTest(data::CompactDataset::Layout::sparse, "sparse");
+}
+
+void ParallelTextParserTest(data::CompactDataset::Layout layout, const std::string& layoutName)
+{
+    // lines of different lengths, with explicit zeros, and without a newline at the end of the text
+    std::stringstream text;
+    for (size_t i = 0; i < 50; ++i)
+    {
+        text << (i % 2 == 0 ? "1" : "-1");
+        for (size_t j = 0; j < i % 7; ++j)
+        {
+            text << " " << (3 * j + i % 3) << ":" << ((i + j) % 4) * 0.5;
+        }
+        if (i < 49)
+        {
+            text << "\n";
+        }
+    }
+    std::string filename = "ParallelTextParser_" + layoutName + ".txt";
+    {
+        std::ofstream stream(filename);
+        stream << text.str();
+    }
+
+    // parse sequentially
+    auto exampleIterator = data::GetParsingExampleIterator(data::SequentialLineIterator(filename), data::SparseEntryParser());
+    data::CompactDataset sequentialDataset(layout);
+    while (exampleIterator->IsValid())
+    {
+        sequentialDataset.AddExample(exampleIterator->Get());
+        exampleIterator->Next();
+    }
+    std::stringstream ss1;
+    sequentialDataset.Print(ss1);
+
+    // parse in parallel, with different numbers of chunks
+    bool isSame = sequentialDataset.NumExamples() == 50;
+    for (size_t numThreads : { 1, 3, 16 })
+    {
+        auto dataset = data::ParseCompactDatasetFile(filename, layout, numThreads);
+        std::stringstream ss2;
+        dataset.Print(ss2);
+        isSame = isSame && ss1.str() == ss2.str() && dataset.NumFeatures() == sequentialDataset.NumFeatures() && dataset.NumStoredValues() == sequentialDataset.NumStoredValues();
+    }
+    std::remove(filename.c_str());
+
+    testing::ProcessTest("ParallelTextParser (" + layoutName + ")", isSame);
+}
+
+void ParallelTextParserTests()
+{
+    ParallelTextParserTest(data::CompactDataset::Layout::dense, "dense");
+    ParallelTextParserTest(data::CompactDataset::Layout::sparse, "sparse");
+}
+
+void DatasetBlockIteratorTest()
+{
+    std::stringstream text;
+    for (size_t i = 0; i < 25; ++i)
+    {
+        text << (i % 2 == 0 ? "1" : "-1") << " 0:" << i << (i < 24 ? "\n" : "");
+    }
+    std::string filename = "DatasetBlockIterator.txt";
+    {
+        std::ofstream stream(filename);
+        stream << text.str();
+    }
+
+    // the blocks must hold the examples of the file, in order, with every block except the last one full
+    bool isSame = true;
+    for (size_t blockSize : { 1, 5, 7, 100 })
+    {
+        auto exampleIterator = data::GetParsingExampleIterator(data::SequentialLineIterator(filename), data::SparseEntryParser());
+        data::DatasetBlockIterator<data::AutoSupervisedDataset> blockIterator(std::move(exampleIterator), blockSize);
+        size_t count = 0;
+        while (blockIterator.IsValid())
+        {
+            const auto& block = blockIterator.Get();
+            isSame = isSame && (block.NumExamples() == blockSize || count + block.NumExamples() == 25);
+            for (size_t i = 0; i < block.NumExamples(); ++i)
+            {
+                isSame = isSame && block[i].GetDataVector().ToArray(1)[0] == count && block[i].GetMetadata().label == (count % 2 == 0 ? 1 : -1);
+                ++count;
+            }
+            blockIterator.Next();
+        }
+        isSame = isSame && count == 25;
+    }
+    std::remove(filename.c_str());
+
+    testing::ProcessTest("DatasetBlockIterator", isSame);
+}
+}
@@ -25,6 +25,10 @@ int main()
     DataVectorOperatorTest();
     CopyAsTests();
     DatasetCastingTests();
+    DatasetIndexedAnyDatasetTest();
+    CompactDatasetTests();
+    ParallelTextParserTests();
+    DatasetBlockIteratorTest();
 
     if (testing::DidTestFail())
     {
@@ -194,6 +194,14 @@ namespace emitters
         /// <returns> Pointer to the output value. </returns>
         llvm::Value* Cast(llvm::Value* pValue, VariableType destinationType);
 
+        /// <summary> Emit a cast operation from an integer address to a pointer. </summary>
+        ///
+        /// <param name="pValue"> Pointer to the input value, an integer that holds an address. </param>
+        /// <param name="destinationType"> Output pointer type. </param>
+        ///
+        /// <returns> Pointer to the output value. </returns>
+        llvm::Value* CastIntToPointer(llvm::Value* pValue, VariableType destinationType);
+
         /// <summary> Emit a cast operation from an int to a float. </summary>
         ///
         /// <param name="pValue"> Pointer to the input value. </param>
@@ -84,6 +84,14 @@ namespace emitters
         /// <returns> Pointer to an llvm::Value that represents the casted value. </returns>
         llvm::Value* Cast(llvm::Value* pValue, VariableType valueType);
 
+        /// <summary> Emit a cast from an integer address to a pointer. </summary>
+        ///
+        /// <param name="pValue"> Pointer to the input value, an integer that holds an address. </param>
+        /// <param name="valueType"> The pointer type to cast to. </param>
+        ///
+        /// <returns> Pointer to an llvm::Value that represents the pointer. </returns>
+        llvm::Value* CastIntToPointer(llvm::Value* pValue, VariableType valueType);
+
         /// <summary> Emit a cast from float to int. </summary>
         ///
         /// <param name="pValue"> Pointer to the input value. </param>
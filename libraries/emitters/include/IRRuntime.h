@@ -37,6 +37,9 @@ namespace emitters
         template <typename ValueType>
         llvm::Function* GetAbsFunction();
 
+        /// <summary> Get the function that reads the processor's cycle counter (returns zero on targets without one) </summary>
+        llvm::Function* GetCycleCounterFunction();
+
     private:
         llvm::Function* GetSqrtFunction(VariableType argType);
         llvm::Function* GetAbsFunction(VariableType argType);
@@ -33,6 +33,7 @@ namespace emitters
         bool inlineOperators = true;
         bool optimize = true;
         bool includeDiagnosticInfo = false;
+        bool profile = false;
     };
 
     /// <summary> Abstract base class for ELL compilers </summary>
@@ -225,6 +225,12 @@ namespace emitters
         return _irBuilder.CreateBitCast(pValue, Type(destinationType));
     }
 
+    llvm::Value* IREmitter::CastIntToPointer(llvm::Value* pValue, VariableType destinationType)
+    {
+        assert(pValue != nullptr);
+        return _irBuilder.CreateIntToPtr(pValue, Type(destinationType));
+    }
+
     llvm::Value* IREmitter::CastIntToFloat(llvm::Value* pValue, VariableType destinationType, bool isSigned)
     {
         assert(pValue != nullptr);
@@ -67,6 +67,11 @@ namespace emitters
         return _pEmitter->Cast(pValue, valueType);
     }
 
+    llvm::Value* IRFunctionEmitter::CastIntToPointer(llvm::Value* pValue, VariableType valueType)
+    {
+        return _pEmitter->CastIntToPointer(pValue, valueType);
+    }
+
     llvm::Value* IRFunctionEmitter::CastFloatToInt(llvm::Value* pValue)
     {
         return _pEmitter->CastFloatToInt(pValue, VariableType::Int32);
@@ -99,5 +99,10 @@ namespace emitters
     {
         return _module.GetIntrinsic(llvm::Intrinsic::fabs, { argType });
     }
+
+    llvm::Function* IRRuntime::GetCycleCounterFunction()
+    {
+        return _module.GetIntrinsic(llvm::Intrinsic::readcyclecounter, {});
+    }
 }
 }
\ No newline at end of file
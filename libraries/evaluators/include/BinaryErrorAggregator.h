@@ -9,6 +9,7 @@
 #pragma once
 
 // stl
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -27,6 +28,14 @@ namespace evaluators
         /// <param name="weight"> The weight. </param>
         void Update(double prediction, double label, double weight);
 
+        /// <summary> Updates this aggregator with an array of evaluations. </summary>
+        ///
+        /// <param name="predictions"> Pointer to the real valued predictions. </param>
+        /// <param name="labels"> Pointer to the labels. </param>
+        /// <param name="weights"> Pointer to the weights. </param>
+        /// <param name="count"> The number of evaluations. </param>
+        void Update(const double* predictions, const double* labels, const double* weights, size_t count);
+
         /// <summary> Returns the current value. </summary>
         ///
         /// <returns> The current value. </returns>
@@ -105,9 +105,10 @@ namespace evaluators
 
         struct ElementUpdaterParameters
         {
-            double prediction;
-            double label;
-            double weight;
+            const double* predictions;
+            const double* labels;
+            const double* weights;
+            size_t count;
         };
 
         template <typename AggregatorT>
@@ -141,7 +142,7 @@ namespace evaluators
         auto GetElementResetFunction() -> ElementResetter<AggregatorType<Index>>;
 
         template <std::size_t... Sequence>
-        void DispatchUpdate(double prediction, double label, double weight, std::index_sequence<Sequence...>);
+        void DispatchUpdate(const std::vector<double>& predictions, std::index_sequence<Sequence...>);
 
         template <std::size_t... Sequence>
         void Aggregate(std::index_sequence<Sequence...>);
@@ -156,6 +157,8 @@ namespace evaluators
         data::Dataset<ExampleType> _dataset;
         EvaluatorParameters _evaluatorParameters;
         size_t _evaluateCounter = 0;
+        std::vector<double> _labels;
+        std::vector<double> _weights;
         typename std::tuple<AggregatorTypes...> _aggregatorTuple;
         std::vector<std::vector<std::vector<double>>> _values;
     };
@@ -9,6 +9,7 @@
 #pragma once
 
 // stl
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -18,7 +19,7 @@ namespace evaluators
 {
     /// <summary> An evaluation aggregator that computes mean loss. </summary>
     ///
-    /// <typeparam name="LossFunctionType"> Loss function type, requires Predict() function. </typeparam>
+    /// <typeparam name="LossFunctionType"> Loss function type, requires scalar and batch Evaluate() functions. </typeparam>
     template <typename LossFunctionType>
     class LossAggregator
     {
@@ -35,6 +36,15 @@ namespace evaluators
         /// <param name="weight"> The weight. </param>
         void Update(double prediction, double label, double weight);
 
+        /// <summary> Updates this aggregator with an array of evaluations, using the batch
+        /// overload of the loss function. </summary>
+        ///
+        /// <param name="predictions"> Pointer to the real valued predictions. </param>
+        /// <param name="labels"> Pointer to the labels. </param>
+        /// <param name="weights"> Pointer to the weights. </param>
+        /// <param name="count"> The number of evaluations. </param>
+        void Update(const double* predictions, const double* labels, const double* weights, size_t count);
+
         /// <summary> Returns the current value. </summary>
         ///
         /// <returns> The current value. </returns>
@@ -52,6 +62,7 @@ namespace evaluators
         LossFunctionType _lossFunction;
         double _sumWeights = 0.0;
         double _sumWeightedLosses = 0.0;
+        std::vector<double> _losses;
     };
 
     template <typename LossFunctionType>
@@ -20,6 +20,15 @@ namespace evaluators
         _aggregates.push_back(Aggregate{ prediction, label, weight });
     }
 
+    void AUCAggregator::Update(const double* predictions, const double* labels, const double* weights, size_t count)
+    {
+        _aggregates.reserve(_aggregates.size() + count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            _aggregates.push_back(Aggregate{ predictions[i], labels[i], weights[i] });
+        }
+    }
+
     std::vector<double> AUCAggregator::GetResult() const
     {
         // sort aggregates by prediction
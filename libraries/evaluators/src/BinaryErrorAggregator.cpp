@@ -38,6 +38,14 @@ namespace evaluators
         }
     }
 
+    void BinaryErrorAggregator::Update(const double* predictions, const double* labels, const double* weights, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            Update(predictions[i], labels[i], weights[i]);
+        }
+    }
+
     std::vector<double> BinaryErrorAggregator::GetResult() const
     {
         double allFalse = _sumFalsePositives + _sumFalseNegatives;
@@ -15,12 +15,45 @@ namespace ell
 {
 namespace evaluators
 {
+    namespace EvaluatorImpl
+    {
+        // updates an aggregator that has an Update overload for arrays of evaluations
+        template <typename AggregatorType>
+        auto UpdateAggregator(AggregatorType& aggregator, const double* predictions, const double* labels, const double* weights, size_t count, int) -> decltype(aggregator.Update(predictions, labels, weights, count), void())
+        {
+            aggregator.Update(predictions, labels, weights, count);
+        }
+
+        // updates an aggregator that only has the per-example Update, one evaluation at a time
+        template <typename AggregatorType>
+        void UpdateAggregator(AggregatorType& aggregator, const double* predictions, const double* labels, const double* weights, size_t count, long)
+        {
+            for (size_t index = 0; index < count; ++index)
+            {
+                aggregator.Update(predictions[index], labels[index], weights[index]);
+            }
+        }
+    }
+
     template <typename PredictorType, typename... AggregatorTypes>
     Evaluator<PredictorType, AggregatorTypes...>::Evaluator(const data::AnyDataset& anyDataset, const EvaluatorParameters& evaluatorParameters, AggregatorTypes... aggregators)
         : _dataset(anyDataset), _evaluatorParameters(evaluatorParameters), _aggregatorTuple(std::make_tuple(aggregators...))
     {
         static_assert(sizeof...(AggregatorTypes) > 0, "Evaluator must contains at least one aggregator");
 
+        // the labels and weights don't change between evaluations, so they are collected once and passed
+        // to the aggregators as arrays, along with the predictions
+        _labels.reserve(_dataset.NumExamples());
+        _weights.reserve(_dataset.NumExamples());
+        auto iterator = _dataset.GetExampleIterator();
+        while (iterator.IsValid())
+        {
+            const auto& metadata = iterator.Get().GetMetadata();
+            _labels.push_back(metadata.label);
+            _weights.push_back(metadata.weight);
+            iterator.Next();
+        }
+
         if (_evaluatorParameters.addZeroEvaluation)
         {
             EvaluateZero();
@@ -36,19 +69,16 @@ namespace evaluators
             return;
         }
 
+        std::vector<double> predictions;
+        predictions.reserve(_labels.size());
         auto iterator = _dataset.GetExampleReferenceIterator();
-
         while (iterator.IsValid())
         {
-            const auto& example = iterator.Get();
-
-            double weight = example.GetMetadata().weight;
-            double label = example.GetMetadata().label;
-            double prediction = predictor.Predict(example.GetDataVector());
-
-            DispatchUpdate(prediction, label, weight, std::make_index_sequence<sizeof...(AggregatorTypes)>());
+            predictions.push_back(predictor.Predict(iterator.Get().GetDataVector()));
             iterator.Next();
         }
+
+        DispatchUpdate(predictions, std::make_index_sequence<sizeof...(AggregatorTypes)>());
         Aggregate(std::make_index_sequence<sizeof...(AggregatorTypes)>());
     }
 
@@ -109,18 +139,8 @@ namespace evaluators
     template <typename PredictorType, typename... AggregatorTypes>
     void Evaluator<PredictorType, AggregatorTypes...>::EvaluateZero()
     {
-        auto iterator = _dataset.GetExampleIterator();
-
-        while (iterator.IsValid())
-        {
-            const auto& example = iterator.Get();
-
-            double weight = example.GetMetadata().weight;
-            double label = example.GetMetadata().label;
-
-            DispatchUpdate(0.0, label, weight, std::make_index_sequence<sizeof...(AggregatorTypes)>());
-            iterator.Next();
-        }
+        std::vector<double> predictions(_labels.size(), 0.0);
+        DispatchUpdate(predictions, std::make_index_sequence<sizeof...(AggregatorTypes)>());
         Aggregate(std::make_index_sequence<sizeof...(AggregatorTypes)>());
     }
 
@@ -136,7 +156,8 @@ namespace evaluators
     template <typename AggregatorT>
     void Evaluator<PredictorType, AggregatorTypes...>::ElementUpdater<AggregatorT>::operator()()
     {
-        _aggregator.Update(_params.prediction, _params.label, _params.weight);
+        // the int argument prefers the array overload of Update, if the aggregator has one
+        EvaluatorImpl::UpdateAggregator(_aggregator, _params.predictions, _params.labels, _params.weights, _params.count, 0);
     }
 
     template <typename PredictorType, typename... AggregatorTypes>
@@ -170,12 +191,12 @@ namespace evaluators
 
     template <typename PredictorType, typename... AggregatorTypes>
     template <std::size_t... Sequence>
-    void Evaluator<PredictorType, AggregatorTypes...>::DispatchUpdate(double prediction, double label, double weight, std::index_sequence<Sequence...>)
+    void Evaluator<PredictorType, AggregatorTypes...>::DispatchUpdate(const std::vector<double>& predictions, std::index_sequence<Sequence...>)
     {
         // Call (X.Update(), 0) for each X in _aggregatorTuple
-        ElementUpdaterParameters params{ prediction, label, weight };
+        ElementUpdaterParameters params{ predictions.data(), _labels.data(), _weights.data(), predictions.size() };
         utilities::InOrderFunctionEvaluator(GetElementUpdateFunction<Sequence>(params)...);
-        // [this, prediction, label, weight]() { std::get<Sequence>(_aggregatorTuple).Update(prediction, label, weight); }...); // GCC bug prevents compilation
+        // [this, &predictions]() { std::get<Sequence>(_aggregatorTuple).Update(predictions.data(), _labels.data(), _weights.data(), predictions.size()); }...); // GCC bug prevents compilation
     }
 
     template <typename PredictorType, typename... AggregatorTypes>
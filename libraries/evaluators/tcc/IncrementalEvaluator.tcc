@@ -28,22 +28,20 @@ namespace evaluators
 
         while (iterator.IsValid())
         {
-            const auto& example = iterator.Get();
-
-            double exampleWeight = example.GetMetadata().weight;
-            double label = example.GetMetadata().label;
-            _predictions[index] += basePredictorWeight * basePredictor.Predict(example.GetDataVector());
-
-            if (evaluate)
-            {
-                BaseClassType::DispatchUpdate(_predictions[index] * evaluationRescale, label, exampleWeight, std::make_index_sequence<sizeof...(AggregatorTypes)>());
-            }
-
+            _predictions[index] += basePredictorWeight * basePredictor.Predict(iterator.Get().GetDataVector());
             iterator.Next();
             ++index;
         }
+
         if (evaluate)
         {
+            std::vector<double> rescaledPredictions(_predictions.size());
+            for (size_t i = 0; i < _predictions.size(); ++i)
+            {
+                rescaledPredictions[i] = _predictions[i] * evaluationRescale;
+            }
+
+            BaseClassType::DispatchUpdate(rescaledPredictions, std::make_index_sequence<sizeof...(AggregatorTypes)>());
             BaseClassType::Aggregate(std::make_index_sequence<sizeof...(AggregatorTypes)>());
         }
     }
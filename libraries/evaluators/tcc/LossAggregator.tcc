@@ -24,6 +24,18 @@ namespace evaluators
         _sumWeightedLosses += weight * loss;
     }
 
+    template <typename LossFunctionType>
+    void LossAggregator<LossFunctionType>::Update(const double* predictions, const double* labels, const double* weights, size_t count)
+    {
+        _losses.resize(count);
+        _lossFunction.Evaluate(predictions, labels, _losses.data(), count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            _sumWeights += weights[i];
+            _sumWeightedLosses += weights[i] * _losses[i];
+        }
+    }
+
     template <typename LossFunctionType>
     std::vector<double> LossAggregator<LossFunctionType>::GetResult() const
     {
@@ -10,4 +10,5 @@
 namespace ell
 {
 void TestEvaluators();
+void TestEvaluatorWithPerExampleAggregator();
 }
\ No newline at end of file
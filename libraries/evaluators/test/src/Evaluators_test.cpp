@@ -26,6 +26,8 @@
 
 // stl
 #include <iostream>
+#include <string>
+#include <vector>
 
 namespace ell
 {
@@ -53,4 +55,32 @@ void TestEvaluators()
     std::cout << "Goodness: " << evaluator->GetGoodness() << std::endl;
     testing::ProcessTest("Evaluator sanity check", !testing::IsEqual(evaluator->GetGoodness(), 0.0, 1e-8));
 }
+
+// an aggregator that only has the per-example Update, like those written before the array overload was added
+class WeightedLabelSumAggregator
+{
+public:
+    void Update(double prediction, double label, double weight) { _sum += weight * label * prediction; }
+    std::vector<double> GetResult() const { return { _sum }; }
+    void Reset() { _sum = 0.0; }
+    std::vector<std::string> GetValueNames() const { return { "WeightedLabelSum" }; }
+
+private:
+    double _sum = 0.0;
+};
+
+void TestEvaluatorWithPerExampleAggregator()
+{
+    using ExampleType = data::DenseSupervisedDataset::DatasetExampleType;
+    data::DenseSupervisedDataset dataset;
+    dataset.AddExample(ExampleType{ { 1.0, 1.0 }, data::WeightLabel{ 1.0, -1.0 } });
+    dataset.AddExample(ExampleType{ { -1.0, 2.0 }, data::WeightLabel{ 2.0, 1.0 } });
+
+    // the predictions are 3 and 2, so the aggregator sums 1 * -1 * 3 + 2 * 1 * 2
+    evaluators::EvaluatorParameters evaluatorParams{ 1, false };
+    predictors::LinearPredictor predictor({ 1.0, 1.0 }, 1.0);
+    evaluators::Evaluator<predictors::LinearPredictor, WeightedLabelSumAggregator> evaluator(dataset.GetAnyDataset(), evaluatorParams, WeightedLabelSumAggregator());
+    evaluator.Evaluate(predictor);
+    testing::ProcessTest("Evaluator with a per-example aggregator", testing::IsEqual(evaluator.GetGoodness(), 1.0));
+}
 }
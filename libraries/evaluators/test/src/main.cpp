@@ -24,6 +24,7 @@ int main()
     try
     {
         TestEvaluators();
+        TestEvaluatorWithPerExampleAggregator();
     }
     catch (const utilities::Exception& exception)
     {
@@ -8,6 +8,9 @@
 
 #pragma once
 
+// stl
+#include <cstddef>
+
 namespace ell
 {
 namespace lossFunctions
@@ -37,6 +40,26 @@ namespace lossFunctions
         /// <returns> The loss derivative. </returns>
         double GetDerivative(double prediction, double label) const;
 
+        /// <summary> Computes the loss at an array of points. The loop uses the approximations in
+        /// math::FastMath instead of library calls, so that the compiler can vectorize it. The relative
+        /// error of each loss is below 1e-15. </summary>
+        ///
+        /// <param name="predictions"> Pointer to the predictions. </param>
+        /// <param name="labels"> Pointer to the labels. </param>
+        /// <param name="losses"> Pointer to an array that receives the losses. </param>
+        /// <param name="count"> The number of points. </param>
+        void Evaluate(const double* predictions, const double* labels, double* losses, size_t count) const;
+
+        /// <summary> Computes the loss derivative at an array of points. The loop uses the approximations
+        /// in math::FastMath instead of library calls, so that the compiler can vectorize it. The relative
+        /// error of each derivative is below 1e-15. </summary>
+        ///
+        /// <param name="predictions"> Pointer to the predictions. </param>
+        /// <param name="labels"> Pointer to the labels. </param>
+        /// <param name="derivatives"> Pointer to an array that receives the loss derivatives. </param>
+        /// <param name="count"> The number of points. </param>
+        void GetDerivative(const double* predictions, const double* labels, double* derivatives, size_t count) const;
+
     private:
         double _scale = 1.0;
     };
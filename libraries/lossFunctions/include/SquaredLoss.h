@@ -8,6 +8,9 @@
 
 #pragma once
 
+// stl
+#include <cstddef>
+
 namespace ell
 {
 namespace lossFunctions
@@ -32,6 +35,24 @@ namespace lossFunctions
         /// <returns> The loss derivative. </returns>
         double GetDerivative(double prediction, double label) const;
 
+        /// <summary> Computes the loss at an array of points. The loop has no branches or library calls,
+        /// so that the compiler can vectorize it. </summary>
+        ///
+        /// <param name="predictions"> Pointer to the predictions. </param>
+        /// <param name="labels"> Pointer to the labels. </param>
+        /// <param name="losses"> Pointer to an array that receives the losses. </param>
+        /// <param name="count"> The number of points. </param>
+        void Evaluate(const double* predictions, const double* labels, double* losses, size_t count) const;
+
+        /// <summary> Computes the loss derivative at an array of points. The loop has no branches or
+        /// library calls, so that the compiler can vectorize it. </summary>
+        ///
+        /// <param name="predictions"> Pointer to the predictions. </param>
+        /// <param name="labels"> Pointer to the labels. </param>
+        /// <param name="derivatives"> Pointer to an array that receives the loss derivatives. </param>
+        /// <param name="count"> The number of points. </param>
+        void GetDerivative(const double* predictions, const double* labels, double* derivatives, size_t count) const;
+
         /// <summary> Evaluates the convex function that generates this Bregman loss. </summary>
         ///
         /// <param name="value"> The input to the convex function. </param>
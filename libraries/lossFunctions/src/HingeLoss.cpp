@@ -8,6 +8,9 @@
 
 #include "HingeLoss.h"
 
+// stl
+#include <algorithm>
+
 namespace ell
 {
 namespace lossFunctions
@@ -33,5 +36,21 @@ namespace lossFunctions
 
         return 0.0;
     }
+
+    void HingeLoss::Evaluate(const double* predictions, const double* labels, double* losses, size_t count) const
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            losses[i] = std::max(1.0 - predictions[i] * labels[i], 0.0);
+        }
+    }
+
+    void HingeLoss::GetDerivative(const double* predictions, const double* labels, double* derivatives, size_t count) const
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            derivatives[i] = predictions[i] * labels[i] <= 1.0 ? -labels[i] : 0.0;
+        }
+    }
 }
 }
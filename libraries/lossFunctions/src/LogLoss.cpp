@@ -8,6 +8,9 @@
 
 #include "LogLoss.h"
 
+// math
+#include "FastMath.h"
+
 // stl
 #include <cmath>
 
@@ -50,5 +53,23 @@ namespace lossFunctions
             return -label * exp_neg_scaled_margin / (1.0 + exp_neg_scaled_margin);
         }
     }
+
+    void LogLoss::Evaluate(const double* predictions, const double* labels, double* losses, size_t count) const
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            double scaledMargin = _scale * predictions[i] * labels[i];
+            losses[i] = math::FastMath::LogOnePlusExp(-scaledMargin) / _scale;
+        }
+    }
+
+    void LogLoss::GetDerivative(const double* predictions, const double* labels, double* derivatives, size_t count) const
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            double scaledMargin = _scale * predictions[i] * labels[i];
+            derivatives[i] = -labels[i] * math::FastMath::Logistic(-scaledMargin);
+        }
+    }
 }
 }
@@ -27,6 +27,23 @@ namespace lossFunctions
         return residual;
     }
 
+    void SquaredLoss::Evaluate(const double* predictions, const double* labels, double* losses, size_t count) const
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            double residual = predictions[i] - labels[i];
+            losses[i] = 0.5 * residual * residual;
+        }
+    }
+
+    void SquaredLoss::GetDerivative(const double* predictions, const double* labels, double* derivatives, size_t count) const
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            derivatives[i] = predictions[i] - labels[i];
+        }
+    }
+
     double SquaredLoss::BregmanGenerator(double value) const
     {
         return value * value;
@@ -14,9 +14,12 @@
 #include "testing.h"
 
 // stl
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <limits>
 #include <string>
+#include <vector>
 
 using namespace ell;
 
@@ -68,6 +71,70 @@ void squaredLossTest()
     testing::ProcessTest("Testing lossFunctions::SquaredLoss::GetDerivative(2,4)", testing::IsEqual(squaredLoss.GetDerivative(2, 4), -2.0));
 }
 
+// Gets the largest difference between values and their reference values, relative to the reference values
+double GetMaxRelativeError(const std::vector<double>& values, const std::vector<double>& referenceValues)
+{
+    double maxError = 0;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        double error = std::abs(values[i] - referenceValues[i]);
+        if (error > 0)
+        {
+            maxError = std::max(maxError, error / std::max(std::abs(referenceValues[i]), std::numeric_limits<double>::min()));
+        }
+    }
+    return maxError;
+}
+
+template <typename LossFunctionType, typename ReferenceLossType, typename ReferenceDerivativeType>
+void batchTest(const std::string& lossName, const LossFunctionType& loss, ReferenceLossType referenceLoss, ReferenceDerivativeType referenceDerivative, double tolerance)
+{
+    std::vector<double> predictions;
+    std::vector<double> labels;
+    for (double prediction = -40.0; prediction <= 40.0; prediction += 0.25)
+    {
+        predictions.push_back(prediction);
+        labels.push_back(1.0);
+        predictions.push_back(prediction);
+        labels.push_back(-1.0);
+    }
+
+    std::vector<double> expectedLosses;
+    std::vector<double> expectedDerivatives;
+    for (size_t i = 0; i < predictions.size(); ++i)
+    {
+        expectedLosses.push_back(referenceLoss(predictions[i], labels[i]));
+        expectedDerivatives.push_back(referenceDerivative(predictions[i], labels[i]));
+    }
+
+    std::vector<double> losses(predictions.size());
+    std::vector<double> derivatives(predictions.size());
+    loss.Evaluate(predictions.data(), labels.data(), losses.data(), predictions.size());
+    loss.GetDerivative(predictions.data(), labels.data(), derivatives.data(), predictions.size());
+
+    testing::ProcessTest("Testing lossFunctions::" + lossName + "::Evaluate(predictions, labels)", GetMaxRelativeError(losses, expectedLosses) <= tolerance);
+    testing::ProcessTest("Testing lossFunctions::" + lossName + "::GetDerivative(predictions, labels)", GetMaxRelativeError(derivatives, expectedDerivatives) <= tolerance);
+}
+
+// The batch hinge and squared losses must match the scalar ones exactly
+template <typename LossFunctionType>
+void batchTest(const std::string& lossName, const LossFunctionType& loss)
+{
+    batchTest(lossName, loss, [&loss](double prediction, double label) { return loss.Evaluate(prediction, label); }, [&loss](double prediction, double label) { return loss.GetDerivative(prediction, label); }, 0.0);
+}
+
+// The batch log loss is compared to a reference computed with std::log1p and std::exp, rather than to the scalar log
+// loss, which drops terms below 1e-7 when the margin is very negative
+void logLossBatchTest()
+{
+    const double scale = 0.5;
+    auto softplus = [](double x) { return x > 0 ? x + std::log1p(std::exp(-x)) : std::log1p(std::exp(x)); };
+    auto logistic = [](double x) { return x >= 0 ? 1.0 / (1.0 + std::exp(-x)) : std::exp(x) / (1.0 + std::exp(x)); };
+    auto referenceLoss = [&](double prediction, double label) { return softplus(-scale * prediction * label) / scale; };
+    auto referenceDerivative = [&](double prediction, double label) { return -label * logistic(-scale * prediction * label); };
+    batchTest("LogLoss", lossFunctions::LogLoss(scale), referenceLoss, referenceDerivative, 1.0e-15);
+}
+
 /// Runs all tests
 ///
 int main()
@@ -76,6 +143,10 @@ int main()
     logLossTest();
     squaredLossTest();
 
+    batchTest("HingeLoss", lossFunctions::HingeLoss());
+    logLossBatchTest();
+    batchTest("SquaredLoss", lossFunctions::SquaredLoss());
+
     if (testing::DidTestFail())
     {
         return 1;
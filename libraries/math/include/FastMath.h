@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FastMath.h (math)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <cstdint>
+
+namespace ell
+{
+namespace math
+{
+    /// <summary>
+    /// Approximations of transcendental functions that are written without branches or library calls,
+    /// so that loops that call them can be vectorized by the compiler. The functions are inline and are
+    /// meant to be called from loops over arrays. Outside of their stated domains, arguments are clamped.
+    /// GCC only turns the clamps into vector min and max instructions when floating point exceptions
+    /// aren't observable, so libraries that call these functions from hot loops compile with
+    /// -fno-trapping-math.
+    /// </summary>
+    struct FastMath
+    {
+        /// <summary> Computes exp(x), with a relative error below 1e-15 for x in [-708, 709]. Arguments
+        /// outside this interval are clamped to it, so the result is always a finite, positive number. </summary>
+        ///
+        /// <param name="x"> The argument. </param>
+        ///
+        /// <returns> The approximation of exp(x). </returns>
+        static double Exp(double x);
+
+        /// <summary> Computes log(1 + exp(x)), also known as softplus, with a relative error below 1e-15.
+        /// Unlike the direct formula, it doesn't overflow for large x and keeps full relative precision
+        /// for negative x down to -708. </summary>
+        ///
+        /// <param name="x"> The argument. </param>
+        ///
+        /// <returns> The approximation of log(1 + exp(x)). </returns>
+        static double LogOnePlusExp(double x);
+
+        /// <summary> Computes the logistic function 1 / (1 + exp(-x)), with a relative error below 1e-15. </summary>
+        ///
+        /// <param name="x"> The argument. </param>
+        ///
+        /// <returns> The approximation of 1 / (1 + exp(-x)). </returns>
+        static double Logistic(double x);
+
+    private:
+        static double LogOnePlus(double x);
+        static uint64_t ToBits(double x);
+        static double FromBits(uint64_t bits);
+    };
+}
+}
+
+#include "../tcc/FastMath.tcc"
@@ -7,6 +7,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "Matrix.h"
+#include "SparseMatrix.h"
 #include "Vector.h"
 #ifdef USE_BLAS
 #include "BlasWrapper.h"
@@ -16,7 +17,11 @@
 #define MATH_OPERATIONS_H
 
 // stl
+#include <algorithm>
+#include <future>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace ell
 {
@@ -48,6 +53,70 @@ namespace math
         /// <param name="M"> [in,out] The row major matrix to which the scalar is added. </param>
         template <typename ElementType, MatrixLayout Layout>
         static void Add(ElementType s, MatrixReference<ElementType, Layout> M);
+
+        /// <summary>
+        /// Generalized sparse matrix column-vector multiplication, u = s * M * v + t * u. Large matrices
+        /// are split into ranges of rows (or columns) with roughly equal numbers of nonzeros, which are
+        /// processed by concurrent threads.
+        /// </summary>
+        ///
+        /// <typeparam name="ElementType"> Matrix and vector element type. </typeparam>
+        /// <typeparam name="Layout"> Sparse matrix layout. </typeparam>
+        /// <param name="s"> The scalar that multiplies the matrix. </param>
+        /// <param name="M"> The sparse matrix. </param>
+        /// <param name="v"> The column vector that multiplies the matrix on the right. </param>
+        /// <param name="t"> The scalar that multiplies u. </param>
+        /// <param name="u"> [in,out] A column vector, multiplied by t and used to store the result. </param>
+        template <typename ElementType, MatrixLayout Layout>
+        static void Multiply(ElementType s, const SparseMatrix<ElementType, Layout>& M, ConstVectorReference<ElementType, VectorOrientation::column> v, ElementType t, VectorReference<ElementType, VectorOrientation::column> u);
+
+        /// <summary>
+        /// Generalized row-vector sparse matrix multiplication, u = s * v * M + t * u, which computes the
+        /// product of the transposed matrix with a vector without transposing the matrix.
+        /// </summary>
+        ///
+        /// <typeparam name="ElementType"> Matrix and vector element type. </typeparam>
+        /// <typeparam name="Layout"> Sparse matrix layout. </typeparam>
+        /// <param name="s"> The scalar that multiplies the matrix. </param>
+        /// <param name="v"> The row vector that multiplies the matrix on the left. </param>
+        /// <param name="M"> The sparse matrix. </param>
+        /// <param name="t"> The scalar that multiplies u. </param>
+        /// <param name="u"> [in,out] A row vector, multiplied by t and used to store the result. </param>
+        template <typename ElementType, MatrixLayout Layout>
+        static void Multiply(ElementType s, ConstVectorReference<ElementType, VectorOrientation::row> v, const SparseMatrix<ElementType, Layout>& M, ElementType t, VectorReference<ElementType, VectorOrientation::row> u);
+
+        /// <summary>
+        /// Generalized sparse matrix dense matrix multiplication, C = s * A * B + t * C. With a CSR
+        /// matrix, threads process ranges of rows of C; with a CSC matrix, they process ranges of columns of C.
+        /// </summary>
+        ///
+        /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+        /// <typeparam name="LayoutA"> Sparse matrix layout of A. </typeparam>
+        /// <typeparam name="LayoutB"> Matrix layout of B. </typeparam>
+        /// <typeparam name="LayoutC"> Matrix layout of C. </typeparam>
+        /// <param name="s"> The scalar that multiplies the matrix product. </param>
+        /// <param name="A"> The sparse matrix that multiplies B on the left. </param>
+        /// <param name="B"> The dense matrix that multiplies A on the right. </param>
+        /// <param name="t"> The scalar that multiplies C. </param>
+        /// <param name="C"> [in,out] A matrix, multiplied by t and used to store the result. </param>
+        template <typename ElementType, MatrixLayout LayoutA, MatrixLayout LayoutB, MatrixLayout LayoutC>
+        static void Multiply(ElementType s, const SparseMatrix<ElementType, LayoutA>& A, ConstMatrixReference<ElementType, LayoutB> B, ElementType t, MatrixReference<ElementType, LayoutC> C);
+
+    private:
+        static size_t GetNumThreads(size_t numOperations);
+
+        // calls function(thread, begin, end) concurrently on ranges of intervals with roughly equal total size
+        template <typename FunctionType>
+        static void ParallelFor(const std::vector<size_t>& offsets, size_t numThreads, FunctionType function);
+
+        template <typename ElementType>
+        static void Scale(ElementType t, ElementType* pU, size_t size, size_t increment);
+
+        template <typename ElementType, MatrixLayout Layout>
+        static void SparseGather(ElementType s, const SparseMatrix<ElementType, Layout>& M, const ElementType* pV, size_t vIncrement, ElementType t, ElementType* pU, size_t uIncrement);
+
+        template <typename ElementType, MatrixLayout Layout>
+        static void SparseScatter(ElementType s, const SparseMatrix<ElementType, Layout>& M, const ElementType* pV, size_t vIncrement, ElementType t, ElementType* pU, size_t uSize, size_t uIncrement);
     };
 
     /// <summary>
@@ -112,6 +181,7 @@ namespace math
     {
         using CommonOperations::Norm0;
         using CommonOperations::Add;
+        using CommonOperations::Multiply;
         using DerivedOperations<OperationsImplementation<ImplementationType::native>>::Copy;
         using DerivedOperations<OperationsImplementation<ImplementationType::native>>::Multiply;
 
@@ -194,6 +264,38 @@ namespace math
         /// <param name="u"> [in,out] A column vector, multiplied by t and used to store the result. </param>
         template <typename ElementType, MatrixLayout Layout>
         static void Multiply(ElementType s, ConstMatrixReference<ElementType, Layout> M, ConstVectorReference<ElementType, VectorOrientation::column> v, ElementType t, VectorReference<ElementType, VectorOrientation::column> u);
+
+        /// <summary> Generalized matrix matrix multiplication, C = s * A * B + t * C. </summary>
+        ///
+        /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+        /// <typeparam name="LayoutA"> Layout of the matrix A. </typeparam>
+        /// <typeparam name="LayoutB"> Layout of the matrix B. </typeparam>
+        /// <typeparam name="LayoutC"> Layout of the matrix C. </typeparam>
+        /// <param name="s"> The scalar that multiplies the matrix product. </param>
+        /// <param name="A"> The left matrix. </param>
+        /// <param name="B"> The right matrix. </param>
+        /// <param name="t"> The scalar that multiplies C. </param>
+        /// <param name="C"> [in,out] A matrix, multiplied by t and used to store the result. </param>
+        template <typename ElementType, MatrixLayout LayoutA, MatrixLayout LayoutB, MatrixLayout LayoutC>
+        static void Multiply(ElementType s, ConstMatrixReference<ElementType, LayoutA> A, ConstMatrixReference<ElementType, LayoutB> B, ElementType t, MatrixReference<ElementType, LayoutC> C);
+
+    private:
+        // unit-stride kernels, selected by Dot and by matrix-vector Multiply when the vector increments are 1
+        template <typename ElementType>
+        static ElementType UnitStrideDot(const ElementType* pU, const ElementType* pV, size_t size);
+
+        template <typename ElementType>
+        static void RowMajorMultiply(ElementType s, const ElementType* pM, size_t numRows, size_t numColumns, size_t increment, const ElementType* pV, ElementType t, ElementType* pU);
+
+        template <typename ElementType>
+        static void ColumnMajorMultiply(ElementType s, const ElementType* pM, size_t numRows, size_t numColumns, size_t increment, const ElementType* pV, ElementType t, ElementType* pU);
+
+        // cache-blocked kernel for C += s * A * B; a column major C is handled as the row major C^T += s * B^T * A^T
+        template <typename ElementType, MatrixLayout LayoutA, MatrixLayout LayoutB>
+        static void MultiplyBlocked(ElementType s, ConstMatrixReference<ElementType, LayoutA> A, ConstMatrixReference<ElementType, LayoutB> B, MatrixReference<ElementType, MatrixLayout::rowMajor> C);
+
+        template <typename ElementType, MatrixLayout LayoutA, MatrixLayout LayoutB>
+        static void MultiplyBlocked(ElementType s, ConstMatrixReference<ElementType, LayoutA> A, ConstMatrixReference<ElementType, LayoutB> B, MatrixReference<ElementType, MatrixLayout::columnMajor> C);
     };
 
 #ifdef USE_BLAS
@@ -204,6 +306,7 @@ namespace math
     {
         using CommonOperations::Norm0;
         using CommonOperations::Add;
+        using CommonOperations::Multiply;
         using DerivedOperations<OperationsImplementation<ImplementationType::openBlas>>::Copy;
         using DerivedOperations<OperationsImplementation<ImplementationType::openBlas>>::Multiply;
 
@@ -298,6 +401,20 @@ namespace math
         /// <param name="u"> [in,out] A row vector, multiplied by t and used to store the result. </param>
         template <typename ElementType, MatrixLayout Layout>
         static void Multiply(ElementType s, ConstVectorReference<ElementType, VectorOrientation::row> v, const ConstMatrixReference<ElementType, Layout> M, ElementType t, VectorReference<ElementType, VectorOrientation::row> u);
+
+        /// <summary> Generalized matrix matrix multiplication, C = s * A * B + t * C. </summary>
+        ///
+        /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+        /// <typeparam name="LayoutA"> Layout of the matrix A. </typeparam>
+        /// <typeparam name="LayoutB"> Layout of the matrix B. </typeparam>
+        /// <typeparam name="LayoutC"> Layout of the matrix C. </typeparam>
+        /// <param name="s"> The scalar that multiplies the matrix product. </param>
+        /// <param name="A"> The left matrix. </param>
+        /// <param name="B"> The right matrix. </param>
+        /// <param name="t"> The scalar that multiplies C. </param>
+        /// <param name="C"> [in,out] A matrix, multiplied by t and used to store the result. </param>
+        template <typename ElementType, MatrixLayout LayoutA, MatrixLayout LayoutB, MatrixLayout LayoutC>
+        static void Multiply(ElementType s, ConstMatrixReference<ElementType, LayoutA> A, ConstMatrixReference<ElementType, LayoutB> B, ElementType t, MatrixReference<ElementType, LayoutC> C);
     };
 
     using Operations = OperationsImplementation<ImplementationType::openBlas>;
@@ -0,0 +1,176 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SparseMatrix.h (math)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Matrix.h"
+
+// stl
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+namespace ell
+{
+namespace math
+{
+    /// <summary>
+    /// A sparse matrix that stores only its nonzero elements. A row major sparse matrix is stored in
+    /// compressed sparse row (CSR) format and a column major sparse matrix is stored in compressed sparse
+    /// column (CSC) format. In both cases, the matrix is a sequence of intervals (rows or columns). The
+    /// nonzeros of interval i are stored in positions offsets[i] to offsets[i+1]-1 of the values array,
+    /// and the indices array holds the position of each nonzero within its interval (its column in CSR,
+    /// its row in CSC). Indices within an interval are strictly increasing.
+    /// </summary>
+    ///
+    /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+    /// <typeparam name="Layout"> Matrix layout, rowMajor for CSR or columnMajor for CSC. </typeparam>
+    template <typename ElementType, MatrixLayout Layout>
+    class SparseMatrix
+    {
+    public:
+        /// <summary> Constructs an all-zeros sparse matrix of a given size. </summary>
+        ///
+        /// <param name="numRows"> Number of rows in the matrix. </param>
+        /// <param name="numColumns"> Number of columns in the matrix. </param>
+        SparseMatrix(size_t numRows, size_t numColumns);
+
+        /// <summary> Constructs a sparse matrix that takes ownership of arrays that are already in its storage format. </summary>
+        ///
+        /// <param name="numRows"> Number of rows in the matrix. </param>
+        /// <param name="numColumns"> Number of columns in the matrix. </param>
+        /// <param name="offsets"> The offset of each interval in the values array, followed by the number of nonzeros. </param>
+        /// <param name="indices"> The position of each nonzero within its interval. </param>
+        /// <param name="values"> The nonzero values. </param>
+        SparseMatrix(size_t numRows, size_t numColumns, std::vector<size_t> offsets, std::vector<size_t> indices, std::vector<ElementType> values);
+
+        /// <summary> Constructs a sparse matrix from the nonzero elements of a dense matrix. </summary>
+        ///
+        /// <typeparam name="DenseLayout"> Layout of the dense matrix. </typeparam>
+        /// <param name="M"> The dense matrix. </param>
+        template <MatrixLayout DenseLayout>
+        explicit SparseMatrix(ConstMatrixReference<ElementType, DenseLayout> M);
+
+        /// <summary> Constructs a sparse matrix from another sparse matrix, converting between CSR and CSC if necessary. </summary>
+        ///
+        /// <typeparam name="OtherLayout"> Layout of the other sparse matrix. </typeparam>
+        /// <param name="other"> The other sparse matrix. </param>
+        template <MatrixLayout OtherLayout>
+        explicit SparseMatrix(const SparseMatrix<ElementType, OtherLayout>& other);
+
+        SparseMatrix(SparseMatrix<ElementType, Layout>&&) = default;
+
+        SparseMatrix(const SparseMatrix<ElementType, Layout>&) = default;
+
+        SparseMatrix<ElementType, Layout>& operator=(SparseMatrix<ElementType, Layout>&&) = default;
+
+        SparseMatrix<ElementType, Layout>& operator=(const SparseMatrix<ElementType, Layout>&) = default;
+
+        /// <summary> Gets the number of rows. </summary>
+        ///
+        /// <returns> The number of rows. </returns>
+        size_t NumRows() const { return _numRows; }
+
+        /// <summary> Gets the number of columns. </summary>
+        ///
+        /// <returns> The number of columns. </returns>
+        size_t NumColumns() const { return _numColumns; }
+
+        /// <summary> Gets the number of intervals (rows in CSR, columns in CSC). </summary>
+        ///
+        /// <returns> The number of intervals. </returns>
+        size_t NumIntervals() const { return _offsets.size() - 1; }
+
+        /// <summary> Gets the number of stored nonzeros. </summary>
+        ///
+        /// <returns> The number of nonzeros. </returns>
+        size_t NumNonzeros() const { return _values.size(); }
+
+        /// <summary> Gets the matrix layout. </summary>
+        ///
+        /// <returns> The matrix layout. </returns>
+        MatrixLayout GetLayout() const { return Layout; }
+
+        /// <summary> Gets the offset of each interval in the values array, followed by the number of nonzeros. </summary>
+        ///
+        /// <returns> The interval offsets. </returns>
+        const std::vector<size_t>& GetOffsets() const { return _offsets; }
+
+        /// <summary> Gets the position of each nonzero within its interval. </summary>
+        ///
+        /// <returns> The nonzero indices. </returns>
+        const std::vector<size_t>& GetIndices() const { return _indices; }
+
+        /// <summary> Gets the nonzero values. </summary>
+        ///
+        /// <returns> The nonzero values. </returns>
+        const std::vector<ElementType>& GetValues() const { return _values; }
+
+        /// <summary> Gets a matrix element. Takes time that is logarithmic in the number of nonzeros in the interval. </summary>
+        ///
+        /// <param name="rowIndex"> Zero-based index of the row. </param>
+        /// <param name="columnIndex"> Zero-based index of the column. </param>
+        ///
+        /// <returns> The matrix element, which is zero if it isn't stored. </returns>
+        ElementType operator()(size_t rowIndex, size_t columnIndex) const;
+
+        /// <summary> Gets the transpose of this matrix, which shares no memory with it. The transpose of a
+        /// CSR matrix is a CSC matrix with the same arrays, so this only copies the arrays. </summary>
+        ///
+        /// <returns> The transposed matrix. </returns>
+        SparseMatrix<ElementType, Layout == MatrixLayout::rowMajor ? MatrixLayout::columnMajor : MatrixLayout::rowMajor> Transpose() const;
+
+        /// <summary> Copies this matrix into a dense matrix. </summary>
+        ///
+        /// <returns> The dense matrix. </returns>
+        Matrix<ElementType, Layout> ToMatrix() const;
+
+        /// <summary> Equality operator. </summary>
+        ///
+        /// <param name="other"> The other matrix. </param>
+        ///
+        /// <returns> true if the two matrices have the same size and store the same nonzeros. </returns>
+        bool operator==(const SparseMatrix<ElementType, Layout>& other) const;
+
+        /// <summary> Inequality operator. </summary>
+        ///
+        /// <param name="other"> The other matrix. </param>
+        ///
+        /// <returns> true if the two matrices are not equal. </returns>
+        bool operator!=(const SparseMatrix<ElementType, Layout>& other) const { return !(*this == other); }
+
+        /// <summary> Prints the nonzeros of the matrix, one interval per line, as index:value pairs. </summary>
+        ///
+        /// <param name="os"> [in,out] Stream to write data to. </param>
+        void Print(std::ostream& os) const;
+
+    private:
+        template <typename OtherElementType, MatrixLayout OtherLayout>
+        friend class SparseMatrix;
+
+        void Validate() const;
+
+        size_t _numRows;
+        size_t _numColumns;
+        std::vector<size_t> _offsets;
+        std::vector<size_t> _indices;
+        std::vector<ElementType> _values;
+    };
+
+    //
+    // friendly names
+    //
+    template <typename ElementType>
+    using CsrMatrix = SparseMatrix<ElementType, MatrixLayout::rowMajor>;
+
+    template <typename ElementType>
+    using CscMatrix = SparseMatrix<ElementType, MatrixLayout::columnMajor>;
+}
+}
+
+#include "../tcc/SparseMatrix.tcc"
@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FastMath.tcc (math)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// stl
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace ell
+{
+namespace math
+{
+    inline double FastMath::Exp(double x)
+    {
+        // exp(x) = 2^k * exp(r), where k = round(x / ln2) and |r| <= ln2 / 2. Adding 1.5 * 2^52 rounds
+        // x / ln2 to an integer that can be read from the low bits of the sum. ln2 is split into a high
+        // part with trailing zeros and a low part, so that k * ln2Hi is exact (Cody-Waite reduction).
+        const double log2e = 1.4426950408889634;
+        const double ln2Hi = 6.93147180369123816490e-01;
+        const double ln2Lo = 1.90821492927058770002e-10;
+        const double shifter = 6755399441055744.0;
+
+        x = std::min(std::max(x, -708.0), 709.0);
+        double shifted = x * log2e + shifter;
+        double k = shifted - shifter;
+        double r = (x - k * ln2Hi) - k * ln2Lo;
+
+        // degree 12 Taylor polynomial, whose truncation error is below 2e-16 on |r| <= ln2 / 2
+        double p = 1.0 / 479001600.0;
+        p = p * r + 1.0 / 39916800.0;
+        p = p * r + 1.0 / 3628800.0;
+        p = p * r + 1.0 / 362880.0;
+        p = p * r + 1.0 / 40320.0;
+        p = p * r + 1.0 / 5040.0;
+        p = p * r + 1.0 / 720.0;
+        p = p * r + 1.0 / 120.0;
+        p = p * r + 1.0 / 24.0;
+        p = p * r + 1.0 / 6.0;
+        p = p * r + 0.5;
+        p = p * r + 1.0;
+        p = p * r + 1.0;
+
+        // 2^k is the double whose biased exponent is k + 1023, which is in [2, 2046] after clamping
+        uint64_t biasedExponent = ToBits(shifted) - ToBits(shifter) + 1023;
+        return p * FromBits(biasedExponent << 52);
+    }
+
+    inline double FastMath::LogOnePlusExp(double x)
+    {
+        // log(1 + exp(x)) = max(x, 0) + log(1 + exp(-|x|)), where both terms are nonnegative
+        double positivePart = std::max(x, 0.0);
+        return positivePart + LogOnePlus(Exp(-std::fabs(x)));
+    }
+
+    inline double FastMath::Logistic(double x)
+    {
+        double expNegativeAbsX = Exp(-std::fabs(x));
+        double numerator = x > 0.0 ? 1.0 : expNegativeAbsX;
+        return numerator / (1.0 + expNegativeAbsX);
+    }
+
+    inline double FastMath::LogOnePlus(double x)
+    {
+        // log(1 + x) for x in [0, 1], using log(y) = 2 * atanh((y - 1) / (y + 1)). For y = 1 + x above
+        // sqrt(2), log(y) = log(2) + log(y / 2). Either way, the argument s of atanh satisfies
+        // |s| <= 0.1716 and is computed from x without cancellation.
+        const double ln2 = 0.69314718055994530942;
+        const double sqrt2MinusOne = 0.41421356237309504880;
+
+        // selecting between constants, rather than between expressions, keeps the code free of branches
+        double isLarge = x > sqrt2MinusOne ? 1.0 : 0.0;
+        double s = (x - isLarge) / (x + 2.0 + isLarge);
+        double s2 = s * s;
+
+        // atanh series up to s^19, whose truncation error is below 3e-17 relative to the result
+        double p = 2.0 / 19.0;
+        p = p * s2 + 2.0 / 17.0;
+        p = p * s2 + 2.0 / 15.0;
+        p = p * s2 + 2.0 / 13.0;
+        p = p * s2 + 2.0 / 11.0;
+        p = p * s2 + 2.0 / 9.0;
+        p = p * s2 + 2.0 / 7.0;
+        p = p * s2 + 2.0 / 5.0;
+        p = p * s2 + 2.0 / 3.0;
+        p = p * s2 + 2.0;
+
+        return isLarge * ln2 + s * p;
+    }
+
+    inline uint64_t FastMath::ToBits(double x)
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+        return bits;
+    }
+
+    inline double FastMath::FromBits(uint64_t bits)
+    {
+        double x;
+        std::memcpy(&x, &bits, sizeof(x));
+        return x;
+    }
+}
+}
@@ -38,6 +38,244 @@ namespace math
         }
     }
 
+    template <typename ElementType, MatrixLayout Layout>
+    void CommonOperations::Multiply(ElementType s, const SparseMatrix<ElementType, Layout>& M, ConstVectorReference<ElementType, VectorOrientation::column> v, ElementType t, VectorReference<ElementType, VectorOrientation::column> u)
+    {
+        if (M.NumRows() != u.Size() || M.NumColumns() != v.Size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Incompatible matrix and vectors sizes.");
+        }
+
+        if (Layout == MatrixLayout::rowMajor)
+        {
+            SparseGather(s, M, v.GetDataPointer(), v.GetIncrement(), t, u.GetDataPointer(), u.GetIncrement());
+        }
+        else
+        {
+            SparseScatter(s, M, v.GetDataPointer(), v.GetIncrement(), t, u.GetDataPointer(), u.Size(), u.GetIncrement());
+        }
+    }
+
+    template <typename ElementType, MatrixLayout Layout>
+    void CommonOperations::Multiply(ElementType s, ConstVectorReference<ElementType, VectorOrientation::row> v, const SparseMatrix<ElementType, Layout>& M, ElementType t, VectorReference<ElementType, VectorOrientation::row> u)
+    {
+        if (M.NumRows() != v.Size() || M.NumColumns() != u.Size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Incompatible matrix and vectors sizes.");
+        }
+
+        // the rows of a CSR matrix are the columns of its transpose, so the roles of the kernels are swapped
+        if (Layout == MatrixLayout::rowMajor)
+        {
+            SparseScatter(s, M, v.GetDataPointer(), v.GetIncrement(), t, u.GetDataPointer(), u.Size(), u.GetIncrement());
+        }
+        else
+        {
+            SparseGather(s, M, v.GetDataPointer(), v.GetIncrement(), t, u.GetDataPointer(), u.GetIncrement());
+        }
+    }
+
+    template <typename ElementType, MatrixLayout LayoutA, MatrixLayout LayoutB, MatrixLayout LayoutC>
+    void CommonOperations::Multiply(ElementType s, const SparseMatrix<ElementType, LayoutA>& A, ConstMatrixReference<ElementType, LayoutB> B, ElementType t, MatrixReference<ElementType, LayoutC> C)
+    {
+        if (A.NumColumns() != B.NumRows() || A.NumRows() != C.NumRows() || B.NumColumns() != C.NumColumns())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Incompatible matrix sizes.");
+        }
+
+        if (t == 0)
+        {
+            C.Fill(0);
+        }
+        else if (t != 1)
+        {
+            for (size_t i = 0; i < C.NumIntervals(); ++i)
+            {
+                C.GetMajorVector(i).Transform([t](ElementType x) { return t * x; });
+            }
+        }
+
+        const auto& offsets = A.GetOffsets();
+        const auto& indices = A.GetIndices();
+        const auto& values = A.GetValues();
+        size_t numColumns = C.NumColumns();
+
+        if (LayoutA == MatrixLayout::rowMajor)
+        {
+            // row i of C accumulates the rows of B selected by the nonzeros of row i of A
+            ParallelFor(offsets, GetNumThreads(A.NumNonzeros() * numColumns), [&](size_t, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    auto rowC = C.GetRow(i);
+                    ElementType* pC = rowC.GetDataPointer();
+                    size_t incrementC = rowC.GetIncrement();
+                    for (size_t k = offsets[i]; k < offsets[i + 1]; ++k)
+                    {
+                        auto rowB = B.GetRow(indices[k]);
+                        const ElementType* pB = rowB.GetDataPointer();
+                        size_t incrementB = rowB.GetIncrement();
+                        ElementType value = s * values[k];
+                        for (size_t j = 0; j < numColumns; ++j)
+                        {
+                            pC[j * incrementC] += value * pB[j * incrementB];
+                        }
+                    }
+                }
+            });
+        }
+        else
+        {
+            // each nonzero of column i of A scatters row i of B into C, so threads split the columns of C instead
+            std::vector<size_t> columnOffsets(numColumns + 1);
+            for (size_t j = 0; j <= numColumns; ++j)
+            {
+                columnOffsets[j] = j;
+            }
+            ParallelFor(columnOffsets, GetNumThreads(A.NumNonzeros() * numColumns), [&](size_t, size_t begin, size_t end) {
+                for (size_t i = 0; i < A.NumIntervals(); ++i)
+                {
+                    auto rowB = B.GetRow(i);
+                    const ElementType* pB = rowB.GetDataPointer();
+                    size_t incrementB = rowB.GetIncrement();
+                    for (size_t k = offsets[i]; k < offsets[i + 1]; ++k)
+                    {
+                        auto rowC = C.GetRow(indices[k]);
+                        ElementType* pC = rowC.GetDataPointer();
+                        size_t incrementC = rowC.GetIncrement();
+                        ElementType value = s * values[k];
+                        for (size_t j = begin; j < end; ++j)
+                        {
+                            pC[j * incrementC] += value * pB[j * incrementB];
+                        }
+                    }
+                }
+            });
+        }
+    }
+
+    inline size_t CommonOperations::GetNumThreads(size_t numOperations)
+    {
+        // below this many multiply-adds per thread, starting a thread costs more than it saves
+        const size_t minOperationsPerThread = 1 << 16;
+        size_t maxThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        return std::max(std::min(numOperations / minOperationsPerThread, maxThreads), size_t{ 1 });
+    }
+
+    template <typename FunctionType>
+    void CommonOperations::ParallelFor(const std::vector<size_t>& offsets, size_t numThreads, FunctionType function)
+    {
+        size_t numIntervals = offsets.size() - 1;
+        if (numThreads <= 1 || numIntervals <= 1)
+        {
+            function(0, 0, numIntervals);
+            return;
+        }
+
+        // split the intervals into ranges whose total sizes, according to the offsets, are roughly equal
+        std::vector<size_t> rangeBegins(1, 0);
+        for (size_t thread = 1; thread < numThreads; ++thread)
+        {
+            size_t target = offsets.front() + (offsets.back() - offsets.front()) * thread / numThreads;
+            size_t begin = static_cast<size_t>(std::lower_bound(offsets.begin(), offsets.end() - 1, target) - offsets.begin());
+            rangeBegins.push_back(std::max(begin, rangeBegins.back()));
+        }
+        rangeBegins.push_back(numIntervals);
+
+        std::vector<std::future<void>> futures;
+        for (size_t thread = 1; thread < numThreads; ++thread)
+        {
+            futures.push_back(std::async(std::launch::async, [&function, &rangeBegins, thread]() { function(thread, rangeBegins[thread], rangeBegins[thread + 1]); }));
+        }
+        function(0, rangeBegins[0], rangeBegins[1]);
+        for (auto& future : futures)
+        {
+            future.get();
+        }
+    }
+
+    template <typename ElementType>
+    void CommonOperations::Scale(ElementType t, ElementType* pU, size_t size, size_t increment)
+    {
+        if (t == 0)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                pU[i * increment] = 0;
+            }
+        }
+        else if (t != 1)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                pU[i * increment] *= t;
+            }
+        }
+    }
+
+    template <typename ElementType, MatrixLayout Layout>
+    void CommonOperations::SparseGather(ElementType s, const SparseMatrix<ElementType, Layout>& M, const ElementType* pV, size_t vIncrement, ElementType t, ElementType* pU, size_t uIncrement)
+    {
+        // u[i] = s * <interval i of M, v> + t * u[i]
+        const auto& offsets = M.GetOffsets();
+        const auto& indices = M.GetIndices();
+        const auto& values = M.GetValues();
+        ParallelFor(offsets, GetNumThreads(M.NumNonzeros()), [&](size_t, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                ElementType sum = 0;
+                for (size_t k = offsets[i]; k < offsets[i + 1]; ++k)
+                {
+                    sum += values[k] * pV[indices[k] * vIncrement];
+                }
+                pU[i * uIncrement] = t == 0 ? s * sum : s * sum + t * pU[i * uIncrement];
+            }
+        });
+    }
+
+    template <typename ElementType, MatrixLayout Layout>
+    void CommonOperations::SparseScatter(ElementType s, const SparseMatrix<ElementType, Layout>& M, const ElementType* pV, size_t vIncrement, ElementType t, ElementType* pU, size_t uSize, size_t uIncrement)
+    {
+        // u = t * u + s * sum_i v[i] * interval i of M
+        Scale(t, pU, uSize, uIncrement);
+
+        const auto& offsets = M.GetOffsets();
+        const auto& indices = M.GetIndices();
+        const auto& values = M.GetValues();
+        auto scatter = [&](size_t begin, size_t end, ElementType* pResult, size_t resultIncrement) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                ElementType value = s * pV[i * vIncrement];
+                for (size_t k = offsets[i]; k < offsets[i + 1]; ++k)
+                {
+                    pResult[indices[k] * resultIncrement] += value * values[k];
+                }
+            }
+        };
+
+        // intervals scatter into overlapping parts of u, so each thread accumulates into its own copy of
+        // u, and the number of threads is limited so that summing the copies costs less than the scatter
+        size_t numThreads = std::min(GetNumThreads(M.NumNonzeros()), std::max(M.NumNonzeros() / std::max(uSize, size_t{ 1 }), size_t{ 1 }));
+        if (numThreads == 1)
+        {
+            scatter(0, M.NumIntervals(), pU, uIncrement);
+            return;
+        }
+
+        std::vector<std::vector<ElementType>> partialResults(numThreads);
+        ParallelFor(offsets, numThreads, [&](size_t thread, size_t begin, size_t end) {
+            partialResults[thread].resize(uSize);
+            scatter(begin, end, partialResults[thread].data(), 1);
+        });
+
+        for (const auto& partialResult : partialResults)
+        {
+            for (size_t j = 0; j < partialResult.size(); ++j)
+            {
+                pU[j * uIncrement] += partialResult[j];
+            }
+        }
+    }
+
     //
     // DerivedOperations
     //
@@ -153,6 +391,11 @@ namespace math
         const ElementType* uData = u.GetDataPointer();
         const ElementType* vData = v.GetDataPointer();
 
+        if (u.GetIncrement() == 1 && v.GetIncrement() == 1)
+        {
+            return UnitStrideDot(uData, vData, u.Size());
+        }
+
         ElementType result = 0;
         const ElementType* end = u.GetDataPointer() + u.GetIncrement() * u.Size();
 
@@ -185,6 +428,19 @@ namespace math
             throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Incompatible matrix and vectors sizes.");
         }
 
+        if (u.GetIncrement() == 1 && v.GetIncrement() == 1)
+        {
+            if (Layout == MatrixLayout::rowMajor)
+            {
+                RowMajorMultiply(s, M.GetDataPointer(), M.NumRows(), M.NumColumns(), M.GetIncrement(), v.GetDataPointer(), t, u.GetDataPointer());
+            }
+            else
+            {
+                ColumnMajorMultiply(s, M.GetDataPointer(), M.NumRows(), M.NumColumns(), M.GetIncrement(), v.GetDataPointer(), t, u.GetDataPointer());
+            }
+            return;
+        }
+
         for (size_t i = 0; i < M.NumRows(); ++i)
         {
             auto row = M.GetRow(i);
@@ -192,6 +448,258 @@ namespace math
         }
     }
 
+    template <typename ElementType>
+    ElementType OperationsImplementation<ImplementationType::native>::UnitStrideDot(const ElementType* pU, const ElementType* pV, size_t size)
+    {
+        // independent partial sums break the dependency between consecutive additions, so that the compiler
+        // can keep them in a vector register
+        const size_t numLanes = 8;
+        ElementType sums[numLanes] = {};
+        size_t i = 0;
+        for (; i + numLanes <= size; i += numLanes)
+        {
+            for (size_t lane = 0; lane < numLanes; ++lane)
+            {
+                sums[lane] += pU[i + lane] * pV[i + lane];
+            }
+        }
+        for (; i < size; ++i)
+        {
+            sums[0] += pU[i] * pV[i];
+        }
+
+        ElementType result = 0;
+        for (size_t lane = 0; lane < numLanes; ++lane)
+        {
+            result += sums[lane];
+        }
+        return result;
+    }
+
+    template <typename ElementType>
+    void OperationsImplementation<ImplementationType::native>::RowMajorMultiply(ElementType s, const ElementType* pM, size_t numRows, size_t numColumns, size_t increment, const ElementType* pV, ElementType t, ElementType* pU)
+    {
+        // like BLAS, ignore the contents of u when t is zero
+        if (t == 0)
+        {
+            for (size_t i = 0; i < numRows; ++i)
+            {
+                pU[i] = 0;
+            }
+        }
+
+        // compute the dot products of four rows at a time, so that each element of v is loaded once for all four
+        const size_t rowBlockSize = 4;
+        const size_t numLanes = 4;
+        size_t i = 0;
+        for (; i + rowBlockSize <= numRows; i += rowBlockSize)
+        {
+            const ElementType* m0 = pM + i * increment;
+            const ElementType* m1 = m0 + increment;
+            const ElementType* m2 = m1 + increment;
+            const ElementType* m3 = m2 + increment;
+            ElementType sums0[numLanes] = {};
+            ElementType sums1[numLanes] = {};
+            ElementType sums2[numLanes] = {};
+            ElementType sums3[numLanes] = {};
+            size_t j = 0;
+            for (; j + numLanes <= numColumns; j += numLanes)
+            {
+                for (size_t lane = 0; lane < numLanes; ++lane)
+                {
+                    const ElementType x = pV[j + lane];
+                    sums0[lane] += m0[j + lane] * x;
+                    sums1[lane] += m1[j + lane] * x;
+                    sums2[lane] += m2[j + lane] * x;
+                    sums3[lane] += m3[j + lane] * x;
+                }
+            }
+            for (; j < numColumns; ++j)
+            {
+                const ElementType x = pV[j];
+                sums0[0] += m0[j] * x;
+                sums1[0] += m1[j] * x;
+                sums2[0] += m2[j] * x;
+                sums3[0] += m3[j] * x;
+            }
+
+            ElementType dot0 = 0;
+            ElementType dot1 = 0;
+            ElementType dot2 = 0;
+            ElementType dot3 = 0;
+            for (size_t lane = 0; lane < numLanes; ++lane)
+            {
+                dot0 += sums0[lane];
+                dot1 += sums1[lane];
+                dot2 += sums2[lane];
+                dot3 += sums3[lane];
+            }
+            pU[i] = s * dot0 + t * pU[i];
+            pU[i + 1] = s * dot1 + t * pU[i + 1];
+            pU[i + 2] = s * dot2 + t * pU[i + 2];
+            pU[i + 3] = s * dot3 + t * pU[i + 3];
+        }
+
+        for (; i < numRows; ++i)
+        {
+            pU[i] = s * UnitStrideDot(pM + i * increment, pV, numColumns) + t * pU[i];
+        }
+    }
+
+    template <typename ElementType>
+    void OperationsImplementation<ImplementationType::native>::ColumnMajorMultiply(ElementType s, const ElementType* pM, size_t numRows, size_t numColumns, size_t increment, const ElementType* pV, ElementType t, ElementType* pU)
+    {
+        // like BLAS, ignore the contents of u when t is zero
+        for (size_t i = 0; i < numRows; ++i)
+        {
+            pU[i] = t == 0 ? 0 : pU[i] * t;
+        }
+
+        // add four scaled columns at a time, so that each element of u is loaded and stored once for all four
+        size_t j = 0;
+        for (; j + 4 <= numColumns; j += 4)
+        {
+            const ElementType* c0 = pM + j * increment;
+            const ElementType* c1 = c0 + increment;
+            const ElementType* c2 = c1 + increment;
+            const ElementType* c3 = c2 + increment;
+            const ElementType a0 = s * pV[j];
+            const ElementType a1 = s * pV[j + 1];
+            const ElementType a2 = s * pV[j + 2];
+            const ElementType a3 = s * pV[j + 3];
+            for (size_t i = 0; i < numRows; ++i)
+            {
+                pU[i] += a0 * c0[i] + a1 * c1[i] + a2 * c2[i] + a3 * c3[i];
+            }
+        }
+
+        for (; j < numColumns; ++j)
+        {
+            const ElementType* c = pM + j * increment;
+            const ElementType a = s * pV[j];
+            for (size_t i = 0; i < numRows; ++i)
+            {
+                pU[i] += a * c[i];
+            }
+        }
+    }
+
+    template <typename ElementType, MatrixLayout LayoutA, MatrixLayout LayoutB, MatrixLayout LayoutC>
+    void OperationsImplementation<ImplementationType::native>::Multiply(ElementType s, ConstMatrixReference<ElementType, LayoutA> A, ConstMatrixReference<ElementType, LayoutB> B, ElementType t, MatrixReference<ElementType, LayoutC> C)
+    {
+        if (A.NumRows() != C.NumRows() || B.NumColumns() != C.NumColumns() || A.NumColumns() != B.NumRows())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Incompatible matrix sizes.");
+        }
+
+        // like BLAS, ignore the contents of C when t is zero
+        if (t == 0)
+        {
+            C.Fill(0);
+        }
+        else if (t != 1)
+        {
+            Multiply(t, C);
+        }
+
+        if (s != 0)
+        {
+            MultiplyBlocked(s, A, B, C);
+        }
+    }
+
+    template <typename ElementType, MatrixLayout LayoutA, MatrixLayout LayoutB>
+    void OperationsImplementation<ImplementationType::native>::MultiplyBlocked(ElementType s, ConstMatrixReference<ElementType, LayoutA> A, ConstMatrixReference<ElementType, LayoutB> B, MatrixReference<ElementType, MatrixLayout::columnMajor> C)
+    {
+        MultiplyBlocked(s, B.Transpose(), A.Transpose(), C.Transpose());
+    }
+
+    template <typename ElementType, MatrixLayout LayoutA, MatrixLayout LayoutB>
+    void OperationsImplementation<ImplementationType::native>::MultiplyBlocked(ElementType s, ConstMatrixReference<ElementType, LayoutA> A, ConstMatrixReference<ElementType, LayoutB> B, MatrixReference<ElementType, MatrixLayout::rowMajor> C)
+    {
+        // a packed block of B (blockSizeK rows by blockSizeN columns) stays in the L2 cache while it is multiplied by every row of A
+        const size_t blockSizeK = 128;
+        const size_t blockSizeN = 128;
+
+        const size_t numRows = C.NumRows();
+        const size_t numColumns = C.NumColumns();
+        const size_t innerSize = A.NumColumns();
+
+        const ElementType* pA = A.GetDataPointer();
+        const size_t aRowIncrement = LayoutA == MatrixLayout::rowMajor ? A.GetIncrement() : 1;
+        const size_t aColumnIncrement = LayoutA == MatrixLayout::rowMajor ? 1 : A.GetIncrement();
+        const ElementType* pB = B.GetDataPointer();
+        const size_t bRowIncrement = LayoutB == MatrixLayout::rowMajor ? B.GetIncrement() : 1;
+        const size_t bColumnIncrement = LayoutB == MatrixLayout::rowMajor ? 1 : B.GetIncrement();
+        ElementType* pC = C.GetDataPointer();
+        const size_t cIncrement = C.GetIncrement();
+
+        std::vector<ElementType> packedB(std::min(innerSize, blockSizeK) * std::min(numColumns, blockSizeN));
+
+        for (size_t firstColumn = 0; firstColumn < numColumns; firstColumn += blockSizeN)
+        {
+            const size_t blockColumns = std::min(blockSizeN, numColumns - firstColumn);
+            for (size_t firstInner = 0; firstInner < innerSize; firstInner += blockSizeK)
+            {
+                const size_t blockInner = std::min(blockSizeK, innerSize - firstInner);
+
+                // pack the block of B into contiguous rows, whatever the layout of B
+                for (size_t k = 0; k < blockInner; ++k)
+                {
+                    const ElementType* bRow = pB + (firstInner + k) * bRowIncrement + firstColumn * bColumnIncrement;
+                    ElementType* packedRow = packedB.data() + k * blockColumns;
+                    for (size_t j = 0; j < blockColumns; ++j)
+                    {
+                        packedRow[j] = bRow[j * bColumnIncrement];
+                    }
+                }
+
+                // update four rows of C at a time, so that each packed row of B is loaded once for all four; the
+                // innermost loops run over contiguous memory and are vectorized by the compiler
+                size_t i = 0;
+                for (; i + 4 <= numRows; i += 4)
+                {
+                    ElementType* c0 = pC + i * cIncrement + firstColumn;
+                    ElementType* c1 = c0 + cIncrement;
+                    ElementType* c2 = c1 + cIncrement;
+                    ElementType* c3 = c2 + cIncrement;
+                    const ElementType* aColumn = pA + i * aRowIncrement + firstInner * aColumnIncrement;
+                    for (size_t k = 0; k < blockInner; ++k)
+                    {
+                        const ElementType* a = aColumn + k * aColumnIncrement;
+                        const ElementType a0 = s * a[0];
+                        const ElementType a1 = s * a[aRowIncrement];
+                        const ElementType a2 = s * a[2 * aRowIncrement];
+                        const ElementType a3 = s * a[3 * aRowIncrement];
+                        const ElementType* b = packedB.data() + k * blockColumns;
+                        for (size_t j = 0; j < blockColumns; ++j)
+                        {
+                            c0[j] += a0 * b[j];
+                            c1[j] += a1 * b[j];
+                            c2[j] += a2 * b[j];
+                            c3[j] += a3 * b[j];
+                        }
+                    }
+                }
+
+                for (; i < numRows; ++i)
+                {
+                    ElementType* c = pC + i * cIncrement + firstColumn;
+                    const ElementType* aColumn = pA + i * aRowIncrement + firstInner * aColumnIncrement;
+                    for (size_t k = 0; k < blockInner; ++k)
+                    {
+                        const ElementType a = s * aColumn[k * aColumnIncrement];
+                        const ElementType* b = packedB.data() + k * blockColumns;
+                        for (size_t j = 0; j < blockColumns; ++j)
+                        {
+                            c[j] += a * b[j];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
 #ifdef USE_BLAS
     //
     // OpenBLAS wrappers
@@ -279,6 +787,29 @@ namespace math
     {
         Multiply(s, M.Transpose(), v.Transpose(), t, u.Transpose());
     }
+
+    template <typename ElementType, MatrixLayout LayoutA, MatrixLayout LayoutB, MatrixLayout LayoutC>
+    void OperationsImplementation<ImplementationType::openBlas>::Multiply(ElementType s, ConstMatrixReference<ElementType, LayoutA> A, ConstMatrixReference<ElementType, LayoutB> B, ElementType t, MatrixReference<ElementType, LayoutC> C)
+    {
+        if (A.NumRows() != C.NumRows() || B.NumColumns() != C.NumColumns() || A.NumColumns() != B.NumRows())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Incompatible matrix sizes.");
+        }
+
+        // BLAS requires a positive inner dimension, and the product is empty otherwise
+        if (A.NumColumns() == 0)
+        {
+            OperationsImplementation<ImplementationType::native>::Multiply(s, A, B, t, C);
+            return;
+        }
+
+        // the order is given by the layout of C, and A or B are transposed if their layout is the opposite
+        CBLAS_ORDER order = LayoutC == MatrixLayout::rowMajor ? CBLAS_ORDER::CblasRowMajor : CBLAS_ORDER::CblasColMajor;
+        CBLAS_TRANSPOSE transposeA = LayoutA == LayoutC ? CBLAS_TRANSPOSE::CblasNoTrans : CBLAS_TRANSPOSE::CblasTrans;
+        CBLAS_TRANSPOSE transposeB = LayoutB == LayoutC ? CBLAS_TRANSPOSE::CblasNoTrans : CBLAS_TRANSPOSE::CblasTrans;
+
+        Blas::Gemm(order, transposeA, transposeB, static_cast<int>(C.NumRows()), static_cast<int>(C.NumColumns()), static_cast<int>(A.NumColumns()), s, A.GetDataPointer(), static_cast<int>(A.GetIncrement()), B.GetDataPointer(), static_cast<int>(B.GetIncrement()), t, C.GetDataPointer(), static_cast<int>(C.GetIncrement()));
+    }
 #endif
 }
 }
\ No newline at end of file
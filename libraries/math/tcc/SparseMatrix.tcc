@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SparseMatrix.tcc (math)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <algorithm>
+#include <utility>
+
+namespace ell
+{
+namespace math
+{
+    template <typename ElementType, MatrixLayout Layout>
+    SparseMatrix<ElementType, Layout>::SparseMatrix(size_t numRows, size_t numColumns)
+        : _numRows(numRows), _numColumns(numColumns), _offsets((Layout == MatrixLayout::rowMajor ? numRows : numColumns) + 1, 0)
+    {
+    }
+
+    template <typename ElementType, MatrixLayout Layout>
+    SparseMatrix<ElementType, Layout>::SparseMatrix(size_t numRows, size_t numColumns, std::vector<size_t> offsets, std::vector<size_t> indices, std::vector<ElementType> values)
+        : _numRows(numRows), _numColumns(numColumns), _offsets(std::move(offsets)), _indices(std::move(indices)), _values(std::move(values))
+    {
+        Validate();
+    }
+
+    template <typename ElementType, MatrixLayout Layout>
+    template <MatrixLayout DenseLayout>
+    SparseMatrix<ElementType, Layout>::SparseMatrix(ConstMatrixReference<ElementType, DenseLayout> M)
+        : SparseMatrix(M.NumRows(), M.NumColumns())
+    {
+        size_t intervalSize = Layout == MatrixLayout::rowMajor ? _numColumns : _numRows;
+        for (size_t i = 0; i < NumIntervals(); ++i)
+        {
+            for (size_t j = 0; j < intervalSize; ++j)
+            {
+                auto value = Layout == MatrixLayout::rowMajor ? M(i, j) : M(j, i);
+                if (value != 0)
+                {
+                    _indices.push_back(j);
+                    _values.push_back(value);
+                }
+            }
+            _offsets[i + 1] = _values.size();
+        }
+    }
+
+    template <typename ElementType, MatrixLayout Layout>
+    template <MatrixLayout OtherLayout>
+    SparseMatrix<ElementType, Layout>::SparseMatrix(const SparseMatrix<ElementType, OtherLayout>& other)
+        : SparseMatrix(other.NumRows(), other.NumColumns())
+    {
+        if (Layout == OtherLayout)
+        {
+            _offsets = other._offsets;
+            _indices = other._indices;
+            _values = other._values;
+            return;
+        }
+
+        // counting sort of the nonzeros by their index in the other matrix, which visits the intervals of
+        // the other matrix in order and therefore keeps the indices of each new interval sorted
+        for (auto index : other._indices)
+        {
+            ++_offsets[index + 1];
+        }
+        for (size_t i = 0; i < NumIntervals(); ++i)
+        {
+            _offsets[i + 1] += _offsets[i];
+        }
+
+        _indices.resize(other.NumNonzeros());
+        _values.resize(other.NumNonzeros());
+        std::vector<size_t> positions(_offsets.begin(), _offsets.end() - 1);
+        for (size_t i = 0; i < other.NumIntervals(); ++i)
+        {
+            for (size_t k = other._offsets[i]; k < other._offsets[i + 1]; ++k)
+            {
+                auto position = positions[other._indices[k]]++;
+                _indices[position] = i;
+                _values[position] = other._values[k];
+            }
+        }
+    }
+
+    template <typename ElementType, MatrixLayout Layout>
+    ElementType SparseMatrix<ElementType, Layout>::operator()(size_t rowIndex, size_t columnIndex) const
+    {
+        if (rowIndex >= _numRows || columnIndex >= _numColumns)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "(rowIndex, columnIndex) exceeds matrix dimensions.");
+        }
+
+        size_t interval = Layout == MatrixLayout::rowMajor ? rowIndex : columnIndex;
+        size_t index = Layout == MatrixLayout::rowMajor ? columnIndex : rowIndex;
+        auto begin = _indices.begin() + _offsets[interval];
+        auto end = _indices.begin() + _offsets[interval + 1];
+        auto iter = std::lower_bound(begin, end, index);
+        if (iter == end || *iter != index)
+        {
+            return 0;
+        }
+        return _values[iter - _indices.begin()];
+    }
+
+    template <typename ElementType, MatrixLayout Layout>
+    auto SparseMatrix<ElementType, Layout>::Transpose() const -> SparseMatrix<ElementType, Layout == MatrixLayout::rowMajor ? MatrixLayout::columnMajor : MatrixLayout::rowMajor>
+    {
+        return { _numColumns, _numRows, _offsets, _indices, _values };
+    }
+
+    template <typename ElementType, MatrixLayout Layout>
+    Matrix<ElementType, Layout> SparseMatrix<ElementType, Layout>::ToMatrix() const
+    {
+        Matrix<ElementType, Layout> M(_numRows, _numColumns);
+        for (size_t i = 0; i < NumIntervals(); ++i)
+        {
+            auto interval = M.GetMajorVector(i);
+            for (size_t k = _offsets[i]; k < _offsets[i + 1]; ++k)
+            {
+                interval[_indices[k]] = _values[k];
+            }
+        }
+        return M;
+    }
+
+    template <typename ElementType, MatrixLayout Layout>
+    bool SparseMatrix<ElementType, Layout>::operator==(const SparseMatrix<ElementType, Layout>& other) const
+    {
+        return _numRows == other._numRows && _numColumns == other._numColumns && _offsets == other._offsets && _indices == other._indices && _values == other._values;
+    }
+
+    template <typename ElementType, MatrixLayout Layout>
+    void SparseMatrix<ElementType, Layout>::Print(std::ostream& os) const
+    {
+        for (size_t i = 0; i < NumIntervals(); ++i)
+        {
+            for (size_t k = _offsets[i]; k < _offsets[i + 1]; ++k)
+            {
+                if (k > _offsets[i])
+                {
+                    os << '\t';
+                }
+                os << _indices[k] << ':' << _values[k];
+            }
+            os << '\n';
+        }
+    }
+
+    template <typename ElementType, MatrixLayout Layout>
+    void SparseMatrix<ElementType, Layout>::Validate() const
+    {
+        size_t numIntervals = Layout == MatrixLayout::rowMajor ? _numRows : _numColumns;
+        size_t intervalSize = Layout == MatrixLayout::rowMajor ? _numColumns : _numRows;
+        if (_offsets.size() != numIntervals + 1 || _offsets.front() != 0 || _offsets.back() != _values.size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "offsets do not match the matrix dimensions and the number of values");
+        }
+        if (_indices.size() != _values.size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "number of indices does not match the number of values");
+        }
+
+        for (size_t i = 0; i < numIntervals; ++i)
+        {
+            if (_offsets[i] > _offsets[i + 1])
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "offsets must be non-decreasing");
+            }
+            for (size_t k = _offsets[i]; k < _offsets[i + 1]; ++k)
+            {
+                if (_indices[k] >= intervalSize || (k > _offsets[i] && _indices[k] <= _indices[k - 1]))
+                {
+                    throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "indices must be strictly increasing within each interval and smaller than the interval size");
+                }
+            }
+        }
+    }
+}
+}
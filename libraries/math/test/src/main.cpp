@@ -6,17 +6,23 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "FastMath.h"
 #include "Matrix.h"
 #include "Operations.h"
 #include "Print.h"
+#include "SparseMatrix.h"
 #include "Vector.h"
 
 // testing
 #include "testing.h"
 
 // stl
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include <random>
+#include <string>
 
 using namespace ell;
 
@@ -318,6 +324,254 @@ void TestMatrixOperations()
     testing::ProcessTest(implementationName + "Operations::Copy(MatrixReference, MatrixReference)", M == R2);
 }
 
+template <typename ElementType, math::MatrixLayout LayoutA, math::MatrixLayout LayoutB, math::ImplementationType Implementation>
+void TestMatrixMatrixMultiply()
+{
+    auto implementationName = math::OperationsImplementation<Implementation>::GetImplementationName();
+    using Ops = math::OperationsImplementation<Implementation>;
+
+    math::Matrix<ElementType, LayoutA> A{
+        { 1, 2 },
+        { 0, 1 },
+        { 3, 0 }
+    };
+
+    math::Matrix<ElementType, LayoutB> B{
+        { 1, 0, 2 },
+        { 1, 1, 0 }
+    };
+
+    math::Matrix<ElementType, LayoutA> C{
+        { 1, 0, 0 },
+        { 0, 1, 0 },
+        { 0, 0, 1 }
+    };
+
+    // C = s * A * B + t * C
+    Ops::Multiply(static_cast<ElementType>(2), A, B, static_cast<ElementType>(3), C);
+    math::Matrix<ElementType, LayoutA> R0{
+        { 9, 4, 4 },
+        { 2, 5, 0 },
+        { 6, 0, 15 }
+    };
+    testing::ProcessTest(implementationName + "Operations::Multiply(Matrix, Matrix)", C == R0);
+
+    // C = A.Transpose * C, into a matrix of the other layout
+    math::Matrix<ElementType, LayoutB> D(2, 3);
+    Ops::Multiply(static_cast<ElementType>(1), A.Transpose(), C, static_cast<ElementType>(0), D);
+    math::Matrix<ElementType, LayoutB> R1{
+        { 27, 4, 49 },
+        { 20, 13, 8 }
+    };
+    testing::ProcessTest(implementationName + "Operations::Multiply(Matrix.Transpose, Matrix)", D == R1);
+
+    // a product that spans several cache blocks and leaves a remainder of rows
+    const size_t numRows = 133;
+    const size_t innerSize = 150;
+    const size_t numColumns = 141;
+    std::default_random_engine engine;
+    std::uniform_int_distribution<int> distribution(-4, 4);
+    math::Matrix<ElementType, LayoutA> E(numRows, innerSize);
+    math::Matrix<ElementType, LayoutB> F(innerSize, numColumns);
+    E.Generate([&]() { return static_cast<ElementType>(distribution(engine)); });
+    F.Generate([&]() { return static_cast<ElementType>(distribution(engine)); });
+
+    math::Matrix<ElementType, LayoutB> G(numRows, numColumns);
+    math::Matrix<ElementType, LayoutB> R2(numRows, numColumns);
+    Ops::Multiply(static_cast<ElementType>(1), E, F, static_cast<ElementType>(0), G);
+    for (size_t i = 0; i < numRows; ++i)
+    {
+        for (size_t j = 0; j < numColumns; ++j)
+        {
+            ElementType sum = 0;
+            for (size_t k = 0; k < innerSize; ++k)
+            {
+                sum += E(i, k) * F(k, j);
+            }
+            R2(i, j) = sum;
+        }
+    }
+    testing::ProcessTest(implementationName + "Operations::Multiply(Matrix, Matrix) with blocks", G == R2);
+}
+
+// The native Dot and matrix-vector products process blocks of elements and rows, these sizes leave remainders
+template <typename ElementType, math::MatrixLayout Layout, math::ImplementationType Implementation>
+void TestMatrixOperationsWithRemainders()
+{
+    auto implementationName = math::OperationsImplementation<Implementation>::GetImplementationName();
+    using Ops = math::OperationsImplementation<Implementation>;
+    std::default_random_engine engine;
+    std::uniform_int_distribution<int> distribution(-4, 4);
+    auto generator = [&]() { return static_cast<ElementType>(distribution(engine)); };
+
+    bool dotOk = true;
+    for (size_t size : { 9, 13, 37 })
+    {
+        math::ColumnVector<ElementType> u(size);
+        math::ColumnVector<ElementType> v(size);
+        u.Generate(generator);
+        v.Generate(generator);
+        ElementType expected = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            expected += u[i] * v[i];
+        }
+        dotOk = dotOk && Ops::Dot(u, v) == expected;
+    }
+    testing::ProcessTest(implementationName + "Operations::Dot(Vector, Vector) with remainders", dotOk);
+
+    // a submatrix, so that the increment differs from the number of columns or rows
+    const size_t numRows = 11;
+    const size_t numColumns = 13;
+    math::Matrix<ElementType, Layout> N(numRows + 3, numColumns + 5);
+    N.Generate(generator);
+    auto M = N.GetSubMatrix(1, 2, numRows, numColumns);
+
+    for (bool transpose : { false, true })
+    {
+        auto numOutputs = transpose ? numColumns : numRows;
+        auto numInputs = transpose ? numRows : numColumns;
+        math::ColumnVector<ElementType> v(numInputs);
+        math::ColumnVector<ElementType> u(numOutputs);
+        v.Generate(generator);
+        u.Generate(generator);
+
+        math::ColumnVector<ElementType> r(numOutputs);
+        math::ColumnVector<ElementType> z(numOutputs);
+        for (size_t i = 0; i < numOutputs; ++i)
+        {
+            ElementType sum = 0;
+            for (size_t j = 0; j < numInputs; ++j)
+            {
+                sum += (transpose ? M(j, i) : M(i, j)) * v[j];
+            }
+            r[i] = 2 * sum + 3 * u[i];
+            z[i] = 2 * sum;
+        }
+
+        // like BLAS, a zero t ignores the contents of w, even NaNs
+        math::ColumnVector<ElementType> w(numOutputs);
+        w.Fill(std::numeric_limits<ElementType>::quiet_NaN());
+
+        if (transpose)
+        {
+            Ops::Multiply(static_cast<ElementType>(2), M.Transpose(), v, static_cast<ElementType>(3), u);
+            Ops::Multiply(static_cast<ElementType>(2), M.Transpose(), v, static_cast<ElementType>(0), w);
+        }
+        else
+        {
+            Ops::Multiply(static_cast<ElementType>(2), M, v, static_cast<ElementType>(3), u);
+            Ops::Multiply(static_cast<ElementType>(2), M, v, static_cast<ElementType>(0), w);
+        }
+        std::string matrixName = transpose ? "MatrixReference.Transpose" : "MatrixReference";
+        testing::ProcessTest(implementationName + "Operations::Multiply(" + matrixName + ", Vector) with remainders", u == r);
+        testing::ProcessTest(implementationName + "Operations::Multiply(" + matrixName + ", Vector) with zero t and NaN output", w == z);
+    }
+}
+
+template <typename ElementType, math::MatrixLayout Layout>
+void TestSparseMatrix()
+{
+    math::Matrix<ElementType, Layout> M{
+        { 1, 0, 2, 0 },
+        { 0, 0, 0, 0 },
+        { 0, 3, 0, 4 }
+    };
+
+    math::SparseMatrix<ElementType, Layout> S(M);
+    testing::ProcessTest("SparseMatrix::NumNonzeros", S.NumNonzeros() == 4 && S.NumRows() == 3 && S.NumColumns() == 4);
+    testing::ProcessTest("SparseMatrix::operator()", S(0, 2) == 2 && S(2, 3) == 4 && S(1, 1) == 0 && S(2, 0) == 0);
+    testing::ProcessTest("SparseMatrix::ToMatrix", S.ToMatrix() == M);
+
+    math::SparseMatrix<ElementType, math::MatrixLayout::rowMajor> R(S);
+    math::SparseMatrix<ElementType, math::MatrixLayout::columnMajor> C(S);
+    testing::ProcessTest("SparseMatrix::SparseMatrix(SparseMatrix)", R.ToMatrix() == M && C.ToMatrix() == M);
+
+    auto T = S.Transpose();
+    testing::ProcessTest("SparseMatrix::Transpose", T.NumRows() == 4 && T.NumColumns() == 3 && T(3, 2) == 4 && T(2, 0) == 2);
+
+    math::SparseMatrix<ElementType, math::MatrixLayout::rowMajor> U(3, 4, { 0, 2, 2, 4 }, { 0, 2, 1, 3 }, { 1, 2, 3, 4 });
+    testing::ProcessTest("SparseMatrix::SparseMatrix(offsets, indices, values)", U == R);
+
+    bool caughtException = false;
+    try
+    {
+        math::SparseMatrix<ElementType, math::MatrixLayout::rowMajor> V(3, 4, { 0, 2, 2, 4 }, { 2, 0, 1, 3 }, { 1, 2, 3, 4 });
+    }
+    catch (const utilities::InputException&)
+    {
+        caughtException = true;
+    }
+    testing::ProcessTest("SparseMatrix::SparseMatrix(offsets, indices, values) with unsorted indices", caughtException);
+}
+
+template <typename ElementType, math::MatrixLayout LayoutA, math::MatrixLayout LayoutB>
+void TestSparseMatrixOperations(size_t numRows, size_t numColumns, double density)
+{
+    using Ops = math::OperationsImplementation<math::ImplementationType::native>;
+
+    // a random matrix with small integer entries, so that all of the products are exact
+    std::default_random_engine engine;
+    std::uniform_int_distribution<int> distribution(-4, 4);
+    std::bernoulli_distribution isNonzero(density);
+    math::Matrix<ElementType, LayoutA> M(numRows, numColumns);
+    M.Generate([&]() { return isNonzero(engine) ? static_cast<ElementType>(distribution(engine)) : 0; });
+    math::SparseMatrix<ElementType, LayoutA> S(M);
+    auto name = "SparseMatrix(" + std::to_string(numRows) + "x" + std::to_string(numColumns) + ")";
+
+    // u = s * M * v + t * u
+    math::ColumnVector<ElementType> v(numColumns);
+    v.Generate([&]() { return static_cast<ElementType>(distribution(engine)); });
+    math::ColumnVector<ElementType> u(numRows);
+    u.Generate([&]() { return static_cast<ElementType>(distribution(engine)); });
+    auto r0 = u;
+    Ops::Multiply(static_cast<ElementType>(2), S, v, static_cast<ElementType>(3), u);
+    Ops::Multiply(static_cast<ElementType>(2), M, v, static_cast<ElementType>(3), r0);
+    testing::ProcessTest("Operations::Multiply(" + name + ", Vector)", u == r0);
+
+    // w = s * x * M + t * w
+    math::RowVector<ElementType> x(numRows);
+    x.Generate([&]() { return static_cast<ElementType>(distribution(engine)); });
+    math::RowVector<ElementType> w(numColumns);
+    w.Generate([&]() { return static_cast<ElementType>(distribution(engine)); });
+    auto r1 = w;
+    Ops::Multiply(static_cast<ElementType>(2), x, S, static_cast<ElementType>(-1), w);
+    Ops::Multiply(static_cast<ElementType>(2), x, M, static_cast<ElementType>(-1), r1);
+    testing::ProcessTest("Operations::Multiply(Vector, " + name + ")", w == r1);
+
+    // C = s * M * B + t * C
+    const size_t numResultColumns = 5;
+    math::Matrix<ElementType, LayoutB> B(numColumns, numResultColumns);
+    B.Generate([&]() { return static_cast<ElementType>(distribution(engine)); });
+    math::Matrix<ElementType, LayoutB> C(numRows, numResultColumns);
+    C.Generate([&]() { return static_cast<ElementType>(distribution(engine)); });
+    auto R2 = C;
+    Ops::Multiply(static_cast<ElementType>(1), S, B, static_cast<ElementType>(2), C);
+    Ops::Multiply(static_cast<ElementType>(1), M, B, static_cast<ElementType>(2), R2);
+    testing::ProcessTest("Operations::Multiply(" + name + ", Matrix)", C == R2);
+}
+
+void TestFastMath()
+{
+    double maxExpError = 0;
+    double maxLogOnePlusExpError = 0;
+    double maxLogisticError = 0;
+    for (double x = -700.0; x <= 700.0; x += 0.0137)
+    {
+        maxExpError = std::max(maxExpError, std::abs(math::FastMath::Exp(x) / std::exp(x) - 1));
+        maxLogOnePlusExpError = std::max(maxLogOnePlusExpError, std::abs(math::FastMath::LogOnePlusExp(x) / (std::max(x, 0.0) + std::log1p(std::exp(-std::abs(x)))) - 1));
+        maxLogisticError = std::max(maxLogisticError, std::abs(math::FastMath::Logistic(x) * (1 + std::exp(-x)) - 1));
+    }
+
+    // the reference values are themselves rounded, so the tolerance is a few times the documented error bound
+    testing::ProcessTest("FastMath::Exp", maxExpError < 4e-15);
+    testing::ProcessTest("FastMath::LogOnePlusExp", maxLogOnePlusExpError < 4e-15);
+    testing::ProcessTest("FastMath::Logistic", maxLogisticError < 4e-15);
+
+    bool isClamped = std::isfinite(math::FastMath::Exp(1000)) && math::FastMath::Exp(-1000) > 0 && math::FastMath::LogOnePlusExp(1000) == 1000 && math::FastMath::Logistic(1000) == 1 && math::FastMath::Logistic(-1000) < 1e-300;
+    testing::ProcessTest("FastMath clamping", isClamped);
+}
+
 /// Runs all tests
 ///
 int main()
@@ -352,6 +606,31 @@ int main()
     TestMatrixOperations<double, math::MatrixLayout::rowMajor, math::ImplementationType::openBlas>();
     TestMatrixOperations<double, math::MatrixLayout::columnMajor, math::ImplementationType::openBlas>();
 
+    TestMatrixMatrixMultiply<float, math::MatrixLayout::rowMajor, math::MatrixLayout::rowMajor, math::ImplementationType::native>();
+    TestMatrixMatrixMultiply<float, math::MatrixLayout::rowMajor, math::MatrixLayout::columnMajor, math::ImplementationType::native>();
+    TestMatrixMatrixMultiply<double, math::MatrixLayout::columnMajor, math::MatrixLayout::rowMajor, math::ImplementationType::native>();
+    TestMatrixMatrixMultiply<double, math::MatrixLayout::columnMajor, math::MatrixLayout::columnMajor, math::ImplementationType::native>();
+    TestMatrixMatrixMultiply<float, math::MatrixLayout::rowMajor, math::MatrixLayout::rowMajor, math::ImplementationType::openBlas>();
+    TestMatrixMatrixMultiply<float, math::MatrixLayout::rowMajor, math::MatrixLayout::columnMajor, math::ImplementationType::openBlas>();
+    TestMatrixMatrixMultiply<double, math::MatrixLayout::columnMajor, math::MatrixLayout::rowMajor, math::ImplementationType::openBlas>();
+    TestMatrixMatrixMultiply<double, math::MatrixLayout::columnMajor, math::MatrixLayout::columnMajor, math::ImplementationType::openBlas>();
+
+    TestMatrixOperationsWithRemainders<float, math::MatrixLayout::rowMajor, math::ImplementationType::native>();
+    TestMatrixOperationsWithRemainders<float, math::MatrixLayout::columnMajor, math::ImplementationType::native>();
+    TestMatrixOperationsWithRemainders<double, math::MatrixLayout::rowMajor, math::ImplementationType::native>();
+    TestMatrixOperationsWithRemainders<double, math::MatrixLayout::columnMajor, math::ImplementationType::native>();
+
+    TestSparseMatrix<float, math::MatrixLayout::rowMajor>();
+    TestSparseMatrix<double, math::MatrixLayout::columnMajor>();
+
+    // the large matrices are processed by several threads
+    TestSparseMatrixOperations<double, math::MatrixLayout::rowMajor, math::MatrixLayout::rowMajor>(7, 9, 0.4);
+    TestSparseMatrixOperations<double, math::MatrixLayout::columnMajor, math::MatrixLayout::columnMajor>(7, 9, 0.4);
+    TestSparseMatrixOperations<double, math::MatrixLayout::rowMajor, math::MatrixLayout::columnMajor>(1000, 800, 0.3);
+    TestSparseMatrixOperations<double, math::MatrixLayout::columnMajor, math::MatrixLayout::rowMajor>(1000, 800, 0.3);
+
+    TestFastMath();
+
     if (testing::DidTestFail())
     {
         return 1;
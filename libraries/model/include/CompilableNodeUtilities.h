@@ -26,6 +26,10 @@ namespace model
     /// <summary>True if port has dimension greater than 1, and references exactly one output port</summary>
     bool IsPureVector(const model::InputPortBase& port);
 
+    /// <summary>True if port has dimension greater than 1, and either references exactly one output port or is large
+    /// enough that a loop over a gathered copy of its values (see IRMapCompiler::EnsureContiguousInput) beats fully unrolled code</summary>
+    bool IsLoopableVector(const model::InputPortBase& port);
+
     /// <summary>Does this node have a single descendant?</summary>
     bool HasSingleDescendant(const model::Node& node);
 
@@ -71,17 +71,35 @@ namespace model
         template <typename OutputVectorType, typename InputVectorType, data::IsDataVector<OutputVectorType> OutputConcept = true, data::IsDataVector<InputVectorType> InputConcept = true>
         OutputVectorType Compute(const InputVectorType& inputValues) const;
 
+        /// <summary> Makes a copy of this map with its own copy of the model. Computing outputs changes the state
+        /// of a map's nodes, so maps that compute concurrently must not share them. </summary>
+        ///
+        /// <returns> The copy of the map </returns>
+        DynamicMap Clone() const;
+
+        /// <summary> Indicates if the map's outputs depend on the inputs it computed before, because some node of its model has state. </summary>
+        ///
+        /// <returns> true if the map has state. </returns>
+        bool HasState() const;
+
         /// <summary> Returns the size of the map's output </summary>
         ///
         /// <returns> The dimensionality of the map's output port </returns>
         size_t GetOutputSize() const;
 
-        /// <summary> Refines the model wrapped by this map. </summary>
+        /// <summary> Refines the model wrapped by this map, and then prunes away the nodes that the map's outputs don't depend on. </summary>
         ///
         /// <param name="context"> The TransformContext to use during refinement. </param>
         /// <param name="maxIterations"> The maximum number of refinement iterations. </param>
         void Refine(const TransformContext& context, int maxIterations = 10);
 
+        /// <summary> Optimizes the model wrapped by this map by folding constant subgraphs and simplifying operations, and then
+        /// prunes away the nodes that the map's outputs no longer depend on. </summary>
+        ///
+        /// <param name="context"> The TransformContext to use during optimization. </param>
+        /// <param name="maxIterations"> The maximum number of optimization passes. </param>
+        void Optimize(const TransformContext& context, int maxIterations = 10);
+
         /// <summary> Transforms the model wrapped by this map by applying a transformation function to each node </summary>
         ///
         /// <param name="transformFunction"> The function to apply on each node </param>
@@ -242,7 +260,7 @@ namespace model
         void AddInput(const std::string& inputName, InputNodeBase* inputNode);
         void AddOutput(const std::string& outputName, PortElementsBase outputElements);
         void ResetOutput(size_t index, PortElementsBase outputElements);
-        void Prune(); // prune away unused parts of internal model
+        void Prune(); // prune away parts of internal model that the outputs don't depend on
 
         virtual void WriteToArchive(utilities::Archiver& archiver) const override;
         virtual void ReadFromArchive(utilities::Unarchiver& archiver) override;
@@ -19,6 +19,7 @@
 #include "DynamicMap.h"
 #include "InputNode.h"
 #include "Model.h"
+#include "ModelProfile.h"
 #include "Node.h"
 #include "OutputPort.h"
 #include "PortElements.h"
@@ -28,7 +29,7 @@
 #include "TypeName.h"
 
 // stl
-#include <functional>
+#include <cstdint>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -38,7 +39,9 @@ namespace ell
 {
 namespace model
 {
-    /// <summary> A map that can be compiled </summary>
+    /// <summary> A map that can be compiled. The map may have any number of inputs and outputs. Setting an input only
+    /// copies its values; the compiled function runs the first time an output is requested after the inputs change, and
+    /// computes all of the outputs at once, so nodes shared by several outputs are evaluated only once. </summary>
     class IRCompiledMap : public CompiledMap
     {
     public:
@@ -47,7 +50,9 @@ namespace model
         /// <param name="map"> The input map to compile </param>
         /// <param name="functionName"> The name of the function to compile the map to </param>
         /// <param name="optimize"> Flag indicating if the output should be optimized </param>
-        IRCompiledMap(const model::DynamicMap& other, const std::string& functionName = "predict", bool optimize = true);
+        /// <param name="profile"> Flag indicating if the compiled code should count the calls to and cycles spent in each node </param>
+        /// <param name="relaxedPrecision"> Flag indicating if the map may be optimized in ways that change floating-point results </param>
+        IRCompiledMap(const model::DynamicMap& other, const std::string& functionName = "predict", bool optimize = true, bool profile = false, bool relaxedPrecision = false);
 
         /// <summary> Move Constructor. </summary>
         ///
@@ -117,6 +122,24 @@ namespace model
         /// <returns> true if active, false if not. </returns>
         virtual bool IsValid() const override;
 
+        /// <summary> Is the compiled code instrumented for profiling? </summary>
+        ///
+        /// <returns> true if the map was compiled with profiling. </returns>
+        bool IsProfiling() const { return _profile; }
+
+        /// <summary> Reads the profile table of a map compiled with profiling. Times are in processor cycles. </summary>
+        ///
+        /// <returns> The per-node-type profile. </returns>
+        ModelProfile GetProfile() const;
+
+        /// <summary> Zeroes the profile table of a map compiled with profiling. </summary>
+        void ResetProfile();
+
+        /// <summary> Gets the nodes that own the entries of the profile table, in order. </summary>
+        ///
+        /// <returns> The profiled nodes. </returns>
+        const std::vector<const model::Node*>& GetProfiledNodes() const { return _profiledNodes; }
+
     protected:
         virtual void Compile() override;
 
@@ -128,32 +151,44 @@ namespace model
         virtual std::vector<int> ComputeIntOutput(const model::PortElementsBase& outputs) const override;
         virtual std::vector<double> ComputeDoubleOutput(const model::PortElementsBase& outputs) const override;
 
-        template <typename InputType, typename OutputType>
-        void SetComputeFunction();
-
         virtual void WriteToArchive(utilities::Archiver& archiver) const override;
         virtual void ReadFromArchive(utilities::Unarchiver& archiver) override;
 
     private:
-        template <typename InputType>
-        using ComputeFunction = std::function<void(const InputType*)>;
+        // Storage for the values of one map input or output, passed to the compiled function by address.
+        // Boolean ports use intValues, since the compiled code stores bools as ints.
+        struct PortBuffer
+        {
+            model::Port::PortType type;
+            std::vector<int> intValues;
+            std::vector<double> doubleValues;
+
+            void Resize(model::Port::PortType portType, size_t size);
+            int64_t GetAddress();
+        };
+
+        using PackedArgumentsFunction = void (*)(int64_t*);
 
         std::string _moduleName = "ELL";
+        bool _profile = false;
+        bool _relaxedPrecision = false;
+        std::vector<const model::Node*> _profiledNodes;
 
         std::unique_ptr<emitters::IRModuleEmitter> _module;
         std::unique_ptr<emitters::IRExecutionEngine> _executionEngine;
 
-        // Only one of the entries in the tuple is active, depending on the input and output types of the map
-        std::tuple<ComputeFunction<bool>, ComputeFunction<int>, ComputeFunction<double>> _computeInputFunction;
-        std::tuple<utilities::ConformingVector<bool>, utilities::ConformingVector<int>, utilities::ConformingVector<double>> _cachedOutput;
+        // One buffer per map input, followed by one per map output, in the order of the compiled function's arguments
+        mutable std::vector<PortBuffer> _buffers;
+        mutable std::vector<int64_t> _argumentAddresses;
+        PackedArgumentsFunction _computeFunction = nullptr;
+        mutable bool _outputsValid = false;
 
         void EnsureValidMap(); // fixes up model if necessary and checks inputs/outputs are compilable
         void SetComputeFunction();
 
-        template <typename InputType>
-        void SetComputeFunctionForInputType();
+        size_t GetInputIndex(const model::InputNodeBase* node) const;
+        const PortBuffer& ComputeOutputBuffer(const model::PortElementsBase& outputs, model::Port::PortType type) const;
+        int64_t* GetProfileTable(const std::string& name) const;
     };
 }
 }
-
-#include "../tcc/IRCompiledMap.tcc"
@@ -25,6 +25,7 @@
 
 // stl
 #include <string>
+#include <vector>
 
 namespace ell
 {
@@ -54,6 +55,16 @@ namespace model
         /// <summary> Ensure that variable for the outport port referenced by this input port has been declared in IR </summary>
         llvm::Value* EnsureEmitted(model::InputPortBase* pPort);
 
+        /// <summary> Get a pointer to a contiguous array holding the values of an input port. If the port references
+        /// the start of a single output port, this is the variable for that port. Otherwise, the values of each range
+        /// are gathered into a new array, with one copy loop per range (ranges of a single element are copied directly).
+        /// The array is on the stack for small ports and a module-level global for large ones. This lets nodes emit a loop
+        /// over ports that concatenate several outputs. </summary>
+        ///
+        /// <param name="pPort"> The input port. </param>
+        /// <returns> Pointer to the first element of the contiguous values. </returns>
+        llvm::Value* EnsureContiguousInput(model::InputPortBase* pPort);
+
         /// <summary> Ensure that the variable for this outport port element is loaded into a register. SThis will automatically
         /// dereference any pointers it needs to. </summary>
         llvm::Value* LoadVariable(const model::PortElementBase& element);
@@ -89,7 +100,42 @@ namespace model
         /// <returns> The `IRBlockRegion` that computes `element` if that block is mergeable, `nullptr` otherwise. </returns>
         emitters::IRBlockRegion* GetMergeableRegion(const model::PortElementBase& element);
 
+        //
+        // Profiling
+        //
+
+        /// <summary>
+        /// Returns the nodes whose code was instrumented when compiling with the `profile` compiler parameter, in the
+        /// order of their entries in the profile table. Nodes that don't emit a block region of their own aren't instrumented.
+        /// </summary>
+        ///
+        /// <returns> The instrumented nodes. </returns>
+        const std::vector<const model::Node*>& GetProfiledNodes() const { return _profiledNodes; }
+
+        /// <summary> Returns the name of the global int64 array that counts the calls to each instrumented node </summary>
+        ///
+        /// <param name="functionName"> The name of the compiled function </param>
+        /// <returns> The name of the global array </returns>
+        static std::string GetProfileCallCountsName(const std::string& functionName) { return functionName + "_profileCallCounts"; }
+
+        /// <summary> Returns the name of the global int64 array that accumulates the cycles spent in each instrumented node </summary>
+        ///
+        /// <param name="functionName"> The name of the compiled function </param>
+        /// <returns> The name of the global array </returns>
+        static std::string GetProfileCyclesName(const std::string& functionName) { return functionName + "_profileCycles"; }
+
+        /// <summary> Returns the name of the exported function that calls the compiled function with arguments packed into
+        /// a single array: `void <functionName>_packedArgs(int64_t* args)`, where each array entry holds the address of the
+        /// corresponding argument of the compiled function. Hosts that don't know the number and types of the arguments
+        /// at their own compile time, such as IRCompiledMap, call this function instead of the compiled function. </summary>
+        ///
+        /// <param name="functionName"> The name of the compiled function </param>
+        /// <returns> The name of the packed-argument function </returns>
+        static std::string GetPackedArgumentsFunctionName(const std::string& functionName) { return functionName + "_packedArgs"; }
+
     protected:
+        virtual void OnBeginCompileModel(const model::Model& model, const std::string& functionName) override;
+        virtual void OnEndCompileModel(const model::Model& model, const std::string& functionName) override;
         virtual void OnBeginCompileNode(const model::Node& node) override;
         virtual void OnEndCompileNode(const model::Node& node) override;
 
@@ -98,7 +144,17 @@ namespace model
 
         bool TryMergeNodeIntoRegion(emitters::IRBlockRegion* pDestination, const model::Node& src);
 
+        void BeginProfilingNode(const model::Node& node);
+        void EndProfilingNode(const model::Node& node);
+
         NodeMap<emitters::IRBlockRegion*> _nodeBlocks;
+
+        // profile table, emitted only if the `profile` compiler parameter is set
+        std::vector<const model::Node*> _profiledNodes;
+        const model::Node* _pProfiledNode = nullptr;
+        llvm::GlobalVariable* _pProfileCallCounts = nullptr;
+        llvm::GlobalVariable* _pProfileCycles = nullptr;
+        llvm::Value* _pProfileStartCycles = nullptr;
     };
 }
 }
@@ -23,6 +23,7 @@
 // stl
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace ell
 {
@@ -34,7 +35,9 @@ namespace model
     public:
         virtual ~MapCompiler() = default;
 
-        /// <summary> Compile the map into a function with the given name </summary>
+        /// <summary> Compile the map into a function with the given name. The function takes one pointer
+        /// argument per map input, followed by one per map output, and computes every node once per call,
+        /// even if it contributes to several outputs. </summary>
         ///
         /// <param name="map"> The map to compile </param>
         /// <param name="functionName"> The name of the function to create </param>
@@ -77,6 +80,9 @@ namespace model
         /// <summary> Associate the given variable with the output port </summary>
         void SetVariableFor(const OutputPortBase* pPort, emitters::Variable* pVar);
 
+        /// <summary> Indicates if the values of an output port are used, either by another node or as an output of the map being compiled </summary>
+        bool IsPortUsed(const OutputPortBase* pPort) const;
+
     protected:
         /// <summary>
         /// Create a variable to store computed output for the given output port. The variable
@@ -85,9 +91,14 @@ namespace model
         emitters::Variable* AllocatePortVariable(OutputPortBase* pPort);
         emitters::Variable* GetOrAllocatePortVariable(OutputPortBase* pPort);
 
+        /// <summary> Gets the arguments of the function being compiled: one pointer per map input, followed by one per map output. </summary>
+        const emitters::NamedVariableTypeList& GetArgs() const { return _arguments; }
+
         //
         // These methods may be implemented by specific compilers
         //
+        virtual void OnBeginCompileModel(const Model& model, const std::string& functionName) {}
+        virtual void OnEndCompileModel(const Model& model, const std::string& functionName) {}
         virtual void OnBeginCompileNode(const Node& node) {}
         virtual void OnEndCompileNode(const Node& node) {}
 
@@ -99,7 +110,6 @@ namespace model
         };
 
         void CompileNodes(Model& model);
-        const emitters::NamedVariableTypeList& GetArgs() const { return _arguments; }
         const emitters::NamedVariableTypeList& GetInputArgs() const { return _inputArgs; }
 
         emitters::Variable* AllocArg(emitters::ModuleEmitter& emitter, const OutputPortBase* pPort, ArgType argType);
@@ -109,6 +119,7 @@ namespace model
 
         emitters::NamedVariableTypeList _arguments; // function arguments
         emitters::NamedVariableTypeList _inputArgs; // Track inputs separately
+        std::unordered_set<const OutputPortBase*> _outputPorts; // The ports that are outputs of the map
 
         // A map from output ports to runtime variables
         std::unordered_map<const OutputPortBase*, emitters::Variable*> _portToVarMap;
@@ -29,6 +29,7 @@ namespace ell
 namespace model
 {
     class Model;
+    class ModelProfile;
 
     /// <summary> An iterator over the nodes in a Model </summary>
     class NodeIterator : public utilities::IIterator<const Node*>
@@ -105,6 +106,17 @@ namespace model
         template <typename NodeType>
         std::vector<NodeType*> GetNodesByType();
 
+        /// <summary> Sets a profile that accumulates the time spent in each node's Compute function when computing outputs.
+        /// The profile isn't carried over to copies of the model made by a `ModelTransformer`. </summary>
+        ///
+        /// <param name="profile"> The profile to add timings to, or nullptr to turn profiling off. The profile isn't owned by the model. </param>
+        void SetProfile(ModelProfile* profile) { _profile = profile; }
+
+        /// <summary> Gets the profile set by `SetProfile` </summary>
+        ///
+        /// <returns> The profile, or nullptr if profiling is off. </returns>
+        ModelProfile* GetProfile() const { return _profile; }
+
         /// <summary> Returns part of the output computed by the model </summary>
         ///
         /// <param name="outputPort"> The output port to get the computed value form </param>
@@ -199,10 +211,14 @@ namespace model
     private:
         friend class NodeIterator;
 
+        void ComputeNode(const Node& node) const;
+
         // The id->node map acts both as the main container that holds the shared pointers to nodes, and as the index
         // to look nodes up by id.
         // We keep it sorted by id to make visiting all nodes deterministically ordered
         std::map<Node::NodeId, std::shared_ptr<Node>, std::less<Node::NodeId>> _idToNodeMap;
+
+        ModelProfile* _profile = nullptr;
     };
 
     /// <summary> A serialization context used during model deserialization. Wraps an existing `SerializationContext`
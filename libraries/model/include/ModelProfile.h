@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ModelProfile.h (model)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Node.h"
+
+// stl
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace model
+{
+    /// <summary> Performance counters accumulated over all the nodes of one type </summary>
+    struct NodePerformanceCounters
+    {
+        /// <summary> The runtime type name of the nodes. </summary>
+        std::string nodeType;
+
+        /// <summary> The total number of times a node of this type was computed. </summary>
+        size_t callCount = 0;
+
+        /// <summary> The total time spent computing nodes of this type, in the units of the profile. </summary>
+        double totalTime = 0;
+
+        /// <summary> The total number of bytes read from input ports and written to output ports. </summary>
+        size_t bytesTouched = 0;
+    };
+
+    /// <summary> Collects per-node timings of a model, either measured by the interpreter (see `Model::SetProfile`)
+    /// or read back from the profile table of a map compiled with profiling enabled, and reports them by node type. </summary>
+    class ModelProfile
+    {
+    public:
+        /// <summary> Constructor </summary>
+        ///
+        /// <param name="timeUnits"> The name of the units that times are reported in. </param>
+        ModelProfile(const std::string& timeUnits = "ms");
+
+        /// <summary> Adds the timing of one or more calls to a node's compute function. </summary>
+        ///
+        /// <param name="node"> The node that was computed. </param>
+        /// <param name="callCount"> The number of calls. </param>
+        /// <param name="totalTime"> The total time spent in those calls. </param>
+        void AddNodeSamples(const Node& node, size_t callCount, double totalTime);
+
+        /// <summary> Gets the counters accumulated for each node type, in decreasing order of total time. </summary>
+        ///
+        /// <returns> The per-node-type counters. </returns>
+        std::vector<NodePerformanceCounters> GetNodeTypeCounters() const;
+
+        /// <summary> Gets the name of the units that times are reported in. </summary>
+        ///
+        /// <returns> The name of the time units. </returns>
+        const std::string& GetTimeUnits() const { return _timeUnits; }
+
+        /// <summary> Clears all the counters. </summary>
+        void Reset();
+
+        /// <summary> Prints a table of the per-node-type counters. </summary>
+        ///
+        /// <param name="os"> The stream to write to. </param>
+        void Print(std::ostream& os) const;
+
+        /// <summary> Gets the number of bytes a single call to a node's compute function reads from its input ports and writes to its output ports. </summary>
+        ///
+        /// <param name="node"> The node. </param>
+        ///
+        /// <returns> The number of bytes. </returns>
+        static size_t GetBytesTouchedPerCall(const Node& node);
+
+    private:
+        std::string _timeUnits;
+        std::map<std::string, NodePerformanceCounters> _nodeTypeCounters;
+    };
+}
+}
@@ -80,8 +80,19 @@ namespace model
         /// <returns> A `NodeAction` enum indicating what action to take on the node </returns>
         NodeAction GetNodeAction(const Node& node) const;
 
+        /// <summary> Indicates if optimizations may change floating-point results, for instance by reassociating operations. </summary>
+        ///
+        /// <returns> Returns true if relaxed precision is allowed. </returns>
+        bool IsRelaxedPrecisionAllowed() const { return _allowRelaxedPrecision; }
+
+        /// <summary> Allows or disallows optimizations that change floating-point results. They are disallowed by default. </summary>
+        ///
+        /// <param name="allow"> true to allow relaxed precision. </param>
+        void SetRelaxedPrecisionAllowed(bool allow) { _allowRelaxedPrecision = allow; }
+
     private:
         std::vector<NodeActionFunction> _nodeActionFunctions;
+        bool _allowRelaxedPrecision = false;
     };
 
     /// <summary> A class that refines or copies models </summary>
@@ -136,6 +147,19 @@ namespace model
         /// <returns> The refined Model. </returns>
         Model RefineModel(const Model& model, const TransformContext& context, int maxIterations = 10);
 
+        /// <summary>
+        /// Optimizes a given model by calling Optimize() on each of its nodes, which folds constant subgraphs and simplifies
+        /// operations, and returns the result. Passes are repeated until no node changes or the maximum number of iterations
+        /// is reached. Nodes that become unused are left in the model.
+        /// </summary>
+        ///
+        /// <param name="model"> The model. </param>
+        /// <param name="context"> The context. </param>
+        /// <param name="maxIterations"> The maximum number of optimization passes. </param>
+        ///
+        /// <returns> The optimized Model. </returns>
+        Model OptimizeModel(const Model& model, const TransformContext& context, int maxIterations = 10);
+
         /// <summary> Transforms the model by applying a transformation function to each node </summary>
         ///
         /// <param name="model"> The model to transform. </param>
@@ -233,6 +257,9 @@ namespace model
         template <typename NodeType>
         NodeType* GetCorrespondingInputNodeAs(const NodeType* node);
 
+        // Replaces the current model with the result of transforming each of its nodes, and composes the element maps
+        bool TransformNodes(const std::function<bool(const Node&)>& transformNode);
+
         // Find a node that isn't compilable (if there are several, it just finds one)
         std::vector<const Node*> FindUncompilableNodes(const Model& model, const TransformContext& context) const;
 
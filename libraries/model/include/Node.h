@@ -127,6 +127,9 @@ namespace model
         /// <summary> Indicates if this node is able to compile itself to code. </summary>
         virtual bool IsCompilable() const { return false; }
 
+        /// <summary> Indicates if the output of this node depends on the inputs it computed before, and not just on its current inputs. </summary>
+        virtual bool HasState() const { return false; }
+
         /// <summary> Makes a copy of this node into the model being constructed by the transformer </summary>
         ///
         /// <param name="transformer"> The `ModelTransformer` object currently creating a new model </param>
@@ -138,6 +141,13 @@ namespace model
         /// <summary> Refines this node in the model being constructed by the transformer </summary>
         virtual bool Refine(ModelTransformer& transformer) const;
 
+        /// <summary> Adds a cheaper equivalent of this node to the model being constructed by the transformer, for instance
+        /// by folding constant inputs or simplifying the operation. The default implementation just copies the node. </summary>
+        ///
+        /// <param name="transformer"> The `ModelTransformer` object currently creating a new model </param>
+        /// <returns> true if the node was replaced by something other than a copy of itself </returns>
+        virtual bool Optimize(ModelTransformer& transformer) const;
+
         /// <summary> Computes the output of this node and stores it in the output ports </summary>
         virtual void Compute() const = 0;
         void AddInputPort(InputPortBase* input);
@@ -149,6 +159,7 @@ namespace model
         void RegisterDependencies() const;
         void InvokeCopy(ModelTransformer& transformer) const;
         bool InvokeRefine(ModelTransformer& transformer) const;
+        bool InvokeOptimize(ModelTransformer& transformer) const;
 
         NodeId _id;
         std::vector<InputPortBase*> _inputs;
@@ -106,7 +106,7 @@ namespace model
         /// <summary> Sets the cached output from this port </summary>
         ///
         /// <param name=values> The values this port should output </param>
-        void SetOutput(std::vector<ValueType> values) const;
+        void SetOutput(const std::vector<ValueType>& values) const;
 
         /// <summary> Gets the name of this type (for serialization). </summary>
         ///
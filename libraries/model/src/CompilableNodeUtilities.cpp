@@ -41,6 +41,13 @@ namespace model
         return (ranges.size() == 1 && ranges[0].Size() > 1);
     }
 
+    bool IsLoopableVector(const model::InputPortBase& port)
+    {
+        // ports that concatenate several outputs are only unrolled when they are tiny
+        const size_t maxUnrolledSize = 8;
+        return IsPureVector(port) || port.Size() > maxUnrolledSize;
+    }
+
     bool HasSingleDescendant(const model::Node& node)
     {
         return (node.GetDependentNodes().size() == 1);
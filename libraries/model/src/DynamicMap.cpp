@@ -37,6 +37,23 @@ namespace model
         Prune();
     }
 
+    DynamicMap DynamicMap::Clone() const
+    {
+        std::vector<std::pair<std::string, InputNodeBase*>> inputs;
+        for (size_t index = 0; index < _inputNodes.size(); ++index)
+        {
+            inputs.emplace_back(_inputNames[index], _inputNodes[index]);
+        }
+
+        std::vector<std::pair<std::string, PortElementsBase>> outputs;
+        for (size_t index = 0; index < _outputElements.size(); ++index)
+        {
+            outputs.emplace_back(_outputNames[index], _outputElements[index]);
+        }
+
+        return DynamicMap(_model, inputs, outputs);
+    }
+
     void DynamicMap::SetNodeInput(InputNode<bool>* node, const std::vector<bool>& inputValues) const
     {
         node->SetInput(inputValues);
@@ -155,12 +172,21 @@ namespace model
         TransformContext context;
         ModelTransformer transformer;
 
+        // the input nodes are kept even if no output depends on them, so that the map's inputs remain valid
         auto outputNodeVec = GetOutputNodes();
+        outputNodeVec.insert(outputNodeVec.end(), _inputNodes.begin(), _inputNodes.end());
         auto minimalModel = transformer.CopyModel(_model, outputNodeVec, context);
         FixTransformedIO(transformer);
         _model = std::move(minimalModel);
     }
 
+    bool DynamicMap::HasState() const
+    {
+        bool hasState = false;
+        _model.Visit([&hasState](const Node& node) { hasState = hasState || node.HasState(); });
+        return hasState;
+    }
+
     size_t DynamicMap::GetOutputSize() const
     {
         return GetOutput(0).Size();
@@ -177,6 +203,24 @@ namespace model
         auto refinedModel = transformer.RefineModel(_model, context, maxIterations);
         FixTransformedIO(transformer);
         _model = std::move(refinedModel);
+
+        // refinement can leave behind nodes that only compute unused outputs of the original nodes
+        // (e.g., the weighted elements of a linear predictor), so drop everything the outputs don't depend on
+        Prune();
+    }
+
+    void DynamicMap::Optimize(const TransformContext& context, int maxIterations)
+    {
+        if (maxIterations == 0)
+        {
+            return;
+        }
+
+        ModelTransformer transformer;
+        auto optimizedModel = transformer.OptimizeModel(_model, context, maxIterations);
+        FixTransformedIO(transformer);
+        _model = std::move(optimizedModel);
+        Prune();
     }
 
     void DynamicMap::Transform(const std::function<void(const Node&, ModelTransformer&)>& transformFunction, const TransformContext& context)
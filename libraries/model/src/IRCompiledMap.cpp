@@ -21,22 +21,25 @@
 #include "Files.h"
 
 // stl
+#include <algorithm>
+#include <cstdint>
 #include <sstream>
+#include <string>
 
 namespace ell
 {
 namespace model
 {
-    IRCompiledMap::IRCompiledMap(const model::DynamicMap& other, const std::string& functionName, bool optimize)
-        : CompiledMap(other, functionName, optimize)
+    IRCompiledMap::IRCompiledMap(const model::DynamicMap& other, const std::string& functionName, bool optimize, bool profile, bool relaxedPrecision)
+        : CompiledMap(other, functionName, optimize), _profile(profile), _relaxedPrecision(relaxedPrecision)
     {
         Compile();
     }
 
     IRCompiledMap::IRCompiledMap(IRCompiledMap&& other)
-        : CompiledMap(std::move(other)), _moduleName(std::move(other._moduleName)), _module(std::move(other._module)), _executionEngine(std::move(other._executionEngine))
+        : CompiledMap(std::move(other)), _moduleName(std::move(other._moduleName)), _profile(other._profile), _relaxedPrecision(other._relaxedPrecision), _profiledNodes(std::move(other._profiledNodes)), _module(std::move(other._module)), _executionEngine(std::move(other._executionEngine))
     {
-        // We need to re-extract the compute function address -- the default move constructor doesn't do that correctly for some reason
+        // Re-extract the compute function address and rebuild the argument buffers for the moved map
         SetComputeFunction();
     }
 
@@ -51,6 +54,10 @@ namespace model
         model::TransformContext context{ [](const model::Node& node) { return node.IsCompilable() ? model::NodeAction::compile : model::NodeAction::refine; } };
         Refine(context);
 
+        // Fold constants and simplify operations exposed by refinement, changing floating-point results only if asked to
+        context.SetRelaxedPrecisionAllowed(_relaxedPrecision);
+        Optimize(context);
+
         // Now transform nodes into compilable nodes
         // Transform(TryMakeCompilableNode, context);
 
@@ -58,6 +65,7 @@ namespace model
         emitters::CompilerParameters settings;
         settings.optimize = _optimize;
         settings.includeDiagnosticInfo = false;
+        settings.profile = _profile;
 
         IRMapCompiler compiler(_moduleName);
         compiler.SetCompilerParameters(settings);
@@ -68,6 +76,7 @@ namespace model
         IRMapCompiler jitCompiler(_moduleName + "_jit");
         jitCompiler.SetCompilerParameters(settings);
         jitCompiler.CompileMap(*this, _functionName);
+        _profiledNodes = jitCompiler.GetProfiledNodes();
         _executionEngine = jitCompiler.Jit();
         SetComputeFunction(); // extract the compute function from the execution engine
     }
@@ -77,91 +86,189 @@ namespace model
         return _module != nullptr && _module->IsValid();
     }
 
-    void IRCompiledMap::SetComputeFunction()
+    int64_t* IRCompiledMap::GetProfileTable(const std::string& name) const
     {
-        switch (GetInput(0)->GetOutputPort().GetType())
+        if (!_profile)
         {
-            case model::Port::PortType::boolean:
-                SetComputeFunctionForInputType<bool>();
-                break;
+            throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "map was not compiled with profiling");
+        }
+        auto address = _executionEngine->GetGlobalValueAddress(name);
+        if (address == 0)
+        {
+            throw emitters::EmitterException(emitters::EmitterError::unexpected, "profile table " + name + " not found");
+        }
+        return reinterpret_cast<int64_t*>(address);
+    }
+
+    ModelProfile IRCompiledMap::GetProfile() const
+    {
+        auto callCounts = GetProfileTable(IRMapCompiler::GetProfileCallCountsName(_functionName));
+        auto cycles = GetProfileTable(IRMapCompiler::GetProfileCyclesName(_functionName));
 
+        ModelProfile profile("cycles");
+        for (size_t index = 0; index < _profiledNodes.size(); ++index)
+        {
+            profile.AddNodeSamples(*_profiledNodes[index], static_cast<size_t>(callCounts[index]), static_cast<double>(cycles[index]));
+        }
+        return profile;
+    }
+
+    void IRCompiledMap::ResetProfile()
+    {
+        auto callCounts = GetProfileTable(IRMapCompiler::GetProfileCallCountsName(_functionName));
+        auto cycles = GetProfileTable(IRMapCompiler::GetProfileCyclesName(_functionName));
+        std::fill(callCounts, callCounts + _profiledNodes.size(), 0);
+        std::fill(cycles, cycles + _profiledNodes.size(), 0);
+    }
+
+    void IRCompiledMap::PortBuffer::Resize(model::Port::PortType portType, size_t size)
+    {
+        type = portType;
+        switch (type)
+        {
+            case model::Port::PortType::boolean: // compiled code stores bools as ints (see PortTypeToVariableType)
             case model::Port::PortType::integer:
-                SetComputeFunctionForInputType<int>();
+                intValues.resize(size);
                 break;
-
             case model::Port::PortType::real:
-                SetComputeFunctionForInputType<double>();
+                doubleValues.resize(size);
                 break;
+            default:
+                throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
+        }
+    }
 
+    int64_t IRCompiledMap::PortBuffer::GetAddress()
+    {
+        void* data = nullptr;
+        switch (type)
+        {
+            case model::Port::PortType::boolean:
+            case model::Port::PortType::integer:
+                data = intValues.data();
+                break;
+            case model::Port::PortType::real:
+                data = doubleValues.data();
+                break;
             default:
                 throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
         }
+        return static_cast<int64_t>(reinterpret_cast<intptr_t>(data));
     }
 
-    void IRCompiledMap::SetNodeInput(model::InputNode<bool>* node, const std::vector<bool>& inputValues) const
+    void IRCompiledMap::SetComputeFunction()
     {
-        if (GetInput(0)->GetOutputPort().GetType() != node->GetOutputPort().GetType())
+        auto numInputs = NumInputPorts();
+        auto numOutputs = NumOutputPorts();
+        _buffers.resize(numInputs + numOutputs);
+        for (size_t index = 0; index < numInputs; ++index)
         {
-            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
+            _buffers[index].Resize(GetInput(index)->GetOutputType(), GetInput(index)->Size());
+        }
+        for (size_t index = 0; index < numOutputs; ++index)
+        {
+            auto output = GetOutput(index);
+            _buffers[numInputs + index].Resize(output.GetPortType(), output.Size());
         }
-        utilities::ConformingVector<bool> temp(inputValues.size());
-        for (size_t index = 0; index < temp.size(); ++index)
+
+        // the buffers are never resized after this point, so their addresses stay valid
+        _argumentAddresses.resize(_buffers.size());
+        for (size_t index = 0; index < _buffers.size(); ++index)
         {
-            temp[index] = static_cast<bool>(inputValues[index]);
+            _argumentAddresses[index] = _buffers[index].GetAddress();
         }
 
-        std::get<ComputeFunction<bool>>(_computeInputFunction)((bool*)temp.data());
+        auto functionPointer = _executionEngine->ResolveFunctionAddress(IRMapCompiler::GetPackedArgumentsFunctionName(_functionName));
+        _computeFunction = reinterpret_cast<PackedArgumentsFunction>(functionPointer);
+        _outputsValid = false;
     }
 
-    void IRCompiledMap::SetNodeInput(model::InputNode<int>* node, const std::vector<int>& inputValues) const
+    size_t IRCompiledMap::GetInputIndex(const model::InputNodeBase* node) const
     {
-        if (GetInput(0)->GetOutputPort().GetType() != node->GetOutputPort().GetType())
+        for (size_t index = 0; index < NumInputPorts(); ++index)
         {
-            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
+            if (GetInput(index) == node)
+            {
+                return index;
+            }
         }
-
-        std::get<ComputeFunction<int>>(_computeInputFunction)(inputValues.data());
+        throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "node is not an input of the compiled map");
     }
 
-    void IRCompiledMap::SetNodeInput(model::InputNode<double>* node, const std::vector<double>& inputValues) const
+    void IRCompiledMap::SetNodeInput(model::InputNode<bool>* node, const std::vector<bool>& inputValues) const
     {
-        if (GetInput(0)->GetOutputPort().GetType() != node->GetOutputPort().GetType())
+        auto& buffer = _buffers[GetInputIndex(node)];
+        if (buffer.type != model::Port::PortType::boolean || inputValues.size() != buffer.intValues.size())
         {
             throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
         }
-
-        std::get<ComputeFunction<double>>(_computeInputFunction)(inputValues.data());
+        std::copy(inputValues.begin(), inputValues.end(), buffer.intValues.begin());
+        _outputsValid = false;
     }
 
-    std::vector<bool> IRCompiledMap::ComputeBoolOutput(const model::PortElementsBase& outputs) const
+    void IRCompiledMap::SetNodeInput(model::InputNode<int>* node, const std::vector<int>& inputValues) const
     {
-        if (GetOutput(0).GetPortType() != model::Port::PortType::boolean)
+        auto& buffer = _buffers[GetInputIndex(node)];
+        if (buffer.type != model::Port::PortType::integer || inputValues.size() != buffer.intValues.size())
         {
             throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
         }
-
-        // Terrible hack to create a std::vector<bool>
-        return std::vector<bool>((bool*)(std::get<utilities::ConformingVector<bool>>(_cachedOutput).data()), (bool*)(std::get<utilities::ConformingVector<bool>>(_cachedOutput).data() + std::get<utilities::ConformingVector<bool>>(_cachedOutput).size()));
+        std::copy(inputValues.begin(), inputValues.end(), buffer.intValues.begin());
+        _outputsValid = false;
     }
 
-    std::vector<int> IRCompiledMap::ComputeIntOutput(const model::PortElementsBase& outputs) const
+    void IRCompiledMap::SetNodeInput(model::InputNode<double>* node, const std::vector<double>& inputValues) const
     {
-        if (GetOutput(0).GetPortType() != model::Port::PortType::integer)
+        auto& buffer = _buffers[GetInputIndex(node)];
+        if (buffer.type != model::Port::PortType::real || inputValues.size() != buffer.doubleValues.size())
         {
             throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
         }
-
-        return std::get<utilities::ConformingVector<int>>(_cachedOutput);
+        std::copy(inputValues.begin(), inputValues.end(), buffer.doubleValues.begin());
+        _outputsValid = false;
     }
 
-    std::vector<double> IRCompiledMap::ComputeDoubleOutput(const model::PortElementsBase& outputs) const
+    const IRCompiledMap::PortBuffer& IRCompiledMap::ComputeOutputBuffer(const model::PortElementsBase& outputs, model::Port::PortType type) const
     {
-        if (GetOutput(0).GetPortType() != model::Port::PortType::real)
+        auto numInputs = NumInputPorts();
+        for (size_t index = 0; index < NumOutputPorts(); ++index)
         {
-            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
+            auto output = GetOutput(index);
+            if (output.GetRanges()[0].ReferencedPort() == outputs.GetRanges()[0].ReferencedPort())
+            {
+                if (output.GetPortType() != type)
+                {
+                    throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
+                }
+
+                // a single call computes every output for the current inputs
+                if (!_outputsValid)
+                {
+                    _computeFunction(_argumentAddresses.data());
+                    _outputsValid = true;
+                }
+                return _buffers[numInputs + index];
+            }
         }
+        throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "elements are not an output of the compiled map");
+    }
+
+    std::vector<bool> IRCompiledMap::ComputeBoolOutput(const model::PortElementsBase& outputs) const
+    {
+        const auto& values = ComputeOutputBuffer(outputs, model::Port::PortType::boolean).intValues;
+        std::vector<bool> result(values.size());
+        std::transform(values.begin(), values.end(), result.begin(), [](int value) { return value != 0; });
+        return result;
+    }
+
+    std::vector<int> IRCompiledMap::ComputeIntOutput(const model::PortElementsBase& outputs) const
+    {
+        return ComputeOutputBuffer(outputs, model::Port::PortType::integer).intValues;
+    }
 
-        return std::get<utilities::ConformingVector<double>>(_cachedOutput);
+    std::vector<double> IRCompiledMap::ComputeDoubleOutput(const model::PortElementsBase& outputs) const
+    {
+        return ComputeOutputBuffer(outputs, model::Port::PortType::real).doubleValues;
     }
 
     void IRCompiledMap::WriteCode(const std::string& filePath)
@@ -197,14 +304,29 @@ namespace model
 
     void IRCompiledMap::WriteCodeHeader(std::ostream& stream) const
     {
-        auto inputSize = GetInput(0)->Size();
-        auto inputType = GetInput(0)->GetOutputType();
-        auto outputSize = GetOutput(0).Size();
-        auto outputType = GetOutput(0).GetPortType();
+        auto numInputs = NumInputPorts();
+        auto numOutputs = NumOutputPorts();
+        auto argumentName = [](const std::string& prefix, size_t index, size_t count) { return count == 1 ? prefix : prefix + std::to_string(index); };
 
+        // the declarations use int64_t, so the header includes its definition and compiles on its own
+        stream << "#include <stdint.h>\n\n";
         stream << "extern \"C\" void " << _functionName << "(";
-        stream << GetPortCTypeName(inputType) << " input[" << inputSize << "], ";
-        stream << GetPortCTypeName(outputType) << " output[" << outputSize << "]);";
+        for (size_t index = 0; index < numInputs; ++index)
+        {
+            stream << GetPortCTypeName(GetInput(index)->GetOutputType()) << " " << argumentName("input", index, numInputs) << "[" << GetInput(index)->Size() << "], ";
+        }
+        for (size_t index = 0; index < numOutputs; ++index)
+        {
+            auto output = GetOutput(index);
+            stream << GetPortCTypeName(output.GetPortType()) << " " << argumentName("output", index, numOutputs) << "[" << output.Size() << "]" << (index + 1 < numOutputs ? ", " : ");");
+        }
+        stream << "\nextern \"C\" void " << IRMapCompiler::GetPackedArgumentsFunctionName(_functionName) << "(int64_t args[" << numInputs + numOutputs << "]);";
+
+        if (_profile)
+        {
+            stream << "\nextern \"C\" int64_t " << IRMapCompiler::GetProfileCallCountsName(_functionName) << "[" << _profiledNodes.size() << "];";
+            stream << "\nextern \"C\" int64_t " << IRMapCompiler::GetProfileCyclesName(_functionName) << "[" << _profiledNodes.size() << "];";
+        }
     }
 
     std::string IRCompiledMap::GetCodeHeaderString() const
@@ -216,20 +338,34 @@ namespace model
 
     void IRCompiledMap::EnsureValidMap()
     {
-        if (NumInputPorts() != 1)
+        if (NumInputPorts() == 0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Compiled maps must have at least one input");
+        }
+
+        if (NumOutputPorts() == 0)
         {
-            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Compiled maps must have a single input");
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Compiled maps must have at least one output");
         }
 
-        if (NumOutputPorts() != 1)
+        // The compiled function has a separate argument for each input and output, so each output must be
+        // the full output of a port that isn't shared with an input or an earlier output. Otherwise, add an
+        // output node to model.
+        std::vector<const model::OutputPortBase*> usedPorts;
+        for (size_t index = 0; index < NumInputPorts(); ++index)
         {
-            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Compiled maps must have a single output");
+            usedPorts.push_back(&GetInput(index)->GetOutputPort());
         }
 
-        // if output isn't a simple port, add an output node to model
-        auto out = GetOutput(0);
-        if (!out.IsFullPortOutput())
+        for (size_t index = 0; index < NumOutputPorts(); ++index)
         {
+            auto out = GetOutput(index);
+            if (out.IsFullPortOutput() && std::find(usedPorts.begin(), usedPorts.end(), out.GetRanges()[0].ReferencedPort()) == usedPorts.end())
+            {
+                usedPorts.push_back(out.GetRanges()[0].ReferencedPort());
+                continue;
+            }
+
             model::OutputNodeBase* outputNode = nullptr;
             switch (out.GetPortType())
             {
@@ -246,7 +382,8 @@ namespace model
                     throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
             }
 
-            ResetOutput(0, outputNode->GetOutputPort());
+            usedPorts.push_back(&outputNode->GetOutputPort());
+            ResetOutput(index, outputNode->GetOutputPort());
         }
     }
 
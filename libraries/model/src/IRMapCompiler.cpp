@@ -18,6 +18,12 @@ namespace ell
 {
 namespace model
 {
+    namespace
+    {
+        // the largest number of elements gathered into a stack array by EnsureContiguousInput; larger inputs go into a global array
+        const size_t maxStackGatherSize = 64;
+    }
+
     IRMapCompiler::IRMapCompiler()
         : IRMapCompiler("ELL")
     {
@@ -49,6 +55,120 @@ namespace model
         return EnsureEmitted(portElement);
     }
 
+    llvm::Value* IRMapCompiler::EnsureContiguousInput(InputPortBase* pPort)
+    {
+        assert(pPort != nullptr);
+        const auto& ranges = pPort->GetInputElements().GetRanges();
+        if (ranges.size() == 1 && ranges[0].GetStartIndex() == 0)
+        {
+            return EnsureEmitted(pPort);
+        }
+
+        auto& function = GetCurrentFunction();
+        llvm::Value* pBuffer = nullptr;
+        if (pPort->Size() <= maxStackGatherSize)
+        {
+            pBuffer = function.Variable(GetPortVariableType(*pPort), static_cast<int>(pPort->Size()));
+        }
+        else
+        {
+            // a large array on the stack could overflow the small stacks of embedded targets
+            auto pBufferVar = Variables().AddVectorVariable(emitters::VariableScope::global, GetPortVariableType(*pPort), static_cast<int>(pPort->Size()));
+            pBuffer = EnsureEmitted(*pBufferVar);
+        }
+        int offset = 0;
+        for (const auto& range : ranges)
+        {
+            auto pReferencedPort = range.ReferencedPort();
+            int start = static_cast<int>(range.GetStartIndex());
+            int size = static_cast<int>(range.Size());
+            auto pVar = EnsureVariableFor(pReferencedPort);
+            if (size == 1 || pVar->IsScalar())
+            {
+                for (int index = 0; index < size; ++index)
+                {
+                    llvm::Value* pValue = LoadVariable(PortElementBase(*pReferencedPort, start + index));
+                    function.SetValueAt(pBuffer, function.Literal(offset + index), pValue);
+                }
+            }
+            else
+            {
+                llvm::Value* pSource = EnsureEmitted(*pVar);
+                auto forLoop = function.ForLoop();
+                forLoop.Begin(size);
+                {
+                    auto i = forLoop.LoadIterationVariable();
+                    llvm::Value* pValue = function.ValueAt(pSource, function.Operator(emitters::TypedOperator::add, i, function.Literal(start)));
+                    function.SetValueAt(pBuffer, function.Operator(emitters::TypedOperator::add, i, function.Literal(offset)), pValue);
+                }
+                forLoop.End();
+            }
+            offset += size;
+        }
+        return pBuffer;
+    }
+
+    void IRMapCompiler::OnBeginCompileModel(const Model& model, const std::string& functionName)
+    {
+        _profiledNodes.clear();
+        _pProfiledNode = nullptr;
+        if (!GetCompilerParameters().profile)
+        {
+            return;
+        }
+
+        // One entry per node is an upper bound, since nodes that emit no code of their own aren't instrumented.
+        // The tables are exported so that code linking against the compiled module can read them.
+        _pProfileCallCounts = Global(emitters::VariableType::Int64, GetProfileCallCountsName(functionName), model.Size());
+        _pProfileCallCounts->setLinkage(llvm::GlobalValue::ExternalLinkage);
+        _pProfileCycles = Global(emitters::VariableType::Int64, GetProfileCyclesName(functionName), model.Size());
+        _pProfileCycles->setLinkage(llvm::GlobalValue::ExternalLinkage);
+        _pProfileStartCycles = GetCurrentFunction().Variable(emitters::VariableType::Int64, "profileStartCycles");
+    }
+
+    void IRMapCompiler::OnEndCompileModel(const model::Model& model, const std::string& functionName)
+    {
+        auto curBlock = GetIREmitter().GetCurrentBlock();
+
+        const auto& args = GetArgs();
+        auto function = Function(GetPackedArgumentsFunctionName(functionName), emitters::VariableType::Void, { emitters::VariableType::Int64Pointer }, true);
+        llvm::Value* pPackedArgs = &(*function.Arguments().begin());
+        emitters::IRValueList callArgs;
+        for (size_t index = 0; index < args.Size(); ++index)
+        {
+            llvm::Value* pAddress = function.ValueAt(pPackedArgs, static_cast<int>(index));
+            callArgs.Append(function.CastIntToPointer(pAddress, args[index].second));
+        }
+        function.Call(functionName, callArgs);
+        function.Return();
+        function.Complete();
+
+        GetIREmitter().SetCurrentBlock(curBlock);
+    }
+
+    void IRMapCompiler::BeginProfilingNode(const Node& node)
+    {
+        auto& function = GetCurrentFunction();
+        function.Store(_pProfileStartCycles, function.Call(GetRuntime().GetCycleCounterFunction(), {}));
+        _pProfiledNode = &node;
+    }
+
+    void IRMapCompiler::EndProfilingNode(const Node& node)
+    {
+        auto& function = GetCurrentFunction();
+        llvm::Value* pEndCycles = function.Call(GetRuntime().GetCycleCounterFunction(), {});
+        llvm::Value* pElapsed = function.Operator(emitters::TypedOperator::subtract, pEndCycles, function.Load(_pProfileStartCycles));
+        llvm::Value* pIndex = function.Literal(static_cast<int>(_profiledNodes.size()));
+
+        llvm::Value* pCycles = function.Operator(emitters::TypedOperator::add, function.ValueAt(_pProfileCycles, pIndex), pElapsed);
+        function.SetValueAt(_pProfileCycles, pIndex, pCycles);
+        llvm::Value* pCallCount = function.Operator(emitters::TypedOperator::add, function.ValueAt(_pProfileCallCounts, pIndex), function.Literal(static_cast<int64_t>(1)));
+        function.SetValueAt(_pProfileCallCounts, pIndex, pCallCount);
+
+        _profiledNodes.push_back(&node);
+        _pProfiledNode = nullptr;
+    }
+
     void IRMapCompiler::OnBeginCompileNode(const Node& node)
     {
         if (GetCurrentRegion() == nullptr)
@@ -65,6 +185,13 @@ namespace model
         {
             GetCurrentRegion()->SetEnd(pCurBlock);
         }
+
+        // the node's region starts with the cycle counter read emitted by NewBlockRegion, and the code we
+        // add here ends up at the end of the same region, even if it was merged into its parent's region
+        if (_pProfiledNode == &node)
+        {
+            EndProfilingNode(node);
+        }
     }
 
     const Node* IRMapCompiler::GetUniqueParent(const Node& node)
@@ -105,6 +232,10 @@ namespace model
         {
             GetCurrentFunction().Print(DiagnosticString(node) + '\n');
         }
+        if (GetCompilerParameters().profile)
+        {
+            BeginProfilingNode(node);
+        }
     }
 
     bool IRMapCompiler::TryMergeRegion(const Node& node)
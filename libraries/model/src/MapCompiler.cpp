@@ -34,8 +34,10 @@ namespace model
         }
 
         pModuleEmitter->BeginFunction(functionName, _arguments);
+        OnBeginCompileModel(map.GetModel(), functionName);
         CompileNodes(map.GetModel());
         pModuleEmitter->EndFunction();
+        OnEndCompileModel(map.GetModel(), functionName);
     }
 
     void MapCompiler::CompileNodes(model::Model& model)
@@ -105,15 +107,25 @@ namespace model
         {
             _inputArgs.Append({ pVar->EmittedName(), GetPointerType(varType) });
         }
+        else
+        {
+            _outputPorts.insert(pPort);
+        }
 
         return pVar;
     }
 
+    bool MapCompiler::IsPortUsed(const OutputPortBase* pPort) const
+    {
+        return pPort->IsReferenced() || _outputPorts.find(pPort) != _outputPorts.end();
+    }
+
     void MapCompiler::ClearArgs()
     {
         // Can we free the variables associated with the args?
         _arguments.Clear();
         _inputArgs.Clear();
+        _outputPorts.clear();
     }
 
     emitters::ModuleEmitter* MapCompiler::GetModuleEmitter()
@@ -7,10 +7,12 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "Model.h"
+#include "ModelProfile.h"
 #include "Node.h"
 #include "Port.h"
 
 // stl
+#include <chrono>
 #include <unordered_map>
 
 namespace ell
@@ -47,6 +49,20 @@ namespace model
         }
     }
 
+    void Model::ComputeNode(const Node& node) const
+    {
+        if (_profile == nullptr)
+        {
+            node.Compute();
+            return;
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        node.Compute();
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+        _profile->AddNodeSamples(node, 1, elapsed.count());
+    }
+
     NodeIterator Model::GetNodeIterator(const std::vector<const Node*>& outputNodes) const
     {
         return NodeIterator(this, outputNodes);
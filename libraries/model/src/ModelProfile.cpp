@@ -0,0 +1,95 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ModelProfile.cpp (model)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ModelProfile.h"
+#include "InputPort.h"
+#include "OutputPort.h"
+#include "Port.h"
+
+// stl
+#include <algorithm>
+#include <iomanip>
+
+namespace ell
+{
+namespace model
+{
+    namespace
+    {
+        size_t GetPortElementSize(Port::PortType type)
+        {
+            switch (type)
+            {
+                case Port::PortType::real:
+                    return sizeof(double);
+                case Port::PortType::integer:
+                case Port::PortType::categorical:
+                    return sizeof(int);
+                case Port::PortType::boolean:
+                    return sizeof(bool);
+                default:
+                    return 0;
+            }
+        }
+    }
+
+    ModelProfile::ModelProfile(const std::string& timeUnits)
+        : _timeUnits(timeUnits)
+    {
+    }
+
+    void ModelProfile::AddNodeSamples(const Node& node, size_t callCount, double totalTime)
+    {
+        auto nodeType = node.GetRuntimeTypeName();
+        auto& counters = _nodeTypeCounters[nodeType];
+        counters.nodeType = nodeType;
+        counters.callCount += callCount;
+        counters.totalTime += totalTime;
+        counters.bytesTouched += callCount * GetBytesTouchedPerCall(node);
+    }
+
+    std::vector<NodePerformanceCounters> ModelProfile::GetNodeTypeCounters() const
+    {
+        std::vector<NodePerformanceCounters> result;
+        for (const auto& entry : _nodeTypeCounters)
+        {
+            result.push_back(entry.second);
+        }
+        std::stable_sort(result.begin(), result.end(), [](const NodePerformanceCounters& a, const NodePerformanceCounters& b) { return a.totalTime > b.totalTime; });
+        return result;
+    }
+
+    void ModelProfile::Reset()
+    {
+        _nodeTypeCounters.clear();
+    }
+
+    void ModelProfile::Print(std::ostream& os) const
+    {
+        os << std::left << std::setw(48) << "node type" << std::right << std::setw(12) << "calls" << std::setw(16) << ("time (" + _timeUnits + ")") << std::setw(16) << "bytes" << '\n';
+        for (const auto& counters : GetNodeTypeCounters())
+        {
+            os << std::left << std::setw(48) << counters.nodeType << std::right << std::setw(12) << counters.callCount << std::setw(16) << counters.totalTime << std::setw(16) << counters.bytesTouched << '\n';
+        }
+    }
+
+    size_t ModelProfile::GetBytesTouchedPerCall(const Node& node)
+    {
+        size_t bytes = 0;
+        for (auto input : node.GetInputPorts())
+        {
+            bytes += input->Size() * GetPortElementSize(input->GetType());
+        }
+        for (auto output : node.GetOutputPorts())
+        {
+            bytes += output->Size() * GetPortElementSize(output->GetType());
+        }
+        return bytes;
+    }
+}
+}
@@ -104,44 +104,47 @@ namespace model
         // the model is fully refined, or until the maximum number of iterations is reached.
         for (int i = 0; i < maxIterations; ++i)
         {
-            Model currentModel = std::move(_model);
-            _model = Model();
-
-            auto currentElementToElementMap = std::move(_elementToElementMap);
-            _elementToElementMap.clear();
-
-            _isModelCompilable = true;
-
             // one refinement pass
-            bool didRefineAny = false;
-            currentModel.Visit([this, &context, &didRefineAny](const Node& node) {
-                bool didRefineNode = false;
+            bool didRefineAny = TransformNodes([this, &context](const Node& node) {
                 auto action = context.GetNodeAction(node);
                 // If the node action is "refine" or the default, try to refine the node, otherwise leave it alone
                 if (action == NodeAction::refine || action == NodeAction::abstain)
                 {
-                    didRefineNode = node.InvokeRefine(*this);
+                    return node.InvokeRefine(*this);
                 }
-                else
-                {
-                    node.InvokeCopy(*this);
-                }
-                didRefineAny |= didRefineNode;
+                node.InvokeCopy(*this);
+                return false;
             });
 
-            // concatenate new port map onto existing port map
-            if (currentElementToElementMap.size() > 0)
+            // check for early end condition
+            if (!didRefineAny || _isModelCompilable)
             {
-                std::unordered_map<PortElementBase, PortElementBase> newElementToElementMap;
-                for (const auto& entry : currentElementToElementMap)
-                {
-                    newElementToElementMap[entry.first] = _elementToElementMap[entry.second];
-                }
-                _elementToElementMap = newElementToElementMap;
+                break;
             }
+        }
 
-            // check for early end condition
-            if (!didRefineAny || _isModelCompilable)
+        // clear out the context
+        _context = TransformContext();
+        return std::move(_model);
+    }
+
+    Model ModelTransformer::OptimizeModel(const Model& oldModel, const TransformContext& context, int maxIterations)
+    {
+        if (maxIterations <= 0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "maxIterations must be positive");
+        }
+
+        _context = context;
+        _model = oldModel; // need to make a copy here
+        _elementToElementMap.clear();
+
+        // a simplification can expose another one downstream (e.g., folding a constant subgraph makes
+        // its consumer's input constant), so repeat until a pass doesn't change anything
+        for (int i = 0; i < maxIterations; ++i)
+        {
+            bool didOptimizeAny = TransformNodes([this](const Node& node) { return node.InvokeOptimize(*this); });
+            if (!didOptimizeAny)
             {
                 break;
             }
@@ -152,6 +155,34 @@ namespace model
         return std::move(_model);
     }
 
+    bool ModelTransformer::TransformNodes(const std::function<bool(const Node&)>& transformNode)
+    {
+        Model currentModel = std::move(_model);
+        _model = Model();
+
+        auto currentElementToElementMap = std::move(_elementToElementMap);
+        _elementToElementMap.clear();
+
+        _isModelCompilable = true;
+
+        bool didTransformAny = false;
+        currentModel.Visit([&transformNode, &didTransformAny](const Node& node) {
+            didTransformAny |= transformNode(node);
+        });
+
+        // concatenate new port map onto existing port map
+        if (currentElementToElementMap.size() > 0)
+        {
+            std::unordered_map<PortElementBase, PortElementBase> newElementToElementMap;
+            for (const auto& entry : currentElementToElementMap)
+            {
+                newElementToElementMap[entry.first] = _elementToElementMap[entry.second];
+            }
+            _elementToElementMap = newElementToElementMap;
+        }
+        return didTransformAny;
+    }
+
     Model ModelTransformer::TransformModel(const Model& model, const std::function<void(const Node&, ModelTransformer&)>& transformFunction, const TransformContext& context)
     {
         _context = context;
@@ -142,6 +142,11 @@ namespace model
         return Refine(transformer);
     }
 
+    bool Node::InvokeOptimize(ModelTransformer& transformer) const
+    {
+        return Optimize(transformer);
+    }
+
     // Default implementation of Refine just copies and returns false
     bool Node::Refine(ModelTransformer& transformer) const
     {
@@ -149,6 +154,13 @@ namespace model
         return false;
     }
 
+    // Default implementation of Optimize just copies and returns false
+    bool Node::Optimize(ModelTransformer& transformer) const
+    {
+        Copy(transformer);
+        return false;
+    }
+
     void Node::WriteToArchive(utilities::Archiver& archiver) const
     {
         archiver["id"] << _id;
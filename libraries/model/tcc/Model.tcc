@@ -55,7 +55,7 @@ namespace model
     template <typename ValueType>
     std::vector<ValueType> Model::ComputeOutput(const OutputPort<ValueType>& outputPort) const
     {
-        auto compute = [](const Node& node) { node.Compute(); };
+        auto compute = [this](const Node& node) { ComputeNode(node); };
         Visit({ outputPort.GetNode() }, compute);
         return outputPort.GetOutput();
     }
@@ -70,7 +70,7 @@ namespace model
             usedNodes.insert(range.ReferencedPort()->GetNode());
         }
 
-        auto compute = [](const Node& node) { node.Compute(); };
+        auto compute = [this](const Node& node) { ComputeNode(node); };
         auto nodes = std::vector<const Node*>(usedNodes.begin(), usedNodes.end());
         Visit(nodes, compute);
 
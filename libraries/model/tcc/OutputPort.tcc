@@ -41,7 +41,7 @@ namespace model
     }
 
     template <typename ValueType>
-    void OutputPort<ValueType>::SetOutput(std::vector<ValueType> values) const
+    void OutputPort<ValueType>::SetOutput(const std::vector<ValueType>& values) const
     {
         _cachedOutput = values;
     }
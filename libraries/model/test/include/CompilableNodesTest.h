@@ -15,11 +15,23 @@ void TestCompilableConstantNode();
 void TestCompilableDotProductNode();
 void TestCompilableDelayNode();
 void TestCompilableDTWDistanceNode();
+void TestCompilableDTWDistanceNodeWithPruning();
+void TestCompilableDTWBankNode();
 void TestCompilableMulticlassDTW();
 void TestCompilableSumNode();
+void TestCompilableMultiRangeSumNode();
+void TestCompilableLargeMultiRangeSumNode();
 void TestCompilableUnaryOperationNode();
 void TestCompilableBinaryOperationNode();
+void TestCompilableMultiRangeBinaryOperationNode();
 void TestCompilableBinaryPredicateNode();
 void TestCompilableMultiplexerNode();
 void TestCompilableTypeCastNode();
+void TestCompilableL2NormNode();
+void TestCompilableValueSelectorNode();
+void TestCompilableDemultiplexerNode();
+void TestCompilableSingleElementThresholdNode();
+void TestCompilableLinearPredictorNode();
+void TestCompilableLinearPredictorNodeWeightedElements();
+void TestCompilableMovingAverageNode();
 }
\ No newline at end of file
@@ -39,6 +39,8 @@ model::Model MakeForestModel();
 model::DynamicMap MakeForestMap();
 
 void TestCompiledMapMove();
+void TestCompiledMapProfile();
+void TestCompiledMapMultipleInputsOutputs();
 void TestBinaryVector(bool expanded, bool runJit = false);
 void TestBinaryScalar();
 void TestDotProduct();
@@ -8,6 +8,9 @@ namespace ell
 void TestDynamicMapCreate();
 void TestDynamicMapCompute();
 void TestDynamicMapComputeDataVector();
+void TestDynamicMapClone();
 void TestDynamicMapRefine();
+void TestDynamicMapRefinePrunesUnusedOutputs();
+void TestDynamicMapOptimize();
 void TestDynamicMapSerialization();
 }
\ No newline at end of file
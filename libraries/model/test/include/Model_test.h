@@ -27,4 +27,6 @@ void TestCopyModel();
 
 void TestRefineSplitOutputs();
 void TestCustomRefine();
+
+void TestModelProfile();
 }
\ No newline at end of file
@@ -23,21 +23,31 @@
 #include "BinaryOperationNode.h"
 #include "BinaryPredicateNode.h"
 #include "ConstantNode.h"
+#include "DTWBankNode.h"
 #include "DTWDistanceNode.h"
 #include "DelayNode.h"
+#include "DemultiplexerNode.h"
 #include "DotProductNode.h"
 #include "ExtremalValueNode.h"
+#include "L2NormNode.h"
+#include "LinearPredictorNode.h"
+#include "MovingAverageNode.h"
 #include "MultiplexerNode.h"
+#include "SingleElementThresholdNode.h"
 #include "SumNode.h"
 #include "TypeCastNode.h"
 #include "UnaryOperationNode.h"
+#include "ValueSelectorNode.h"
 
 // testing
 #include "testing.h"
 
 // stl
 #include <iostream>
+#include <limits>
+#include <numeric>
 #include <ostream>
+#include <sstream>
 #include <string>
 
 namespace ell
@@ -119,6 +129,53 @@ void TestCompilableDTWDistanceNode()
     VerifyCompiledOutput(map, compiledMap, signal, "DTWDistanceNode");
 }
 
+void TestCompilableDTWDistanceNodeWithPruning()
+{
+    std::vector<std::vector<double>> prototype = { { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 } };
+    std::vector<std::vector<double>> signal = { { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 }, { 3, 4, 5 }, { 2, 3, 2 }, { 1, 5, 3 }, { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 }, { 7, 4, 2 }, { 5, 2, 1 } };
+    const double threshold = 2.0;
+
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(3);
+    auto exactNode = model.AddNode<nodes::DTWDistanceNode<double>>(inputNode->output, prototype);
+    auto prunedNode = model.AddNode<nodes::DTWDistanceNode<double>>(inputNode->output, prototype, threshold);
+    auto exactMap = model::DynamicMap(model, { { "input", inputNode } }, { { "output", exactNode->output } });
+    auto prunedMap = model::DynamicMap(model, { { "input", inputNode } }, { { "output", prunedNode->output } });
+
+    // pruning must not change any distance at or below the threshold
+    bool ok = true;
+    for (const auto& input : signal)
+    {
+        exactMap.SetInputValue(0, input);
+        auto exactResult = exactMap.ComputeOutput<double>(0)[0];
+        prunedMap.SetInputValue(0, input);
+        auto prunedResult = prunedMap.ComputeOutput<double>(0)[0];
+        ok = ok && (exactResult <= threshold ? testing::IsEqual(exactResult, prunedResult) : prunedResult == std::numeric_limits<double>::max());
+    }
+    testing::ProcessTest("Testing pruned DTWDistanceNode compute", ok);
+
+    // the compiled kernel must match a fresh copy of the interpreted node
+    auto map = model::DynamicMap(model, { { "input", inputNode } }, { { "output", prunedNode->output } });
+    auto compiledMap = model::IRCompiledMap(map);
+    VerifyCompiledOutput(map, compiledMap, signal, "DTWDistanceNodeWithPruning");
+}
+
+void TestCompilableDTWBankNode()
+{
+    model::Model model;
+    std::vector<std::vector<double>> prototype1 = { { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 } };
+    std::vector<std::vector<double>> prototype2 = { { 9, 8, 7 }, { 6, 5, 4 }, { 3, 2, 1 }, { 0, 0, 0 } };
+    auto inputNode = model.AddNode<model::InputNode<double>>(3);
+    auto bankNode = model.AddNode<nodes::DTWBankNode<double>>(inputNode->output, std::vector<std::vector<std::vector<double>>>{ prototype1, prototype2 });
+    auto argMinNode = model.AddNode<nodes::ArgMinNode<double>>(bankNode->output);
+    auto map = model::DynamicMap(model, { { "input", inputNode } }, { { "output", model::PortElements<double>{ bankNode->output, argMinNode->val } } });
+    auto compiledMap = model::IRCompiledMap(map);
+
+    // compare output
+    std::vector<std::vector<double>> signal = { { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 }, { 3, 4, 5 }, { 2, 3, 2 }, { 1, 5, 3 }, { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 }, { 7, 4, 2 }, { 5, 2, 1 } };
+    VerifyCompiledOutput(map, compiledMap, signal, "DTWBankNode");
+}
+
 class LabeledPrototype
 {
 public:
@@ -192,6 +249,50 @@ void TestCompilableSumNode()
     VerifyCompiledOutput(map, compiledMap, signal, "SumNode");
 }
 
+void TestCompilableMultiRangeSumNode()
+{
+    // the input to the sum node concatenates two output ports, and is large enough to be compiled as a loop
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(5);
+    auto constantNode = model.AddNode<nodes::ConstantNode<double>>(std::vector<double>{ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 });
+    auto sumNode = model.AddNode<nodes::SumNode<double>>(model::PortElements<double>{ model::PortElements<double>(inputNode->output), model::PortElements<double>(constantNode->output, 1, 5) });
+    auto map = model::DynamicMap(model, { { "input", inputNode } }, { { "output", sumNode->output } });
+    auto compiledMap = model::IRCompiledMap(map);
+
+    // compare output
+    std::vector<std::vector<double>> signal = { { 1, 2, 3, 4, 5 }, { 4, 5, 6, 7, 8 }, { 7, 8, 9, 0, 1 }, { 3, 4, 5, 2, 2 } };
+    VerifyCompiledOutput(map, compiledMap, signal, "MultiRangeSumNode");
+}
+
+void TestCompilableLargeMultiRangeSumNode()
+{
+    // the gathered input of the sum node is too large for the stack, so it goes into a global array
+    const size_t inputSize = 50;
+    const size_t constantSize = 40;
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(inputSize);
+    std::vector<double> constants(constantSize + 1);
+    std::iota(constants.begin(), constants.end(), 1.0);
+    auto constantNode = model.AddNode<nodes::ConstantNode<double>>(constants);
+    auto sumNode = model.AddNode<nodes::SumNode<double>>(model::PortElements<double>{ model::PortElements<double>(inputNode->output), model::PortElements<double>(constantNode->output, 1, constantSize) });
+    auto map = model::DynamicMap(model, { { "input", inputNode } }, { { "output", sumNode->output } });
+    auto compiledMap = model::IRCompiledMap(map);
+
+    std::stringstream ir;
+    compiledMap.WriteCode(ir, emitters::ModuleOutputFormat::ir);
+    testing::ProcessTest("Testing large multi-range input isn't gathered on the stack", ir.str().find("alloca [90 x double]") == std::string::npos);
+
+    // compare output
+    std::vector<std::vector<double>> signal;
+    for (size_t index = 0; index < 4; ++index)
+    {
+        std::vector<double> input(inputSize);
+        std::iota(input.begin(), input.end(), static_cast<double>(index));
+        signal.push_back(input);
+    }
+    VerifyCompiledOutput(map, compiledMap, signal, "LargeMultiRangeSumNode");
+}
+
 void TestCompilableUnaryOperationNode()
 {
     model::Model model;
@@ -221,7 +322,22 @@ void TestCompilableBinaryOperationNode()
     VerifyCompiledOutput(map, compiledMap, signal, "BinaryOpNode");
 }
 
-// Problem: memory corruption for BinaryPredicateNode (probably because of bool foolishness)
+void TestCompilableMultiRangeBinaryOperationNode()
+{
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(6);
+    auto constantNode = model.AddNode<nodes::ConstantNode<double>>(std::vector<double>{ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 });
+    model::PortElements<double> input1{ model::PortElements<double>(inputNode->output), model::PortElements<double>(constantNode->output, 2, 4) };
+    model::PortElements<double> input2{ model::PortElements<double>(constantNode->output), model::PortElements<double>(inputNode->output, 0, 4) };
+    auto testNode = model.AddNode<nodes::BinaryOperationNode<double>>(input1, input2, emitters::BinaryOperationType::coordinatewiseMultiply);
+    auto map = model::DynamicMap(model, { { "input", inputNode } }, { { "output", testNode->output } });
+    auto compiledMap = model::IRCompiledMap(map);
+
+    // compare output
+    std::vector<std::vector<double>> signal = { { 1, 2, 3, 4, 5, 6 }, { 4, 5, 6, 7, 8, 9 }, { 7, 8, 9, 0, 1, 2 }, { 3, 4, 5, 2, 2, 1 } };
+    VerifyCompiledOutput(map, compiledMap, signal, "MultiRangeBinaryOpNode");
+}
+
 void TestCompilableBinaryPredicateNode()
 {
     model::Model model;
@@ -236,8 +352,7 @@ void TestCompilableBinaryPredicateNode()
     // compare output
     std::vector<std::vector<double>> signal = { { 1 }, { 4 }, { 7 }, { 2 }, { 4 }, { 1 }, { 11 }, { 24 }, { 92 }, { 1 } };
 
-    // TODO: Fix VerifyCompiledOutput --- types don't match for booleans
-    PrintCompiledOutput(map, compiledMap, signal, "BinaryPredicateNode");
+    VerifyCompiledOutput(map, compiledMap, signal, "BinaryPredicateNode");
 
     std::cout << "Done with binary predicate" << std::endl;
 }
@@ -272,4 +387,102 @@ void TestCompilableTypeCastNode()
     VerifyCompiledOutput(map, compiledMap, signal, "MultiplexerNode");
     std::cout << "Done with typecast" << std::endl;
 }
-}
\ No newline at end of file
+
+void TestCompilableL2NormNode()
+{
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(3);
+    auto testNode = model.AddNode<nodes::L2NormNode<double>>(inputNode->output);
+    auto map = model::DynamicMap(model, { { "input", inputNode } }, { { "output", testNode->output } });
+    auto compiledMap = model::IRCompiledMap(map);
+
+    // compare output
+    std::vector<std::vector<double>> signal = { { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 }, { 3, 4, 5 }, { 2, 3, 2 }, { 1, 5, 3 }, { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 }, { 7, 4, 2 }, { 5, 2, 1 } };
+    VerifyCompiledOutput(map, compiledMap, signal, "L2NormNode");
+}
+
+void TestCompilableValueSelectorNode()
+{
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(3);
+    auto thresholdNode = model.AddNode<nodes::ConstantNode<double>>(4.0);
+    auto conditionNode = model.AddNode<nodes::BinaryPredicateNode<double>>(model::PortElements<double>(inputNode->output, 0), thresholdNode->output, emitters::BinaryPredicateType::greater);
+    auto constantNode = model.AddNode<nodes::ConstantNode<double>>(std::vector<double>{ 10.0, 20.0 });
+    auto testNode = model.AddNode<nodes::ValueSelectorNode<double>>(conditionNode->output, model::PortElements<double>(inputNode->output, 1, 2), constantNode->output);
+    auto map = model::DynamicMap(model, { { "input", inputNode } }, { { "output", testNode->output } });
+    auto compiledMap = model::IRCompiledMap(map);
+
+    // compare output
+    std::vector<std::vector<double>> signal = { { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 }, { 3, 4, 5 }, { 2, 3, 2 }, { 1, 5, 3 }, { 5, 2, 1 } };
+    VerifyCompiledOutput(map, compiledMap, signal, "ValueSelectorNode");
+}
+
+void TestCompilableDemultiplexerNode()
+{
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<int>>(1);
+    auto constantNode = model.AddNode<nodes::ConstantNode<double>>(7.0);
+    auto testNode = model.AddNode<nodes::DemultiplexerNode<double, int>>(constantNode->output, inputNode->output, 4, 0.0);
+    auto map = model::DynamicMap(model, { { "input", inputNode } }, { { "output", testNode->output } });
+    auto compiledMap = model::IRCompiledMap(map);
+
+    // compare output
+    std::vector<std::vector<int>> signal = { { 0 }, { 1 }, { 3 }, { 2 }, { 1 }, { 0 } };
+    VerifyCompiledOutput(map, compiledMap, signal, "DemultiplexerNode");
+}
+
+void TestCompilableSingleElementThresholdNode()
+{
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(3);
+    auto testNode = model.AddNode<nodes::SingleElementThresholdNode>(inputNode->output, predictors::SingleElementThresholdPredictor(1, 4.5));
+    auto map = model::DynamicMap(model, { { "input", inputNode } }, { { "output", testNode->output } });
+    auto compiledMap = model::IRCompiledMap(map);
+
+    // compare output
+    std::vector<std::vector<double>> signal = { { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 }, { 3, 4, 5 }, { 2, 3, 2 } };
+
+    VerifyCompiledOutput(map, compiledMap, signal, "SingleElementThresholdNode");
+}
+
+void TestCompilableLinearPredictorNode()
+{
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(3);
+    predictors::LinearPredictor predictor(math::ColumnVector<double>{ 1.0, -2.0, 0.5 }, 1.5);
+    auto testNode = model.AddNode<nodes::LinearPredictorNode>(inputNode->output, predictor);
+    auto map = model::DynamicMap(model, { { "input", inputNode } }, { { "output", testNode->output } });
+    auto compiledMap = model::IRCompiledMap(map);
+
+    // compare output
+    std::vector<std::vector<double>> signal = { { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 }, { 3, 4, 5 }, { 2, 3, 2 }, { 1, 5, 3 } };
+    VerifyCompiledOutput(map, compiledMap, signal, "LinearPredictorNode");
+}
+
+void TestCompilableLinearPredictorNodeWeightedElements()
+{
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(3);
+    predictors::LinearPredictor predictor(math::ColumnVector<double>{ 1.0, -2.0, 0.5 }, 1.5);
+    auto testNode = model.AddNode<nodes::LinearPredictorNode>(inputNode->output, predictor);
+    auto map = model::DynamicMap(model, { { "input", inputNode } }, { { "weightedElements", testNode->weightedElements } });
+    auto compiledMap = model::IRCompiledMap(map);
+
+    // compare output
+    std::vector<std::vector<double>> signal = { { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 }, { 3, 4, 5 }, { 2, 3, 2 }, { 1, 5, 3 } };
+    VerifyCompiledOutput(map, compiledMap, signal, "LinearPredictorNodeWeightedElements");
+}
+
+void TestCompilableMovingAverageNode()
+{
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(3);
+    auto testNode = model.AddNode<nodes::MovingAverageNode<double>>(inputNode->output, 3);
+    auto map = model::DynamicMap(model, { { "input", inputNode } }, { { "output", testNode->output } });
+    auto compiledMap = model::IRCompiledMap(map);
+
+    // compare output
+    std::vector<std::vector<double>> signal = { { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 }, { 3, 4, 5 }, { 2, 3, 2 }, { 1, 5, 3 }, { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 }, { 7, 4, 2 }, { 5, 2, 1 } };
+    VerifyCompiledOutput(map, compiledMap, signal, "MovingAverageNode");
+}
+}
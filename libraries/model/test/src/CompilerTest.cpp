@@ -40,6 +40,7 @@
 #include "SumNode.h"
 
 // stl
+#include <algorithm>
 #include <iostream>
 #include <ostream>
 #include <string>
@@ -202,6 +203,71 @@ void TestCompiledMapMove()
     VerifyCompiledOutput(map, compiledMap2, signal, " moved compiled map");
 }
 
+void TestCompiledMapProfile()
+{
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(3);
+    auto accumNode = model.AddNode<nodes::AccumulatorNode<double>>(inputNode->output);
+    auto map = model::DynamicMap(model, { { "input", inputNode } }, { { "output", accumNode->output } });
+    model::IRCompiledMap compiledMap(map, "predict", true, true);
+
+    std::vector<std::vector<double>> signal = { { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 } };
+    for (const auto& input : signal)
+    {
+        compiledMap.SetInputValue(0, input);
+        compiledMap.ComputeOutput<double>(0);
+    }
+
+    size_t accumulatorCalls = 0;
+    for (const auto& counters : compiledMap.GetProfile().GetNodeTypeCounters())
+    {
+        if (counters.nodeType == nodes::AccumulatorNode<double>::GetTypeName())
+        {
+            accumulatorCalls = counters.callCount;
+        }
+    }
+    testing::ProcessTest("Testing compiled map profile call counts", accumulatorCalls == signal.size());
+
+    compiledMap.ResetProfile();
+    auto counters = compiledMap.GetProfile().GetNodeTypeCounters();
+    testing::ProcessTest("Testing compiled map profile reset", std::all_of(counters.begin(), counters.end(), [](const model::NodePerformanceCounters& c) { return c.callCount == 0; }));
+}
+
+void TestCompiledMapMultipleInputsOutputs()
+{
+    model::Model model;
+    auto inputNode1 = model.AddNode<model::InputNode<double>>(3);
+    auto inputNode2 = model.AddNode<model::InputNode<double>>(3);
+    auto sharedNode = model.AddNode<nodes::BinaryOperationNode<double>>(inputNode1->output, inputNode2->output, emitters::BinaryOperationType::add);
+    auto sumNode = model.AddNode<nodes::SumNode<double>>(sharedNode->output);
+    auto productNode = model.AddNode<nodes::BinaryOperationNode<double>>(sharedNode->output, inputNode2->output, emitters::BinaryOperationType::coordinatewiseMultiply);
+    auto accumNode = model.AddNode<nodes::AccumulatorNode<double>>(sharedNode->output);
+
+    // The last two outputs share ports with an input and with another output
+    auto map = model::DynamicMap(model, { { "input1", inputNode1 }, { "input2", inputNode2 } }, { { "sum", sumNode->output }, { "product", productNode->output }, { "accum", accumNode->output }, { "passthrough", inputNode1->output }, { "sum2", sumNode->output } });
+    model::IRCompiledMap compiledMap(map);
+    auto header = compiledMap.GetCodeHeaderString();
+    testing::ProcessTest("Testing multiple input/output compiled map header", header.find("#include <stdint.h>") == 0 && header.find("double input1[3]") != std::string::npos && header.find("double output4[1]") != std::string::npos);
+
+    std::vector<std::vector<double>> signal1 = { { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 }, { 3, 4, 5 } };
+    std::vector<std::vector<double>> signal2 = { { 2, 2, 2 }, { 1, 0, -1 }, { 5, 2, 1 }, { 1, 5, 3 } };
+    bool ok = true;
+    for (size_t index = 0; index < signal1.size(); ++index)
+    {
+        map.SetInputValue(0, signal1[index]);
+        map.SetInputValue(1, signal2[index]);
+        compiledMap.SetInputValue(0, signal1[index]);
+        compiledMap.SetInputValue(1, signal2[index]);
+
+        // The accumulator is stateful, so each output must be read only once per input from the interpreted map
+        for (int outputIndex = 0; outputIndex < 5; ++outputIndex)
+        {
+            ok = ok && testing::IsEqual(map.ComputeOutput<double>(outputIndex), compiledMap.ComputeOutput<double>(outputIndex));
+        }
+    }
+    testing::ProcessTest("Testing multiple input/output compiled map", ok);
+}
+
 typedef void (*FnInputOutput)(double*, double*);
 void TestBinaryVector(bool expanded, bool runJit)
 {
@@ -16,8 +16,12 @@
 #include "PortElements.h"
 
 // nodes
+#include "BinaryOperationNode.h"
+#include "ConstantNode.h"
 #include "ExtremalValueNode.h"
+#include "LinearPredictorNode.h"
 #include "MovingAverageNode.h"
+#include "UnaryOperationNode.h"
 
 // common
 #include "LoadModel.h" // for RegisterNodeTypes
@@ -29,6 +33,7 @@
 #include "testing.h"
 
 // stl
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <sstream>
@@ -100,6 +105,33 @@ void TestDynamicMapComputeDataVector()
     testing::ProcessTest("Testing map compute", testing::IsEqual(resultValues[0], 8.5) && testing::IsEqual(resultValues[1], 10.5));
 }
 
+void TestDynamicMapClone()
+{
+    auto model = GetSimpleModel();
+    auto inputNodes = model.GetNodesByType<model::InputNode<double>>();
+    auto outputNodes = model.GetNodesByType<model::OutputNode<double>>();
+    auto map = model::DynamicMap(model, { { "doubleInput", inputNodes[0] } }, { { "doubleOutput", outputNodes[0]->output } });
+    auto clone = map.Clone();
+
+    auto input = std::vector<std::vector<double>>{ { 1.0, 2.0, 3.0 },
+                                                   { 4.0, 5.0, 6.0 },
+                                                   { 7.0, 8.0, 9.0 },
+                                                   { 10.0, 11.0, 12.0 } };
+
+    // the model has a moving average, so the results are only correct if the two maps don't share its state
+    std::vector<double> resultValues;
+    std::vector<double> cloneResultValues;
+    for (const auto& inVec : input)
+    {
+        map.SetInputValue("doubleInput", inVec);
+        resultValues = map.ComputeOutput<double>("doubleOutput");
+        clone.SetInputValue("doubleInput", inVec);
+        cloneResultValues = clone.ComputeOutput<double>("doubleOutput");
+    }
+
+    testing::ProcessTest("Testing map clone", testing::IsEqual(resultValues[0], 8.5) && testing::IsEqual(resultValues[1], 10.5) && testing::IsEqual(cloneResultValues, resultValues));
+}
+
 void TestDynamicMapRefine()
 {
     auto model = GetSimpleModel();
@@ -132,6 +164,98 @@ void TestDynamicMapRefine()
     testing::ProcessTest("Testing refined map compute", testing::IsEqual(resultValues1, resultValues2));
 }
 
+void TestDynamicMapRefinePrunesUnusedOutputs()
+{
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(3);
+    predictors::LinearPredictor predictor(math::ColumnVector<double>{ 1.0, 2.0, 3.0 }, 1.0);
+    auto predictorNode = model.AddNode<nodes::LinearPredictorNode>(inputNode->output, predictor);
+    auto map = model::DynamicMap(model, { { "input", inputNode } }, { { "output", predictorNode->output } });
+
+    // refining the predictor also produces the weighted elements, which nothing uses
+    model::TransformContext context;
+    map.Refine(context);
+
+    auto outputNode = map.GetOutput(0).GetRanges()[0].ReferencedPort()->GetNode();
+    bool allNodesUsed = true;
+    map.GetModel().Visit([outputNode, &allNodesUsed](const model::Node& node) {
+        if (&node != outputNode && node.GetDependentNodes().empty())
+        {
+            allNodesUsed = false;
+        }
+    });
+    testing::ProcessTest("Testing refined map pruning", allNodesUsed);
+
+    map.SetInputValue("input", std::vector<double>{ 1.0, 1.0, 1.0 });
+    auto result = map.ComputeOutput<double>("output");
+    testing::ProcessTest("Testing pruned map compute", testing::IsEqual(result[0], 7.0));
+}
+
+// returns the number of binary operation nodes of a given kind in a map
+size_t GetNumBinaryOperations(const model::DynamicMap& map, emitters::BinaryOperationType operation)
+{
+    auto nodes = map.GetModel().GetNodesByType<nodes::BinaryOperationNode<double>>();
+    return std::count_if(nodes.begin(), nodes.end(), [operation](const nodes::BinaryOperationNode<double>* node) { return node->GetOperation() == operation; });
+}
+
+void TestDynamicMapOptimize()
+{
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(3);
+    auto onesNode = model.AddNode<nodes::ConstantNode<double>>(std::vector<double>{ 1.0, 1.0, 1.0 });
+    auto offsetNode = model.AddNode<nodes::ConstantNode<double>>(std::vector<double>{ 1.0, 2.0, 3.0 });
+    auto scaleNode = model.AddNode<nodes::ConstantNode<double>>(std::vector<double>{ 2.0, 2.0, 2.0 });
+    auto squaresNode = model.AddNode<nodes::ConstantNode<double>>(std::vector<double>{ 4.0, 9.0, 16.0 });
+    auto sqrtNode = model.AddNode<nodes::UnaryOperationNode<double>>(squaresNode->output, emitters::UnaryOperationType::sqrt);
+
+    // ((x * 1 + offset) + 1) / 2 + sqrt(squares), which simplifies to ((x + offset) + 1) * 0.5 + roots, since the reciprocal of 2 is exact
+    auto multiplyNode = model.AddNode<nodes::BinaryOperationNode<double>>(inputNode->output, onesNode->output, emitters::BinaryOperationType::coordinatewiseMultiply);
+    auto addNode1 = model.AddNode<nodes::BinaryOperationNode<double>>(multiplyNode->output, offsetNode->output, emitters::BinaryOperationType::add);
+    auto addNode2 = model.AddNode<nodes::BinaryOperationNode<double>>(addNode1->output, onesNode->output, emitters::BinaryOperationType::add);
+    auto divideNode = model.AddNode<nodes::BinaryOperationNode<double>>(addNode2->output, scaleNode->output, emitters::BinaryOperationType::coordinatewiseDivide);
+    auto addNode3 = model.AddNode<nodes::BinaryOperationNode<double>>(divideNode->output, sqrtNode->output, emitters::BinaryOperationType::add);
+    auto map = model::DynamicMap(model, { { "input", inputNode } }, { { "output", addNode3->output } });
+
+    std::vector<double> input = { 1.0, 2.0, 3.0 };
+    map.SetInputValue("input", input);
+    auto originalResult = map.ComputeOutput<double>("output");
+
+    model::TransformContext context;
+    auto optimizedMap = map.Clone();
+    optimizedMap.Optimize(context);
+    optimizedMap.SetInputValue("input", input);
+    auto optimizedResult = optimizedMap.ComputeOutput<double>("output");
+
+    auto numOperations = optimizedMap.GetModel().GetNodesByType<nodes::BinaryOperationNode<double>>().size();
+    auto numDivisions = GetNumBinaryOperations(optimizedMap, emitters::BinaryOperationType::coordinatewiseDivide);
+    auto numUnaryOperations = optimizedMap.GetModel().GetNodesByType<nodes::UnaryOperationNode<double>>().size();
+    testing::ProcessTest("Testing optimized map node count", numOperations == 4 && numDivisions == 0 && numUnaryOperations == 0);
+    testing::ProcessTest("Testing optimized map compute", testing::IsEqual(originalResult, optimizedResult, 0.0) && testing::IsEqual(optimizedResult, std::vector<double>{ 3.5, 5.5, 7.5 }));
+
+    // with relaxed precision, the additions of constants are merged into (x + (offset + 1)) * 0.5 + roots
+    model::TransformContext relaxedContext;
+    relaxedContext.SetRelaxedPrecisionAllowed(true);
+    auto relaxedMap = map.Clone();
+    relaxedMap.Optimize(relaxedContext);
+    relaxedMap.SetInputValue("input", input);
+    auto relaxedResult = relaxedMap.ComputeOutput<double>("output");
+
+    auto numRelaxedOperations = relaxedMap.GetModel().GetNodesByType<nodes::BinaryOperationNode<double>>().size();
+    testing::ProcessTest("Testing relaxed-precision optimized map node count", numRelaxedOperations == 3);
+    testing::ProcessTest("Testing relaxed-precision optimized map compute", testing::IsEqual(relaxedResult, std::vector<double>{ 3.5, 5.5, 7.5 }));
+
+    // division by a constant whose reciprocal isn't exact is kept, unless relaxed precision is allowed
+    model::Model divisionModel;
+    auto divisionInputNode = divisionModel.AddNode<model::InputNode<double>>(3);
+    auto divisorNode = divisionModel.AddNode<nodes::ConstantNode<double>>(std::vector<double>{ 3.0, 3.0, 3.0 });
+    auto divisionNode = divisionModel.AddNode<nodes::BinaryOperationNode<double>>(divisionInputNode->output, divisorNode->output, emitters::BinaryOperationType::coordinatewiseDivide);
+    auto divisionMap = model::DynamicMap(divisionModel, { { "input", divisionInputNode } }, { { "output", divisionNode->output } });
+    auto relaxedDivisionMap = divisionMap.Clone();
+    divisionMap.Optimize(context);
+    relaxedDivisionMap.Optimize(relaxedContext);
+    testing::ProcessTest("Testing optimized map keeps inexact division", GetNumBinaryOperations(divisionMap, emitters::BinaryOperationType::coordinatewiseDivide) == 1 && GetNumBinaryOperations(relaxedDivisionMap, emitters::BinaryOperationType::coordinatewiseDivide) == 0);
+}
+
 void TestDynamicMapSerialization()
 {
     auto model = GetSimpleModel();
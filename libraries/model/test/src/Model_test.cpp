@@ -8,6 +8,7 @@
 #include "InputNode.h"
 #include "InputPort.h"
 #include "Model.h"
+#include "ModelProfile.h"
 #include "ModelTransformer.h"
 #include "OutputNode.h"
 #include "OutputPort.h"
@@ -417,4 +418,36 @@ void TestCustomRefine()
     auto size2 = model2.Size();
     testing::ProcessTest("testing custom refine function", model1.Size() == 4 && model2.Size() == 3);
 }
+
+void TestModelProfile()
+{
+    auto model = GetSimpleModel();
+    auto outputNodes = model.GetNodesByType<model::OutputNode<double>>();
+    auto inputNodes = model.GetNodesByType<model::InputNode<double>>();
+
+    model::ModelProfile profile;
+    model.SetProfile(&profile);
+    for (int index = 0; index < 2; ++index)
+    {
+        inputNodes[0]->SetInput({ 1.0, 2.0, 3.0 });
+        model.ComputeOutput(outputNodes[0]->output);
+    }
+
+    size_t movingAverageCalls = 0;
+    size_t movingAverageBytes = 0;
+    size_t totalCalls = 0;
+    for (const auto& counters : profile.GetNodeTypeCounters())
+    {
+        if (counters.nodeType == nodes::MovingAverageNode<double>::GetTypeName())
+        {
+            movingAverageCalls = counters.callCount;
+            movingAverageBytes = counters.bytesTouched;
+        }
+        totalCalls += counters.callCount;
+    }
+
+    // 2 moving average nodes, each with a scalar input and output, computed twice
+    testing::ProcessTest("Testing model profile call counts", movingAverageCalls == 4 && totalCalls == 2 * model.Size());
+    testing::ProcessTest("Testing model profile bytes touched", movingAverageBytes == 4 * 2 * sizeof(double));
+}
 }
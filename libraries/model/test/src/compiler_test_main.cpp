@@ -19,6 +19,8 @@ using namespace ell::emitters;
 void TestIRCompiler()
 {
     TestCompiledMapMove();
+    TestCompiledMapProfile();
+    TestCompiledMapMultipleInputsOutputs();
     TestBinaryVector(true);
     TestBinaryVector(false);
     TestBinaryVector(true, true);
@@ -43,13 +45,25 @@ void TestIRCompiler()
     TestCompilableDotProductNode();
     TestCompilableDelayNode();
     TestCompilableDTWDistanceNode();
+    TestCompilableDTWDistanceNodeWithPruning();
+    TestCompilableDTWBankNode();
     TestCompilableMulticlassDTW();
     TestCompilableSumNode();
+    TestCompilableMultiRangeSumNode();
+    TestCompilableLargeMultiRangeSumNode();
     TestCompilableUnaryOperationNode();
     TestCompilableBinaryOperationNode();
-    //    TestCompilableBinaryPredicateNode(); // Fails
+    TestCompilableMultiRangeBinaryOperationNode();
+    TestCompilableBinaryPredicateNode();
     TestCompilableMultiplexerNode();
     TestCompilableTypeCastNode();
+    TestCompilableL2NormNode();
+    TestCompilableValueSelectorNode();
+    TestCompilableDemultiplexerNode();
+    TestCompilableSingleElementThresholdNode();
+    TestCompilableLinearPredictorNode();
+    TestCompilableLinearPredictorNodeWeightedElements();
+    TestCompilableMovingAverageNode();
 }
 
 int main(int argc, char* argv[])
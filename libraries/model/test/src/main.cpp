@@ -30,6 +30,7 @@ int main()
 
         TestCopyModel();
         TestRefineSplitOutputs();
+        TestModelProfile();
 
         // PortElements tests
         TestSlice();
@@ -39,7 +40,10 @@ int main()
         TestDynamicMapCreate();
         TestDynamicMapCompute();
         TestDynamicMapComputeDataVector();
+        TestDynamicMapClone();
         TestDynamicMapRefine();
+        TestDynamicMapRefinePrunesUnusedOutputs();
+        TestDynamicMapOptimize();
         TestDynamicMapSerialization();
 
         TestCustomRefine();
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "ConstantNode.h"
+
 // model
 #include "CompilableNodeUtilities.h"
 #include "CompilableNode.h"
@@ -26,7 +28,10 @@
 #include "TypeName.h"
 
 // stl
+#include <algorithm>
+#include <cmath>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace ell
@@ -81,6 +86,10 @@ namespace nodes
         /// <summary> Makes a copy of this node in the model being constructed by the transformer </summary>
         virtual void Copy(model::ModelTransformer& transformer) const override;
 
+        /// <summary> Folds this node into a constant if both inputs are constant, removes it if one input is an identity element,
+        /// merges it with a preceding operation of the same kind on a constant, or turns division by a constant into multiplication </summary>
+        virtual bool Optimize(model::ModelTransformer& transformer) const override;
+
         /// <summary> Gets the operation performed by this node </summary>
         ///
         /// <returns> The operation </returns>
@@ -96,7 +105,8 @@ namespace nodes
         void CompileBinaryOperationExpanded(model::IRMapCompiler& compiler);
 
         template <typename Operation>
-        std::vector<ValueType> ComputeOutput(Operation&& function) const;
+        std::vector<ValueType> ComputeOutput(const std::vector<ValueType>& input1, const std::vector<ValueType>& input2, Operation&& function) const;
+        std::vector<ValueType> ComputeOutput(const std::vector<ValueType>& input1, const std::vector<ValueType>& input2) const;
 
         // Inputs
         model::InputPort<ValueType> _input1;
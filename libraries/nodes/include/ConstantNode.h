@@ -112,6 +112,15 @@ namespace nodes
     ///
     /// <returns> The node added to the model. </returns>
     ConstantNode<double>* AddNodeToModelTransformer(const model::PortElements<double>& input, const predictors::ConstantPredictor& predictor, model::ModelTransformer& transformer);
+
+    /// <summary> Gets the values of a set of port elements, if all of them are outputs of constant nodes. </summary>
+    ///
+    /// <param name="elements"> The port elements. </param>
+    /// <param name="values"> [out] The values of the elements, if they are all constant. </param>
+    ///
+    /// <returns> true if every element is the output of a ConstantNode. </returns>
+    template <typename ValueType>
+    bool TryGetConstantValues(const model::PortElements<ValueType>& elements, std::vector<ValueType>& values);
 }
 }
 
@@ -0,0 +1,123 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DTWBankNode.h (nodes)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "DTWDistanceNode.h"
+
+// model
+#include "CompilableNode.h"
+#include "IRMapCompiler.h"
+#include "InputPort.h"
+#include "MapCompiler.h"
+#include "ModelTransformer.h"
+#include "Node.h"
+#include "OutputPort.h"
+#include "PortElements.h"
+
+// utilities
+#include "TypeName.h"
+
+// stl
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary> A node that computes the dynamic time-warping distances between the recent history of its input
+    /// and each of a bank of prototypes, as DTWDistanceNode does for a single prototype. All of the prototypes
+    /// are packed into one buffer, and all of their dynamic programming columns into another, so that each input
+    /// sample is processed in a single sweep over contiguous memory. The output has one distance per prototype,
+    /// and can be fed directly to an ArgMinNode. </summary>
+    template <typename ValueType>
+    class DTWBankNode : public model::CompilableNode
+    {
+    public:
+        /// @name Input and Output Ports
+        /// @{
+        static constexpr const char* inputPortName = "input";
+        static constexpr const char* outputPortName = "output";
+        const model::InputPort<ValueType>& input = _input;
+        const model::OutputPort<ValueType>& output = _output;
+        /// @}
+
+        /// <summary> Default Constructor </summary>
+        DTWBankNode();
+
+        /// <summary> Constructor </summary>
+        ///
+        /// <param name="input"> The signal to compare to the prototypes </param>
+        /// <param name="prototypes"> The prototypes, each a sequence of rows with the same size as the input </param>
+        DTWBankNode(const model::PortElements<ValueType>& input, const std::vector<std::vector<std::vector<ValueType>>>& prototypes);
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ValueType>("DTWBankNode"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Indicates that the output of this node depends on the inputs it computed before. </summary>
+        virtual bool HasState() const override { return true; }
+
+        /// <summary> Adds an object's properties to an `Archiver` </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
+        virtual void WriteToArchive(utilities::Archiver& archiver) const override;
+
+        /// <summary> Sets the internal state of the object according to the archiver passed in </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to get state from </param>
+        virtual void ReadFromArchive(utilities::Unarchiver& archiver) override;
+
+        /// <summary> Makes a copy of this node in the model being constructed by the transformer </summary>
+        ///
+        /// <param name="transformer"> The `ModelTransformer` currently copying the model </param>
+        virtual void Copy(model::ModelTransformer& transformer) const override;
+
+        /// <summary> Gets the number of prototypes. </summary>
+        ///
+        /// <returns> The number of prototypes. </returns>
+        size_t NumPrototypes() const { return _prototypeLengths.size(); }
+
+        /// <summary> Gets the prototypes. </summary>
+        ///
+        /// <returns> The prototypes. </returns>
+        std::vector<std::vector<std::vector<ValueType>>> GetPrototypes() const;
+
+    protected:
+        virtual void Compute() const override;
+        void Reset() const;
+        virtual void Compile(model::IRMapCompiler& compiler) override;
+
+    private:
+        void Initialize();
+        size_t GetStateOffset(size_t prototypeIndex) const { return _rowOffsets[prototypeIndex] + prototypeIndex; }
+
+        model::InputPort<ValueType> _input;
+        model::OutputPort<ValueType> _output;
+
+        size_t _sampleDimension = 0;
+        std::vector<size_t> _prototypeLengths;
+        std::vector<ValueType> _prototypeData; // the rows of all prototypes, stored contiguously
+        std::vector<size_t> _rowOffsets; // the index of the first row of each prototype, followed by the total number of rows
+        std::vector<double> _prototypeVariances;
+
+        mutable std::vector<ValueType> _inputSample;
+        mutable std::vector<ValueType> _distances;
+        mutable std::vector<ValueType> _d; // the dynamic programming column of each prototype, preceded by a zero entry
+    };
+}
+}
+
+#include "../tcc/DTWBankNode.tcc"
@@ -32,7 +32,15 @@ namespace ell
 {
 namespace nodes
 {
-    /// <summary> A node that computes the dynamic time-warping distance between its inputs </summary>
+    /// <summary> A node that computes the dynamic time-warping distance between the recent history of its input
+    /// and a prototype, one input sample at a time. The prototype is stored contiguously, so the distance between
+    /// the input sample and each prototype row is computed over a single block of memory.
+    ///
+    /// An optional pruning threshold skips the distance computation for alignments that can no longer produce a
+    /// distance below the threshold. Each input sample is compared to the bounding box of the prototype rows (an
+    /// LB_Keogh-style envelope with an unconstrained warping window), which gives a lower bound on its distance to
+    /// every row. Distances at or below the threshold are exact; larger distances are reported as the largest
+    /// ValueType value. </summary>
     template <typename ValueType>
     class DTWDistanceNode : public model::CompilableNode
     {
@@ -52,7 +60,8 @@ namespace nodes
         ///
         /// <param name="input"> The signals to compare to the prototype </param>
         /// <param name="prototype"> The prototype </param>
-        DTWDistanceNode(const model::PortElements<ValueType>& input, const std::vector<std::vector<ValueType>>& prototype);
+        /// <param name="pruningThreshold"> The largest (normalized) distance of interest, or zero to compute every distance exactly </param>
+        DTWDistanceNode(const model::PortElements<ValueType>& input, const std::vector<std::vector<ValueType>>& prototype, double pruningThreshold = 0);
 
         /// <summary> Gets the name of this type (for serialization). </summary>
         ///
@@ -64,6 +73,9 @@ namespace nodes
         /// <returns> The name of this type. </returns>
         virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
 
+        /// <summary> Indicates that the output of this node depends on the inputs it computed before. </summary>
+        virtual bool HasState() const override { return true; }
+
         /// <summary> Adds an object's properties to an `Archiver` </summary>
         ///
         /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
@@ -86,15 +98,21 @@ namespace nodes
 
         std::vector<std::vector<ValueType>> GetPrototype() const { return _prototype; }
 
+        /// <summary> Gets the pruning threshold. </summary>
+        ///
+        /// <returns> The pruning threshold, or zero if pruning is disabled. </returns>
+        double GetPruningThreshold() const { return _pruningThreshold; }
+
     protected:
         virtual void Compute() const override;
         void Reset() const;
         virtual void Compile(model::IRMapCompiler& compiler) override;
 
     private:
-        std::vector<ValueType> GetPrototypeData() const;
-        void CompileDTWLoop(model::IRMapCompiler& compiler);
-        void CompileDTWExpanded(model::IRMapCompiler& compiler);
+        std::vector<ValueType> GetPrototypeData() const { return _prototypeData; }
+        bool IsPruning() const { return _pruningThreshold > 0; }
+        void EmitRowDistance(model::IRMapCompiler& compiler, llvm::Value* pInput, llvm::Value* pPrototype, llvm::Value* rowIndex, llvm::Value* pDistance);
+        llvm::Value* EmitEnvelopeDistance(model::IRMapCompiler& compiler, llvm::Value* pInput);
 
         model::InputPort<ValueType> _input;
         model::OutputPort<ValueType> _output;
@@ -102,9 +120,13 @@ namespace nodes
         size_t _sampleDimension;
         size_t _prototypeLength;
         std::vector<std::vector<ValueType>> _prototype;
-        // double _threshold;
+        std::vector<ValueType> _prototypeData; // the prototype rows, stored contiguously
+        std::vector<ValueType> _lowerEnvelope; // the minimum of each channel over the prototype rows
+        std::vector<ValueType> _upperEnvelope; // the maximum of each channel over the prototype rows
         double _prototypeVariance;
+        double _pruningThreshold = 0;
 
+        mutable std::vector<ValueType> _inputSample;
         mutable std::vector<ValueType> _d;
         mutable std::vector<int> _s;
         mutable int _currentTime;
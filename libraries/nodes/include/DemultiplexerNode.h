@@ -14,7 +14,10 @@
 #include "TypeCastNode.h"
 
 // model
+#include "CompilableNode.h"
+#include "CompilableNodeUtilities.h"
 #include "InputPort.h"
+#include "IRMapCompiler.h"
 #include "Node.h"
 #include "OutputPort.h"
 
@@ -34,7 +37,7 @@ namespace nodes
     /// <summary> A node that routes its scalar input to one element of its outputs, depending on a separate selector input. The element at the index
     /// provided by `selector` is set to the input value, and the rest are set to a default value. </summary>
     template <typename ValueType, typename SelectorType>
-    class DemultiplexerNode : public model::Node
+    class DemultiplexerNode : public model::CompilableNode
     {
     public:
         /// @name Input and Output Ports
@@ -84,6 +87,7 @@ namespace nodes
 
     protected:
         virtual void Compute() const override;
+        virtual void Compile(model::IRMapCompiler& compiler) override;
 
     private:
         // Inputs
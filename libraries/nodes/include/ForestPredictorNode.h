@@ -20,6 +20,7 @@
 
 // stl
 #include <string>
+#include <vector>
 
 namespace ell
 {
@@ -56,6 +57,11 @@ namespace nodes
         /// <param name="forest"> The forest predictor. </param>
         ForestPredictorNode(const model::PortElements<double>& input, const ForestPredictor& forest);
 
+        /// <summary> Gets the forest predictor. </summary>
+        ///
+        /// <returns> The forest predictor. </returns>
+        const ForestPredictor& GetForest() const { return _forest; }
+
         /// <summary> Gets the name of this type (for serialization). </summary>
         ///
         /// <returns> The name of this type. </returns>
@@ -98,6 +104,11 @@ namespace nodes
 
         // Forest
         ForestPredictor _forest;
+
+        // Buffers reused by Compute
+        mutable std::vector<double> _inputBuffer;
+        mutable std::vector<double> _treeOutputsBuffer;
+        mutable std::vector<bool> _edgeIndicatorBuffer;
     };
 
     /// <summary> Defines an alias representing a simple forest node, which holds a forest with a SingleElementThresholdPredictor as the split rule and ConstantPredictors on the edges. </summary>
@@ -8,7 +8,10 @@
 
 #pragma once
 
+#include "CompilableNode.h"
+#include "CompilableNodeUtilities.h"
 #include "InputPort.h"
+#include "IRMapCompiler.h"
 #include "ModelTransformer.h"
 #include "Node.h"
 #include "OutputPort.h"
@@ -27,7 +30,7 @@ namespace nodes
 {
     /// <summary> A node that takes a vector input and returns its magnitude </summary>
     template <typename ValueType>
-    class L2NormNode : public model::Node
+    class L2NormNode : public model::CompilableNode
     {
     public:
         /// @name Input and Output Ports
@@ -70,6 +73,7 @@ namespace nodes
 
     protected:
         virtual void Compute() const override;
+        virtual void Compile(model::IRMapCompiler& compiler) override;
 
     private:
         // Inputs
@@ -9,6 +9,9 @@
 #pragma once
 
 // model
+#include "CompilableNode.h"
+#include "CompilableNodeUtilities.h"
+#include "IRMapCompiler.h"
 #include "Model.h"
 #include "ModelTransformer.h"
 #include "Node.h"
@@ -24,7 +27,7 @@ namespace ell
 namespace nodes
 {
     /// <summary> A node that represents a linear predictor. </summary>
-    class LinearPredictorNode : public model::Node
+    class LinearPredictorNode : public model::CompilableNode
     {
     public:
         /// @name Input and Output Ports
@@ -76,6 +79,7 @@ namespace nodes
 
     protected:
         virtual void Compute() const override;
+        virtual void Compile(model::IRMapCompiler& compiler) override;
 
     private:
         // Inputs
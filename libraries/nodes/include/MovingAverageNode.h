@@ -14,7 +14,10 @@
 #include "DelayNode.h"
 
 // model
+#include "CompilableNode.h"
+#include "CompilableNodeUtilities.h"
 #include "InputPort.h"
+#include "IRMapCompiler.h"
 #include "ModelTransformer.h"
 #include "Node.h"
 #include "OutputPort.h"
@@ -33,7 +36,7 @@ namespace nodes
 {
     /// <summary> A node that takes a vector input and returns its mean over some window of time. </summary>
     template <typename ValueType>
-    class MovingAverageNode : public model::Node
+    class MovingAverageNode : public model::CompilableNode
     {
     public:
         /// @name Input and Output Ports
@@ -62,6 +65,9 @@ namespace nodes
         /// <returns> The name of this type. </returns>
         virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
 
+        /// <summary> Indicates that the output of this node depends on the inputs it computed before. </summary>
+        virtual bool HasState() const override { return true; }
+
         /// <summary> Adds an object's properties to an `Archiver` </summary>
         ///
         /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
@@ -80,6 +86,7 @@ namespace nodes
 
     protected:
         virtual void Compute() const override;
+        virtual void Compile(model::IRMapCompiler& compiler) override;
 
     private:
         // Inputs
@@ -9,6 +9,9 @@
 #pragma once
 
 // model
+#include "CompilableNode.h"
+#include "CompilableNodeUtilities.h"
+#include "IRMapCompiler.h"
 #include "Model.h"
 #include "ModelTransformer.h"
 #include "Node.h"
@@ -21,7 +24,7 @@ namespace ell
 namespace nodes
 {
     /// <summary> A node that represents a single-element threshold predictor. </summary>
-    class SingleElementThresholdNode : public model::Node
+    class SingleElementThresholdNode : public model::CompilableNode
     {
     public:
         /// @name Input and Output Ports
@@ -71,6 +74,7 @@ namespace nodes
 
     protected:
         virtual void Compute() const override;
+        virtual void Compile(model::IRMapCompiler& compiler) override;
 
     private:
         // Inputs
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "ConstantNode.h"
+
 // model
 #include "CompilableNode.h"
 #include "IRMapCompiler.h"
@@ -78,6 +80,9 @@ namespace nodes
         /// <summary> Makes a copy of this node in the model being constructed by the transformer </summary>
         virtual void Copy(model::ModelTransformer& transformer) const override;
 
+        /// <summary> Folds this node into a constant if its input is constant </summary>
+        virtual bool Optimize(model::ModelTransformer& transformer) const override;
+
         /// <summary> Gets the operation performed by this node </summary>
         ///
         /// <returns> The operation </returns>
@@ -93,7 +98,8 @@ namespace nodes
         void CompileUnaryOperationExpanded(model::IRMapCompiler& compiler);
 
         template <typename Operation>
-        std::vector<ValueType> ComputeOutput(Operation&& function) const;
+        std::vector<ValueType> ComputeOutput(const std::vector<ValueType>& input, Operation&& function) const;
+        std::vector<ValueType> ComputeOutput(const std::vector<ValueType>& input) const;
 
         // Inputs
         model::InputPort<ValueType> _input;
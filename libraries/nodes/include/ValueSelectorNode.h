@@ -8,7 +8,10 @@
 
 #pragma once
 
+#include "CompilableNode.h"
+#include "CompilableNodeUtilities.h"
 #include "InputPort.h"
+#include "IRMapCompiler.h"
 #include "Node.h"
 #include "OutputPort.h"
 
@@ -27,7 +30,7 @@ namespace nodes
 {
     /// <summary> An example node that selects from one of two input values depending on a third input </summary>
     template <typename ValueType>
-    class ValueSelectorNode : public model::Node
+    class ValueSelectorNode : public model::CompilableNode
     {
     public:
         /// @name Input and Output Ports
@@ -77,6 +80,7 @@ namespace nodes
 
     protected:
         virtual void Compute() const override;
+        virtual void Compile(model::IRMapCompiler& compiler) override;
 
     private:
         // Inputs
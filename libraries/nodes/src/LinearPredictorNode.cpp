@@ -27,12 +27,12 @@ namespace ell
 namespace nodes
 {
     LinearPredictorNode::LinearPredictorNode()
-        : Node({ &_input }, { &_output, &_weightedElements }), _input(this, {}, inputPortName), _output(this, outputPortName, 1), _weightedElements(this, weightedElementsPortName, 0)
+        : CompilableNode({ &_input }, { &_output, &_weightedElements }), _input(this, {}, inputPortName), _output(this, outputPortName, 1), _weightedElements(this, weightedElementsPortName, 0)
     {
     }
 
     LinearPredictorNode::LinearPredictorNode(const model::PortElements<double>& input, const predictors::LinearPredictor& predictor)
-        : Node({ &_input }, { &_output, &_weightedElements }), _input(this, input, inputPortName), _output(this, outputPortName, 1), _weightedElements(this, weightedElementsPortName, input.Size()), _predictor(predictor)
+        : CompilableNode({ &_input }, { &_output, &_weightedElements }), _input(this, input, inputPortName), _output(this, outputPortName, 1), _weightedElements(this, weightedElementsPortName, input.Size()), _predictor(predictor)
     {
         assert(input.Size() == predictor.Size());
     }
@@ -78,6 +78,43 @@ namespace nodes
         return true;
     }
 
+    void LinearPredictorNode::Compile(model::IRMapCompiler& compiler)
+    {
+        compiler.NewBlockRegion(*this);
+
+        auto inputPort = GetInputPorts()[0];
+        auto outputPort = GetOutputPorts()[0];
+        auto weightedElementsPort = GetOutputPorts()[1];
+        auto& function = compiler.GetCurrentFunction();
+
+        emitters::Variable* pWeightsVar = compiler.Variables().AddVariable<emitters::LiteralVectorVariable<double>>(_predictor.GetWeights().ToArray());
+        llvm::Value* pWeights = compiler.EnsureEmitted(*pWeightsVar);
+        llvm::Value* pInput = compiler.EnsureContiguousInput(inputPort);
+        llvm::Value* pResult = compiler.EnsureEmitted(outputPort);
+
+        // the weighted elements are only written if some node consumes them or the map outputs them
+        llvm::Value* pWeightedElements = compiler.IsPortUsed(weightedElementsPort) ? compiler.EnsureEmitted(weightedElementsPort) : nullptr;
+
+        // compute the dot product, and optionally the weighted elements, in a single loop, then add the bias
+        llvm::Value* pSum = function.Variable(emitters::VariableType::Double, "dotProduct");
+        function.Store(pSum, function.Literal(0.0));
+        auto forLoop = function.ForLoop();
+        forLoop.Begin(static_cast<int>(inputPort->Size()));
+        {
+            auto i = forLoop.LoadIterationVariable();
+            llvm::Value* pProduct = function.Operator(emitters::TypedOperator::multiplyFloat, function.ValueAt(pWeights, i), function.ValueAt(pInput, i));
+            if (pWeightedElements != nullptr)
+            {
+                function.SetValueAt(pWeightedElements, i, pProduct);
+            }
+            function.OperationAndUpdate(pSum, emitters::TypedOperator::addFloat, pProduct);
+        }
+        forLoop.End();
+        function.Store(pResult, function.Operator(emitters::TypedOperator::addFloat, function.Load(pSum), function.Literal(_predictor.GetBias())));
+
+        compiler.TryMergeRegion(*this);
+    }
+
     void LinearPredictorNode::Compute() const
     {
         auto inputDataVector = LinearPredictor::DataVectorType(_input.GetIterator());
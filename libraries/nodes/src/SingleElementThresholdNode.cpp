@@ -18,12 +18,12 @@ namespace ell
 namespace nodes
 {
     SingleElementThresholdNode::SingleElementThresholdNode()
-        : Node({ &_input }, { &_output }), _input(this, {}, inputPortName), _output(this, outputPortName, 1)
+        : CompilableNode({ &_input }, { &_output }), _input(this, {}, inputPortName), _output(this, outputPortName, 1)
     {
     }
 
     SingleElementThresholdNode::SingleElementThresholdNode(const model::PortElements<double>& input, const SingleElementThresholdPredictor& predictor)
-        : Node({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, 1), _predictor(predictor)
+        : CompilableNode({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, 1), _predictor(predictor)
     {
         assert(input.Size() > predictor.GetElementIndex());
     }
@@ -68,6 +68,23 @@ namespace nodes
         return true;
     }
 
+    void SingleElementThresholdNode::Compile(model::IRMapCompiler& compiler)
+    {
+        compiler.NewBlockRegion(*this);
+
+        auto inputPort = GetInputPorts()[0];
+        auto outputPort = GetOutputPorts()[0];
+        auto& function = compiler.GetCurrentFunction();
+
+        // load just the element used in the split rule, and compare it to the threshold
+        llvm::Value* pElement = compiler.LoadVariable(inputPort->GetInputElement(_predictor.GetElementIndex()));
+        llvm::Value* pComparison = function.Comparison(emitters::TypedComparison::greaterThanFloat, pElement, function.Literal(_predictor.GetThreshold()));
+        llvm::Value* pResult = compiler.EnsureEmitted(outputPort);
+        function.Store(pResult, function.CastBoolToInt(pComparison));
+
+        compiler.TryMergeRegion(*this);
+    }
+
     void SingleElementThresholdNode::Compute() const
     {
         auto inputDataVector = SingleElementThresholdPredictor::DataVectorType(_input.GetIterator());
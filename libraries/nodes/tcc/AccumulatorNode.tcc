@@ -57,7 +57,7 @@ namespace nodes
         emitters::Variable* pAccumulatorVar = compiler.Variables().AddVariable<emitters::InitializedVectorVariable<ValueType>>(emitters::VariableScope::global, outputPort->Size());
         llvm::Value* accumulator = compiler.EnsureEmitted(*pAccumulatorVar);
 
-        if (model::IsPureVector(*inputPort) && !compiler.GetCompilerParameters().unrollLoops)
+        if (model::IsLoopableVector(*inputPort) && !compiler.GetCompilerParameters().unrollLoops)
         {
             CompileAccumulatorLoop(compiler, accumulator);
         }
@@ -75,7 +75,7 @@ namespace nodes
         auto inputPort = this->GetInputPorts()[0];
         auto outputPort = this->GetOutputPorts()[0];
         llvm::Value* result = compiler.EnsureEmitted(outputPort);
-        llvm::Value* inputVector = compiler.EnsureEmitted(inputPort);
+        llvm::Value* inputVector = compiler.EnsureContiguousInput(inputPort);
         auto& function = compiler.GetCurrentFunction();
 
         function.VectorOperator(emitters::GetAddForValueType<ValueType>(), outputPort->Size(), accumulator, inputVector, [&accumulator, &result, &function, this](llvm::Value* i, llvm::Value* value) {
@@ -136,6 +136,47 @@ namespace nodes
         {
             return (!a) != (!b);
         }
+
+        // Returns true if using these values as one of the operands leaves the other operand unchanged
+        template <typename ValueType>
+        bool IsIdentityOperand(emitters::BinaryOperationType operation, const std::vector<ValueType>& values, bool isRightOperand)
+        {
+            ValueType identity;
+            switch (operation)
+            {
+                case emitters::BinaryOperationType::add:
+                    identity = 0;
+                    break;
+                case emitters::BinaryOperationType::subtract:
+                    identity = 0;
+                    if (!isRightOperand)
+                    {
+                        return false;
+                    }
+                    break;
+                case emitters::BinaryOperationType::coordinatewiseMultiply:
+                    identity = 1;
+                    break;
+                case emitters::BinaryOperationType::coordinatewiseDivide:
+                    identity = 1;
+                    if (!isRightOperand)
+                    {
+                        return false;
+                    }
+                    break;
+                default:
+                    return false;
+            }
+            return std::all_of(values.begin(), values.end(), [identity](ValueType value) { return value == identity; });
+        }
+
+        // Returns true if 1 / value is exact, that is, if value is a power of two whose reciprocal is a normal number
+        template <typename ValueType>
+        bool HasExactReciprocal(ValueType value)
+        {
+            int exponent;
+            return std::isnormal(value) && std::isnormal(static_cast<ValueType>(1) / value) && std::abs(std::frexp(value, &exponent)) == static_cast<ValueType>(0.5);
+        }
     }
 
     template <typename ValueType>
@@ -157,47 +198,44 @@ namespace nodes
 
     template <typename ValueType>
     template <typename Operation>
-    std::vector<ValueType> BinaryOperationNode<ValueType>::ComputeOutput(Operation&& function) const
+    std::vector<ValueType> BinaryOperationNode<ValueType>::ComputeOutput(const std::vector<ValueType>& input1, const std::vector<ValueType>& input2, Operation&& function) const
     {
-        auto output = std::vector<ValueType>(_input1.Size());
-        for (size_t index = 0; index < _input1.Size(); index++)
+        auto output = std::vector<ValueType>(input1.size());
+        for (size_t index = 0; index < input1.size(); index++)
         {
-            output[index] = function(_input1[index], _input2[index]);
+            output[index] = function(input1[index], input2[index]);
         }
         return output;
     }
 
     template <typename ValueType>
-    void BinaryOperationNode<ValueType>::Compute() const
+    std::vector<ValueType> BinaryOperationNode<ValueType>::ComputeOutput(const std::vector<ValueType>& input1, const std::vector<ValueType>& input2) const
     {
-        std::vector<ValueType> output;
         switch (_operation)
         {
             case emitters::BinaryOperationType::add:
-                output = ComputeOutput(BinaryOperations::Add<ValueType>);
-                break;
+                return ComputeOutput(input1, input2, BinaryOperations::Add<ValueType>);
             case emitters::BinaryOperationType::subtract:
-                output = ComputeOutput(BinaryOperations::Subtract<ValueType>);
-                break;
+                return ComputeOutput(input1, input2, BinaryOperations::Subtract<ValueType>);
             case emitters::BinaryOperationType::coordinatewiseMultiply:
-                output = ComputeOutput(BinaryOperations::Multiply<ValueType>);
-                break;
+                return ComputeOutput(input1, input2, BinaryOperations::Multiply<ValueType>);
             case emitters::BinaryOperationType::coordinatewiseDivide:
-                output = ComputeOutput(BinaryOperations::Divide<ValueType>);
-                break;
+                return ComputeOutput(input1, input2, BinaryOperations::Divide<ValueType>);
             case emitters::BinaryOperationType::logicalAnd:
-                output = ComputeOutput(BinaryOperations::LogicalAnd<ValueType>);
-                break;
+                return ComputeOutput(input1, input2, BinaryOperations::LogicalAnd<ValueType>);
             case emitters::BinaryOperationType::logicalOr:
-                output = ComputeOutput(BinaryOperations::LogicalOr<ValueType>);
-                break;
+                return ComputeOutput(input1, input2, BinaryOperations::LogicalOr<ValueType>);
             case emitters::BinaryOperationType::logicalXor:
-                output = ComputeOutput(BinaryOperations::LogicalXor<ValueType>);
-                break;
+                return ComputeOutput(input1, input2, BinaryOperations::LogicalXor<ValueType>);
             default:
                 throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented, "Unknown operation type");
         }
-        _output.SetOutput(output);
+    }
+
+    template <typename ValueType>
+    void BinaryOperationNode<ValueType>::Compute() const
+    {
+        _output.SetOutput(ComputeOutput(_input1.GetValue(), _input2.GetValue()));
     };
 
     template <typename ValueType>
@@ -209,6 +247,69 @@ namespace nodes
         transformer.MapNodeOutput(output, newNode->output);
     }
 
+    template <typename ValueType>
+    bool BinaryOperationNode<ValueType>::Optimize(model::ModelTransformer& transformer) const
+    {
+        auto newInput1 = transformer.TransformPortElements(_input1.GetPortElements());
+        auto newInput2 = transformer.TransformPortElements(_input2.GetPortElements());
+        std::vector<ValueType> values1;
+        std::vector<ValueType> values2;
+        bool isConstant1 = TryGetConstantValues(newInput1, values1);
+        bool isConstant2 = TryGetConstantValues(newInput2, values2);
+
+        // fold an operation on constants
+        if (isConstant1 && isConstant2)
+        {
+            auto constantNode = transformer.AddNode<ConstantNode<ValueType>>(ComputeOutput(values1, values2));
+            transformer.MapNodeOutput(output, constantNode->output);
+            return true;
+        }
+
+        // remove an operation with an identity element, e.g., x + 0 or x * 1
+        if (isConstant2 && BinaryOperations::IsIdentityOperand(_operation, values2, true))
+        {
+            transformer.MapNodeOutput(output, newInput1);
+            return true;
+        }
+        if (isConstant1 && BinaryOperations::IsIdentityOperand(_operation, values1, false))
+        {
+            transformer.MapNodeOutput(output, newInput2);
+            return true;
+        }
+
+        // merge with a preceding operation of the same kind on a constant, e.g., (x + a) + b becomes x + (a + b), which changes
+        // floating-point results and is therefore only done if the context allows relaxed precision
+        bool canReassociate = !std::is_floating_point<ValueType>::value || transformer.GetContext().IsRelaxedPrecisionAllowed();
+        if (isConstant2 && canReassociate && (_operation == emitters::BinaryOperationType::add || _operation == emitters::BinaryOperationType::coordinatewiseMultiply))
+        {
+            const auto& ranges = newInput1.GetRanges();
+            auto previousNode = ranges.size() == 1 && ranges[0].IsFullPortRange() ? dynamic_cast<const BinaryOperationNode<ValueType>*>(ranges[0].ReferencedPort()->GetNode()) : nullptr;
+            std::vector<ValueType> previousValues;
+            if (previousNode != nullptr && previousNode->GetOperation() == _operation && TryGetConstantValues(previousNode->input2.GetPortElements(), previousValues))
+            {
+                auto constantNode = transformer.AddNode<ConstantNode<ValueType>>(ComputeOutput(previousValues, values2));
+                auto newNode = transformer.AddNode<BinaryOperationNode<ValueType>>(previousNode->input1.GetPortElements(), constantNode->output, _operation);
+                transformer.MapNodeOutput(output, newNode->output);
+                return true;
+            }
+        }
+
+        // replace division by a constant with multiplication by its reciprocal, if the reciprocal is exact or the context allows relaxed precision
+        if (isConstant2 && _operation == emitters::BinaryOperationType::coordinatewiseDivide && std::is_floating_point<ValueType>::value &&
+            (transformer.GetContext().IsRelaxedPrecisionAllowed() || std::all_of(values2.begin(), values2.end(), [](ValueType value) { return BinaryOperations::HasExactReciprocal(value); })))
+        {
+            std::vector<ValueType> reciprocals(values2.size());
+            std::transform(values2.begin(), values2.end(), reciprocals.begin(), [](ValueType value) { return static_cast<ValueType>(1) / value; });
+            auto constantNode = transformer.AddNode<ConstantNode<ValueType>>(reciprocals);
+            auto newNode = transformer.AddNode<BinaryOperationNode<ValueType>>(newInput1, constantNode->output, emitters::BinaryOperationType::coordinatewiseMultiply);
+            transformer.MapNodeOutput(output, newNode->output);
+            return true;
+        }
+
+        Copy(transformer);
+        return false;
+    }
+
     template <typename ValueType>
     void BinaryOperationNode<ValueType>::Compile(model::IRMapCompiler& compiler)
     {
@@ -216,7 +317,7 @@ namespace nodes
 
         auto inputPort1 = GetInputPorts()[0];
         auto inputPort2 = GetInputPorts()[1];
-        if (IsPureVector(*inputPort1) && IsPureVector(*inputPort2) && !compiler.GetCompilerParameters().unrollLoops)
+        if (IsLoopableVector(*inputPort1) && IsLoopableVector(*inputPort2) && !compiler.GetCompilerParameters().unrollLoops)
         {
             CompileBinaryOperationLoop(compiler);
         }
@@ -234,8 +335,8 @@ namespace nodes
         auto inputPort1 = GetInputPorts()[0];
         auto inputPort2 = GetInputPorts()[1];
         auto outputPort = GetOutputPorts()[0];
-        llvm::Value* pInput1 = compiler.EnsureEmitted(inputPort1);
-        llvm::Value* pInput2 = compiler.EnsureEmitted(inputPort2);
+        llvm::Value* pInput1 = compiler.EnsureContiguousInput(inputPort1);
+        llvm::Value* pInput2 = compiler.EnsureContiguousInput(inputPort2);
         llvm::Value* pResult = compiler.EnsureEmitted(outputPort);
         auto& function = compiler.GetCurrentFunction();
 
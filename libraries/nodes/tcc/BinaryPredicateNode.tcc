@@ -165,10 +165,22 @@ namespace nodes
         auto outputPort = GetOutputPorts()[0];
 
         // Binary predicate has 2 inputs and 1 output
-        // Currently, compiled BinaryPredicate nodes are limited to operating on scalars
+        if (outputPort->Size() > 1)
+        {
+            if (IsLoopableVector(*inputPort1) && IsLoopableVector(*inputPort2) && !compiler.GetCompilerParameters().unrollLoops)
+            {
+                CompileBinaryPredicateLoop(compiler);
+            }
+            else
+            {
+                CompileBinaryPredicateExpanded(compiler);
+            }
+            compiler.TryMergeRegion(*this);
+            return;
+        }
+
         VerifyIsScalar(*inputPort1);
         VerifyIsScalar(*inputPort2);
-        VerifyIsScalar(*outputPort);
 
         llvm::Value* pResult = compiler.EnsureEmitted(outputPort);
         // emitters::Variable& resultVar = *(GetVariableFor(pOutput));
@@ -186,19 +198,23 @@ namespace nodes
     template <typename ValueType>
     void BinaryPredicateNode<ValueType>::CompileBinaryPredicateLoop(model::IRMapCompiler& compiler)
     {
-        // Loop version broken
         auto inputPort1 = GetInputPorts()[0];
         auto inputPort2 = GetInputPorts()[1];
         auto outputPort = GetOutputPorts()[0];
-        llvm::Value* pInput1 = compiler.EnsureEmitted(inputPort1);
-        llvm::Value* pInput2 = compiler.EnsureEmitted(inputPort2);
+        llvm::Value* pInput1 = compiler.EnsureContiguousInput(inputPort1);
+        llvm::Value* pInput2 = compiler.EnsureContiguousInput(inputPort2);
         llvm::Value* pResult = compiler.EnsureEmitted(outputPort);
         auto& function = compiler.GetCurrentFunction();
+        emitters::TypedComparison cmp = emitters::GetComparison<ValueType>(GetPredicate());
 
-        auto count = inputPort1->Size();
-        function.VectorOperator(emitters::GetComparison<ValueType>(GetPredicate()), outputPort->Size(), pInput1, pInput2, [&pResult, &function, this](llvm::Value* i, llvm::Value* pValue) {
-            function.SetValueAt(pResult, i, pValue);
-        });
+        auto forLoop = function.ForLoop();
+        forLoop.Begin(outputPort->Size());
+        {
+            auto i = forLoop.LoadIterationVariable();
+            llvm::Value* pOpResult = function.Comparison(cmp, function.ValueAt(pInput1, i), function.ValueAt(pInput2, i));
+            function.SetValueAt(pResult, i, function.CastBoolToInt(pOpResult));
+        }
+        forLoop.End();
     }
 
     template <typename ValueType>
@@ -215,8 +231,8 @@ namespace nodes
         {
             llvm::Value* inputValue1 = compiler.LoadVariable(inputPort1->GetInputElement(i));
             llvm::Value* inputValue2 = compiler.LoadVariable(inputPort2->GetInputElement(i));
-            llvm::Value* pOpResult = function.Operator(emitters::GetComparison<ValueType>(GetPredicate()), inputValue1, inputValue2);
-            function.SetValueAt(pResult, function.Literal((int)i), pOpResult);
+            llvm::Value* pOpResult = function.Comparison(emitters::GetComparison<ValueType>(GetPredicate()), inputValue1, inputValue2);
+            function.SetValueAt(pResult, function.Literal((int)i), function.CastBoolToInt(pOpResult));
         }
     }
 
@@ -75,5 +75,24 @@ namespace nodes
         archiver[outputPortName] >> _output;
         archiver["values"] >> _values;
     }
+
+    template <typename ValueType>
+    bool TryGetConstantValues(const model::PortElements<ValueType>& elements, std::vector<ValueType>& values)
+    {
+        std::vector<ValueType> result;
+        result.reserve(elements.Size());
+        for (const auto& range : elements.GetRanges())
+        {
+            auto constantNode = dynamic_cast<const ConstantNode<ValueType>*>(range.ReferencedPort()->GetNode());
+            if (constantNode == nullptr)
+            {
+                return false;
+            }
+            const auto& constantValues = constantNode->GetValues();
+            result.insert(result.end(), constantValues.begin() + range.GetStartIndex(), constantValues.begin() + range.GetStartIndex() + range.Size());
+        }
+        values = std::move(result);
+        return true;
+    }
 }
 }
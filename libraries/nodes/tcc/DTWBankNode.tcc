@@ -0,0 +1,245 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DTWBankNode.tcc (nodes)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <algorithm>
+#include <limits>
+
+namespace ell
+{
+namespace nodes
+{
+    template <typename ValueType>
+    DTWBankNode<ValueType>::DTWBankNode()
+        : CompilableNode({ &_input }, { &_output }), _input(this, {}, inputPortName), _output(this, outputPortName, 0)
+    {
+    }
+
+    template <typename ValueType>
+    DTWBankNode<ValueType>::DTWBankNode(const model::PortElements<ValueType>& input, const std::vector<std::vector<std::vector<ValueType>>>& prototypes)
+        : CompilableNode({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, prototypes.size()), _sampleDimension(input.Size())
+    {
+        for (const auto& prototype : prototypes)
+        {
+            _prototypeLengths.push_back(prototype.size());
+            for (const auto& row : prototype)
+            {
+                if (row.size() != _sampleDimension)
+                {
+                    throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "DTWBankNode: every prototype row must have the same size as the input");
+                }
+                _prototypeData.insert(_prototypeData.end(), row.begin(), row.end());
+            }
+        }
+        Initialize();
+    }
+
+    template <typename ValueType>
+    void DTWBankNode<ValueType>::Initialize()
+    {
+        auto numPrototypes = _prototypeLengths.size();
+        _rowOffsets.resize(numPrototypes + 1);
+        _rowOffsets[0] = 0;
+        for (size_t prototypeIndex = 0; prototypeIndex < numPrototypes; ++prototypeIndex)
+        {
+            _rowOffsets[prototypeIndex + 1] = _rowOffsets[prototypeIndex] + _prototypeLengths[prototypeIndex];
+        }
+
+        _prototypeVariances.clear();
+        for (const auto& prototype : GetPrototypes())
+        {
+            _prototypeVariances.push_back(DTWDistanceNodeImpl::Variance(prototype));
+        }
+
+        _inputSample.resize(_sampleDimension);
+        _distances.resize(numPrototypes);
+        _d.resize(_rowOffsets[numPrototypes] + numPrototypes);
+        Reset();
+    }
+
+    template <typename ValueType>
+    void DTWBankNode<ValueType>::Reset() const
+    {
+        std::fill(_d.begin(), _d.end(), std::numeric_limits<ValueType>::max());
+        for (size_t prototypeIndex = 0; prototypeIndex < NumPrototypes(); ++prototypeIndex)
+        {
+            _d[GetStateOffset(prototypeIndex)] = 0;
+        }
+    }
+
+    template <typename ValueType>
+    std::vector<std::vector<std::vector<ValueType>>> DTWBankNode<ValueType>::GetPrototypes() const
+    {
+        std::vector<std::vector<std::vector<ValueType>>> result(NumPrototypes());
+        for (size_t prototypeIndex = 0; prototypeIndex < NumPrototypes(); ++prototypeIndex)
+        {
+            for (size_t rowIndex = _rowOffsets[prototypeIndex]; rowIndex < _rowOffsets[prototypeIndex + 1]; ++rowIndex)
+            {
+                auto rowBegin = _prototypeData.begin() + rowIndex * _sampleDimension;
+                result[prototypeIndex].emplace_back(rowBegin, rowBegin + _sampleDimension);
+            }
+        }
+        return result;
+    }
+
+    template <typename ValueType>
+    void DTWBankNode<ValueType>::Compute() const
+    {
+        for (size_t index = 0; index < _sampleDimension; ++index)
+        {
+            _inputSample[index] = _input[index];
+        }
+        const ValueType* pInput = _inputSample.data();
+
+        // the same recurrence as DTWDistanceNode, applied to each prototype in turn
+        for (size_t prototypeIndex = 0; prototypeIndex < NumPrototypes(); ++prototypeIndex)
+        {
+            ValueType* d = _d.data() + GetStateOffset(prototypeIndex);
+            const ValueType* pPrototype = _prototypeData.data() + _rowOffsets[prototypeIndex] * _sampleDimension;
+
+            ValueType dLast = 0;
+            ValueType bestDist = 0;
+            for (size_t index = 1; index < _prototypeLengths[prototypeIndex] + 1; ++index)
+            {
+                auto d_iMinus1 = d[index - 1];
+                auto dPrev_iMinus1 = dLast;
+                auto dPrev_i = d[index];
+
+                bestDist = d_iMinus1;
+                if (dPrev_i < bestDist)
+                {
+                    bestDist = dPrev_i;
+                }
+                if (dPrev_iMinus1 < bestDist)
+                {
+                    bestDist = dPrev_iMinus1;
+                }
+                bestDist += DTWDistanceNodeImpl::L1Distance(pPrototype + (index - 1) * _sampleDimension, pInput, _sampleDimension);
+
+                dLast = dPrev_i;
+                d[index] = bestDist;
+            }
+            _distances[prototypeIndex] = static_cast<ValueType>(bestDist / _prototypeVariances[prototypeIndex]);
+        }
+
+        _output.SetOutput(_distances);
+    }
+
+    template <typename ValueType>
+    void DTWBankNode<ValueType>::Copy(model::ModelTransformer& transformer) const
+    {
+        auto newinput = transformer.TransformPortElements(_input.GetPortElements());
+        auto newNode = transformer.AddNode<DTWBankNode<ValueType>>(newinput, GetPrototypes());
+        transformer.MapNodeOutput(output, newNode->output);
+    }
+
+    template <typename ValueType>
+    void DTWBankNode<ValueType>::Compile(model::IRMapCompiler& compiler)
+    {
+        static_assert(!std::is_same<ValueType, bool>(), "Cannot instantiate boolean DTW nodes");
+        compiler.NewBlockRegion(*this);
+
+        auto inputPort = GetInputPorts()[0];
+        auto outputPort = GetOutputPorts()[0];
+        auto inputType = GetPortVariableType(*inputPort);
+        assert(inputType == GetPortVariableType(*outputPort));
+
+        auto& function = compiler.GetCurrentFunction();
+
+        llvm::Value* pInput = compiler.EnsureContiguousInput(inputPort);
+        llvm::Value* pResult = compiler.EnsureEmitted(outputPort);
+
+        // The packed prototypes (constant) and the packed dynamic programming memory (global), with the same initial state as the interpreted node
+        std::vector<ValueType> initialD(_d.size(), std::numeric_limits<ValueType>::max());
+        for (size_t prototypeIndex = 0; prototypeIndex < NumPrototypes(); ++prototypeIndex)
+        {
+            initialD[GetStateOffset(prototypeIndex)] = 0;
+        }
+        emitters::Variable* pVarPrototypes = compiler.Variables().AddVariable<emitters::LiteralVectorVariable<ValueType>>(_prototypeData);
+        emitters::Variable* pVarD = compiler.Variables().AddVariable<emitters::InitializedVectorVariable<ValueType>>(emitters::VariableScope::global, initialD);
+        llvm::Value* pPrototypes = compiler.EnsureEmitted(*pVarPrototypes);
+        llvm::Value* pD = compiler.EnsureEmitted(*pVarD);
+
+        llvm::Value* dist = function.Variable(inputType, "dist");
+        llvm::Value* dLast = function.Variable(inputType, "dLast");
+        llvm::Value* bestDist = function.Variable(inputType, "bestDist");
+
+        // one loop per prototype, each with constant offsets into the packed buffers
+        for (size_t prototypeIndex = 0; prototypeIndex < NumPrototypes(); ++prototypeIndex)
+        {
+            auto stateOffset = function.Literal(static_cast<int>(GetStateOffset(prototypeIndex)));
+            auto rowOffset = function.Literal(static_cast<int>(_rowOffsets[prototypeIndex]));
+
+            function.Store(dLast, function.Literal(static_cast<ValueType>(0)));
+            function.Store(bestDist, function.Literal(static_cast<ValueType>(0)));
+            auto forLoop = function.ForLoop();
+            forLoop.Begin(_prototypeLengths[prototypeIndex]);
+            {
+                auto iMinusOne = forLoop.LoadIterationVariable();
+                auto stateIndex = function.Operator(emitters::TypedOperator::add, stateOffset, iMinusOne);
+                auto nextStateIndex = function.Operator(emitters::TypedOperator::add, stateIndex, function.Literal(1));
+
+                auto d_iMinus1 = function.ValueAt(pD, stateIndex);
+                auto dPrev_iMinus1 = function.Load(dLast);
+                auto dPrev_i = function.ValueAt(pD, nextStateIndex);
+
+                function.Store(bestDist, d_iMinus1);
+                emitters::IRIfEmitter if1 = function.If(emitters::TypedComparison::lessThanFloat, dPrev_i, d_iMinus1);
+                {
+                    function.Store(bestDist, dPrev_i);
+                }
+                if1.End();
+
+                emitters::IRIfEmitter if2 = function.If(emitters::TypedComparison::lessThanFloat, dPrev_iMinus1, function.Load(bestDist));
+                {
+                    function.Store(bestDist, dPrev_iMinus1);
+                }
+                if2.End();
+
+                auto rowIndex = function.Operator(emitters::TypedOperator::add, rowOffset, iMinusOne);
+                auto rowDataOffset = function.Operator(emitters::TypedOperator::multiply, rowIndex, function.Literal(static_cast<int>(_sampleDimension)));
+                DTWDistanceNodeImpl::EmitL1Distance<ValueType>(compiler, pInput, pPrototypes, rowDataOffset, _sampleDimension, dist);
+                function.OperationAndUpdate(bestDist, emitters::GetAddForValueType<ValueType>(), function.Load(dist));
+
+                function.Store(dLast, dPrev_i);
+                function.SetValueAt(pD, nextStateIndex, function.Load(bestDist));
+            }
+            forLoop.End();
+
+            auto distance = function.Operator(emitters::GetDivideForValueType<ValueType>(), function.Load(bestDist), function.Literal(static_cast<ValueType>(_prototypeVariances[prototypeIndex])));
+            function.SetValueAt(pResult, static_cast<int>(prototypeIndex), distance);
+        }
+        compiler.TryMergeRegion(*this);
+    }
+
+    template <typename ValueType>
+    void DTWBankNode<ValueType>::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        Node::WriteToArchive(archiver);
+        archiver[inputPortName] << _input;
+        archiver[outputPortName] << _output;
+        archiver["prototypeLengths"] << _prototypeLengths;
+        archiver["prototypeData"] << _prototypeData;
+    }
+
+    template <typename ValueType>
+    void DTWBankNode<ValueType>::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        Node::ReadFromArchive(archiver);
+        archiver[inputPortName] >> _input;
+        archiver[outputPortName] >> _output;
+        archiver["prototypeLengths"] >> _prototypeLengths;
+        archiver["prototypeData"] >> _prototypeData;
+        _sampleDimension = _input.Size();
+        Initialize();
+    }
+}
+}
@@ -6,6 +6,9 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// stl
+#include <algorithm>
+#include <cmath>
 #include <limits>
 
 namespace ell
@@ -14,6 +17,9 @@ namespace nodes
 {
     namespace DTWDistanceNodeImpl
     {
+        // the maximum sample dimension for which the compiled distance computation is fully unrolled
+        const size_t maxUnrolledSampleDimension = 16;
+
         template <typename ValueType>
         double Variance(const std::vector<std::vector<ValueType>>& prototype)
         {
@@ -31,6 +37,76 @@ namespace nodes
             }
             return (sumSquares - ((sum * sum) / size)) / size;
         }
+
+        // L1 distance between two contiguous arrays, written as a simple loop with a local accumulator so that the
+        // host compiler can vectorize it
+        template <typename ValueType>
+        ValueType L1Distance(const ValueType* a, const ValueType* b, size_t size)
+        {
+            ValueType sum = 0;
+            for (size_t index = 0; index < size; ++index)
+            {
+                sum += std::abs(a[index] - b[index]);
+            }
+            return sum;
+        }
+
+        // L1 distance between a sample and the box [lower, upper], which is a lower bound on the L1 distance
+        // between the sample and any point in the box
+        template <typename ValueType>
+        ValueType EnvelopeDistance(const ValueType* sample, const ValueType* lower, const ValueType* upper, size_t size)
+        {
+            ValueType sum = 0;
+            for (size_t index = 0; index < size; ++index)
+            {
+                if (sample[index] < lower[index])
+                {
+                    sum += lower[index] - sample[index];
+                }
+                else if (sample[index] > upper[index])
+                {
+                    sum += sample[index] - upper[index];
+                }
+            }
+            return sum;
+        }
+
+        // Emits code that stores the L1 distance between the input and the row of the prototype that starts at
+        // rowOffset into pDistance, which must be allocated outside of any loop
+        template <typename ValueType>
+        void EmitL1Distance(model::IRMapCompiler& compiler, llvm::Value* pInput, llvm::Value* pPrototype, llvm::Value* rowOffset, size_t size, llvm::Value* pDistance)
+        {
+            auto& function = compiler.GetCurrentFunction();
+            auto absFunction = compiler.GetRuntime().GetAbsFunction<ValueType>();
+
+            if (size <= maxUnrolledSampleDimension)
+            {
+                // straight-line code, with no loop counters and constant offsets into the row
+                llvm::Value* sum = nullptr;
+                for (size_t index = 0; index < size; ++index)
+                {
+                    llvm::Value* inputValue = function.ValueAt(pInput, static_cast<int>(index));
+                    llvm::Value* protoValue = function.ValueAt(pPrototype, function.Operator(emitters::TypedOperator::add, rowOffset, function.Literal(static_cast<int>(index))));
+                    llvm::Value* absDiff = function.Call(absFunction, { function.Operator(emitters::GetSubtractForValueType<ValueType>(), inputValue, protoValue) });
+                    sum = sum == nullptr ? absDiff : function.Operator(emitters::GetAddForValueType<ValueType>(), sum, absDiff);
+                }
+                function.Store(pDistance, sum != nullptr ? sum : function.Literal(static_cast<ValueType>(0)));
+            }
+            else
+            {
+                function.Store(pDistance, function.Literal(static_cast<ValueType>(0)));
+                auto diffLoop = function.ForLoop();
+                diffLoop.Begin(size);
+                {
+                    auto j = diffLoop.LoadIterationVariable();
+                    llvm::Value* inputValue = function.ValueAt(pInput, j);
+                    llvm::Value* protoValue = function.ValueAt(pPrototype, function.Operator(emitters::TypedOperator::add, rowOffset, j));
+                    llvm::Value* absDiff = function.Call(absFunction, { function.Operator(emitters::GetSubtractForValueType<ValueType>(), inputValue, protoValue) });
+                    function.OperationAndUpdate(pDistance, emitters::GetAddForValueType<ValueType>(), absDiff);
+                }
+                diffLoop.End();
+            }
+        }
     }
 
     template <typename ValueType>
@@ -40,16 +116,33 @@ namespace nodes
     }
 
     template <typename ValueType>
-    DTWDistanceNode<ValueType>::DTWDistanceNode(const model::PortElements<ValueType>& input, const std::vector<std::vector<ValueType>>& prototype)
-        : CompilableNode({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, 1), _prototype(prototype)
+    DTWDistanceNode<ValueType>::DTWDistanceNode(const model::PortElements<ValueType>& input, const std::vector<std::vector<ValueType>>& prototype, double pruningThreshold)
+        : CompilableNode({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, 1), _prototype(prototype), _pruningThreshold(pruningThreshold)
     {
         _sampleDimension = input.Size();
         _prototypeLength = prototype.size();
+        _inputSample.resize(_sampleDimension);
         _d.resize(_prototypeLength + 1);
         _s.resize(_prototypeLength + 1);
 
+        _prototypeData.reserve(_prototypeLength * _sampleDimension);
+        _lowerEnvelope.assign(_sampleDimension, std::numeric_limits<ValueType>::max());
+        _upperEnvelope.assign(_sampleDimension, std::numeric_limits<ValueType>::lowest());
+        for (const auto& row : _prototype)
+        {
+            if (row.size() != _sampleDimension)
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "DTWDistanceNode: every prototype row must have the same size as the input");
+            }
+            _prototypeData.insert(_prototypeData.end(), row.begin(), row.end());
+            for (size_t index = 0; index < _sampleDimension; ++index)
+            {
+                _lowerEnvelope[index] = std::min(_lowerEnvelope[index], row[index]);
+                _upperEnvelope[index] = std::max(_upperEnvelope[index], row[index]);
+            }
+        }
+
         _prototypeVariance = DTWDistanceNodeImpl::Variance(_prototype);
-        // _threshold = std::sqrt(-2 * std::log(confidenceThreshold)) * _prototypeVariance;
         Reset();
     }
 
@@ -62,23 +155,21 @@ namespace nodes
         _currentTime = 0;
     }
 
-    template <typename T>
-    float distance(const std::vector<T>& a, const std::vector<T>& b)
+    template <typename ValueType>
+    void DTWDistanceNode<ValueType>::Compute() const
     {
-        T s = 0;
-        for (size_t index = 0; index < a.size(); index++)
+        for (size_t index = 0; index < _sampleDimension; ++index)
         {
-            s += std::abs(a[index] - b[index]);
+            _inputSample[index] = _input[index];
         }
-        return static_cast<float>(s);
-    }
+        const ValueType* pInput = _inputSample.data();
+
+        // with pruning, cells whose best predecessor plus the lower bound on this sample's distance exceed the cutoff are not computed
+        auto cutoff = static_cast<ValueType>(_pruningThreshold * _prototypeVariance);
+        ValueType lowerBound = IsPruning() ? DTWDistanceNodeImpl::EnvelopeDistance(pInput, _lowerEnvelope.data(), _upperEnvelope.data(), _sampleDimension) : 0;
 
-    template <typename ValueType>
-    void DTWDistanceNode<ValueType>::Compute() const
-    {
-        std::vector<ValueType> input = _input.GetValue();
         auto t = ++_currentTime;
-        auto dLast = _d[0] = 0;
+        ValueType dLast = _d[0] = 0;
         auto sLast = _s[0] = t;
 
         ValueType bestDist = 0;
@@ -104,20 +195,28 @@ namespace nodes
                 bestDist = dPrev_iMinus1;
                 bestStart = sPrev_iMinus1;
             }
-            bestDist += distance(_prototype[index - 1], input);
 
+            if (IsPruning() && bestDist + lowerBound > cutoff)
+            {
+                bestDist = std::numeric_limits<ValueType>::max();
+            }
+            else
+            {
+                bestDist += DTWDistanceNodeImpl::L1Distance(_prototypeData.data() + (index - 1) * _sampleDimension, pInput, _sampleDimension);
+            }
+
+            // remember the previous column's value before overwriting it
+            dLast = dPrev_i;
+            sLast = sPrev_i;
             _d[index] = bestDist;
             _s[index] = bestStart;
         }
         assert(bestDist == _d[_prototypeLength]);
         assert(bestStart == _s[_prototypeLength]);
         auto result = bestDist / _prototypeVariance;
-
-        // Ensure best match is between 80% and 120% of prototype length
-        auto timeDiff = _currentTime - bestStart;
-        if (timeDiff < _prototypeLength * 0.8 || timeDiff > _prototypeLength * 1.2)
+        if (IsPruning() && bestDist > cutoff)
         {
-            bestDist = std::numeric_limits<ValueType>::max();
+            result = std::numeric_limits<ValueType>::max();
         }
 
         _output.SetOutput({ static_cast<ValueType>(result) });
@@ -127,21 +226,54 @@ namespace nodes
     void DTWDistanceNode<ValueType>::Copy(model::ModelTransformer& transformer) const
     {
         auto newinput = transformer.TransformPortElements(_input.GetPortElements());
-        auto newNode = transformer.AddNode<DTWDistanceNode<ValueType>>(newinput, _prototype);
+        auto newNode = transformer.AddNode<DTWDistanceNode<ValueType>>(newinput, _prototype, _pruningThreshold);
         transformer.MapNodeOutput(output, newNode->output);
     }
 
     template <typename ValueType>
-    std::vector<ValueType> DTWDistanceNode<ValueType>::GetPrototypeData() const
+    void DTWDistanceNode<ValueType>::EmitRowDistance(model::IRMapCompiler& compiler, llvm::Value* pInput, llvm::Value* pPrototype, llvm::Value* rowIndex, llvm::Value* pDistance)
     {
-        std::vector<ValueType> result;
-        result.reserve(_prototypeLength * _sampleDimension);
+        auto& function = compiler.GetCurrentFunction();
+        auto rowOffset = function.Operator(emitters::TypedOperator::multiply, rowIndex, function.Literal(static_cast<int>(_sampleDimension)));
+        DTWDistanceNodeImpl::EmitL1Distance<ValueType>(compiler, pInput, pPrototype, rowOffset, _sampleDimension, pDistance);
+    }
+
+    template <typename ValueType>
+    llvm::Value* DTWDistanceNode<ValueType>::EmitEnvelopeDistance(model::IRMapCompiler& compiler, llvm::Value* pInput)
+    {
+        auto& function = compiler.GetCurrentFunction();
+        auto inputType = emitters::GetVariableType<ValueType>();
+
+        emitters::Variable* pVarLower = compiler.Variables().AddVariable<emitters::LiteralVectorVariable<ValueType>>(_lowerEnvelope);
+        emitters::Variable* pVarUpper = compiler.Variables().AddVariable<emitters::LiteralVectorVariable<ValueType>>(_upperEnvelope);
+        llvm::Value* pLower = compiler.EnsureEmitted(*pVarLower);
+        llvm::Value* pUpper = compiler.EnsureEmitted(*pVarUpper);
 
-        for (const auto& vec : _prototype)
+        llvm::Value* pLowerBound = function.Variable(inputType, "lowerBound");
+        function.Store(pLowerBound, function.Literal(static_cast<ValueType>(0)));
+        auto envelopeLoop = function.ForLoop();
+        envelopeLoop.Begin(_sampleDimension);
         {
-            result.insert(result.end(), vec.begin(), vec.end());
+            auto j = envelopeLoop.LoadIterationVariable();
+            llvm::Value* inputValue = function.ValueAt(pInput, j);
+            llvm::Value* lowerValue = function.ValueAt(pLower, j);
+            llvm::Value* upperValue = function.ValueAt(pUpper, j);
+
+            emitters::IRIfEmitter ifBelow = function.If(emitters::TypedComparison::lessThanFloat, inputValue, lowerValue);
+            {
+                function.OperationAndUpdate(pLowerBound, emitters::GetAddForValueType<ValueType>(), function.Operator(emitters::GetSubtractForValueType<ValueType>(), lowerValue, inputValue));
+            }
+            ifBelow.End();
+
+            emitters::IRIfEmitter ifAbove = function.If(emitters::TypedComparison::greaterThanFloat, inputValue, upperValue);
+            {
+                function.OperationAndUpdate(pLowerBound, emitters::GetAddForValueType<ValueType>(), function.Operator(emitters::GetSubtractForValueType<ValueType>(), inputValue, upperValue));
+            }
+            ifAbove.End();
         }
-        return result;
+        envelopeLoop.End();
+
+        return function.Load(pLowerBound);
     }
 
     template <typename ValueType>
@@ -158,27 +290,30 @@ namespace nodes
 
         auto& function = compiler.GetCurrentFunction();
 
-        llvm::Value* pInput = compiler.EnsureEmitted(inputPort);
+        llvm::Value* pInput = compiler.EnsureContiguousInput(inputPort);
         llvm::Value* pResult = compiler.EnsureEmitted(outputPort);
 
         // The prototype (constant)
         emitters::Variable* pVarPrototype = compiler.Variables().AddVariable<emitters::LiteralVectorVariable<ValueType>>(GetPrototypeData());
 
-        // Global variables for the dynamic programming memory
-        emitters::Variable* pVarD = compiler.Variables().AddVariable<emitters::InitializedVectorVariable<ValueType>>(emitters::VariableScope::global, _prototypeLength + 1);
+        // Global variables for the dynamic programming memory, with the same initial state as the interpreted node
+        std::vector<ValueType> initialD(_prototypeLength + 1, std::numeric_limits<ValueType>::max());
+        initialD[0] = 0;
+        emitters::Variable* pVarD = compiler.Variables().AddVariable<emitters::InitializedVectorVariable<ValueType>>(emitters::VariableScope::global, initialD);
 
         // get global state vars
         llvm::Value* pPrototypeVector = compiler.EnsureEmitted(*pVarPrototype);
         llvm::Value* pD = compiler.EnsureEmitted(*pVarD);
 
         llvm::Value* dist = function.Variable(inputType, "dist");
-        llvm::Value* protoIndex = function.Variable(ell::emitters::VariableType::Int32, "i");
         llvm::Value* dLast = function.Variable(inputType, "dLast");
         llvm::Value* bestDist = function.Variable(inputType, "bestDist");
 
+        auto cutoff = function.Literal(static_cast<ValueType>(_pruningThreshold * _prototypeVariance));
+        llvm::Value* lowerBound = IsPruning() ? EmitEnvelopeDistance(compiler, pInput) : nullptr;
+
         // initialize variables
-        function.Store(protoIndex, function.Literal(0));
-        function.Store(dLast, function.Literal(0.0));
+        function.Store(dLast, function.Literal(static_cast<ValueType>(0)));
 
         auto forLoop = function.ForLoop();
         forLoop.Begin(_prototypeLength);
@@ -203,27 +338,50 @@ namespace nodes
             }
             if2.End();
 
-            // Get dist
-            function.Store(dist, function.Literal(0.0));
-            auto diffLoop = function.ForLoop();
-            diffLoop.Begin(_sampleDimension);
+            if (IsPruning())
             {
-                auto j = diffLoop.LoadIterationVariable();
-                llvm::Value* inputValue = function.ValueAt(pInput, j);
-                llvm::Value* protoValue = function.ValueAt(pPrototypeVector, function.Load(protoIndex));
-                llvm::Value* diff = function.Operator(emitters::GetSubtractForValueType<ValueType>(), inputValue, protoValue);
-                llvm::Value* absDiff = function.Call(compiler.GetRuntime().GetAbsFunction<ValueType>(), { diff });
-                function.OperationAndUpdate(dist, emitters::GetAddForValueType<ValueType>(), absDiff);
-                function.OperationAndUpdate(protoIndex, emitters::TypedOperator::add, function.Literal(1));
+                auto bound = function.Operator(emitters::GetAddForValueType<ValueType>(), function.Load(bestDist), lowerBound);
+                emitters::IRIfEmitter ifPruned = function.If();
+                ifPruned.If(emitters::TypedComparison::greaterThanFloat, bound, cutoff);
+                {
+                    function.Store(bestDist, function.Literal(std::numeric_limits<ValueType>::max()));
+                }
+                ifPruned.Else();
+                {
+                    EmitRowDistance(compiler, pInput, pPrototypeVector, iMinusOne, dist);
+                    function.OperationAndUpdate(bestDist, emitters::GetAddForValueType<ValueType>(), function.Load(dist));
+                }
+                ifPruned.End();
+            }
+            else
+            {
+                EmitRowDistance(compiler, pInput, pPrototypeVector, iMinusOne, dist);
+                function.OperationAndUpdate(bestDist, emitters::GetAddForValueType<ValueType>(), function.Load(dist)); // x += dist;
             }
-            diffLoop.End();
 
-            function.OperationAndUpdate(bestDist, emitters::GetAddForValueType<ValueType>(), function.Load(dist)); // x += dist;
+            function.Store(dLast, dPrev_i);
             function.SetValueAt(pD, i, function.Load(bestDist)); // d[i] = x;
         }
         forLoop.End();
 
-        function.Store(pResult, function.Operator(emitters::GetDivideForValueType<ValueType>(), function.Load(bestDist), function.Literal(static_cast<ValueType>(_prototypeVariance))));
+        auto result = function.Operator(emitters::GetDivideForValueType<ValueType>(), function.Load(bestDist), function.Literal(static_cast<ValueType>(_prototypeVariance)));
+        if (IsPruning())
+        {
+            emitters::IRIfEmitter ifPruned = function.If();
+            ifPruned.If(emitters::TypedComparison::greaterThanFloat, function.Load(bestDist), cutoff);
+            {
+                function.Store(pResult, function.Literal(std::numeric_limits<ValueType>::max()));
+            }
+            ifPruned.Else();
+            {
+                function.Store(pResult, result);
+            }
+            ifPruned.End();
+        }
+        else
+        {
+            function.Store(pResult, result);
+        }
         compiler.TryMergeRegion(*this);
     }
 
@@ -69,7 +69,7 @@ namespace nodes
         //
         // We implement a delay as a Shift Register
         //
-        llvm::Value* inputBuffer = compiler.EnsureEmitted(inputPort);
+        llvm::Value* inputBuffer = compiler.EnsureContiguousInput(inputPort);
         function.ShiftAndUpdate<ValueType>(delayLine, bufferSize, sampleSize, inputBuffer, result);
 
         compiler.TryMergeRegion(*this);
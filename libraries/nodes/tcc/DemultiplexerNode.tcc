@@ -13,13 +13,13 @@ namespace nodes
 {
     template <typename ValueType, typename SelectorType>
     DemultiplexerNode<ValueType, SelectorType>::DemultiplexerNode()
-        : Node({ &_input, &_selector }, { &_output }), _input(this, {}, inputPortName), _selector(this, {}, selectorPortName), _output(this, outputPortName, 0), _defaultValue(0)
+        : CompilableNode({ &_input, &_selector }, { &_output }), _input(this, {}, inputPortName), _selector(this, {}, selectorPortName), _output(this, outputPortName, 0), _defaultValue(0)
     {
     }
 
     template <typename ValueType, typename SelectorType>
     DemultiplexerNode<ValueType, SelectorType>::DemultiplexerNode(const model::PortElements<ValueType>& input, const model::PortElements<SelectorType>& selector, size_t outputSize, ValueType defaultValue)
-        : Node({ &_input, &_selector }, { &_output }), _input(this, input, inputPortName), _selector(this, selector, selectorPortName), _output(this, outputPortName, outputSize), _defaultValue(defaultValue)
+        : CompilableNode({ &_input, &_selector }, { &_output }), _input(this, input, inputPortName), _selector(this, selector, selectorPortName), _output(this, outputPortName, outputSize), _defaultValue(defaultValue)
     {
         if (selector.Size() != 1)
         {
@@ -40,6 +40,44 @@ namespace nodes
         _output.SetOutput(outputValue);
     }
 
+    template <typename ValueType, typename SelectorType>
+    void DemultiplexerNode<ValueType, SelectorType>::Compile(model::IRMapCompiler& compiler)
+    {
+        compiler.NewBlockRegion(*this);
+
+        auto inputPort = GetInputPorts()[0];
+        auto selectorPort = GetInputPorts()[1];
+        auto outputPort = GetOutputPorts()[0];
+        auto size = static_cast<int>(outputPort->Size());
+        auto& function = compiler.GetCurrentFunction();
+
+        llvm::Value* pInputValue = compiler.LoadVariable(inputPort);
+        llvm::Value* pSelector = function.CastValue<SelectorType, int>(compiler.LoadVariable(selectorPort));
+        llvm::Value* pResult = compiler.EnsureEmitted(outputPort);
+        llvm::Value* pDefaultValue = function.Literal(static_cast<typename emitters::VariableValueType<ValueType>::type>(_defaultValue));
+
+        // fill the output with the default value, then overwrite the selected element
+        auto forLoop = function.ForLoop();
+        forLoop.Begin(size);
+        {
+            auto i = forLoop.LoadIterationVariable();
+            function.SetValueAt(pResult, i, pDefaultValue);
+        }
+        forLoop.End();
+
+        emitters::IRIfEmitter ifLower = function.If(emitters::TypedComparison::greaterThanOrEquals, pSelector, function.Literal(0));
+        {
+            emitters::IRIfEmitter ifUpper = function.If(emitters::TypedComparison::lessThan, pSelector, function.Literal(size));
+            {
+                function.SetValueAt(pResult, pSelector, pInputValue);
+            }
+            ifUpper.End();
+        }
+        ifLower.End();
+
+        compiler.TryMergeRegion(*this);
+    }
+
     template <typename ValueType, typename SelectorType>
     void DemultiplexerNode<ValueType, SelectorType>::WriteToArchive(utilities::Archiver& archiver) const
     {
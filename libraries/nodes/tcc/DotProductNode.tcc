@@ -63,7 +63,7 @@ namespace nodes
 
         auto pInput1 = this->GetInputPorts()[0];
         auto pInput2 = this->GetInputPorts()[1];
-        if ((IsPureVector(*pInput1) && IsPureVector(*pInput2)) && !compiler.GetCompilerParameters().unrollLoops)
+        if ((IsLoopableVector(*pInput1) && IsLoopableVector(*pInput2)) && !compiler.GetCompilerParameters().unrollLoops)
         {
             CompileDotProductLoop(compiler);
         }
@@ -78,8 +78,8 @@ namespace nodes
     template <typename ValueType>
     void DotProductNode<ValueType>::CompileDotProductLoop(model::IRMapCompiler& compiler)
     {
-        llvm::Value* pLVector = compiler.EnsureEmitted(this->GetInputPorts()[0]);
-        llvm::Value* pRVector = compiler.EnsureEmitted(this->GetInputPorts()[1]);
+        llvm::Value* pLVector = compiler.EnsureContiguousInput(this->GetInputPorts()[0]);
+        llvm::Value* pRVector = compiler.EnsureContiguousInput(this->GetInputPorts()[1]);
         auto pOutput = this->GetOutputPorts()[0];
         int count = (int)(this->GetInputPorts()[0])->Size();
         llvm::Value* pResult = compiler.EnsureEmitted(pOutput);
@@ -73,7 +73,7 @@ namespace nodes
     {
         compiler.NewBlockRegion(*this);
         auto inputPort = GetInputPorts()[0];
-        if (IsPureVector(*inputPort) && !compiler.GetCompilerParameters().unrollLoops)
+        if (IsLoopableVector(*inputPort) && !compiler.GetCompilerParameters().unrollLoops)
         {
             CompileLoop(compiler);
         }
@@ -94,7 +94,7 @@ namespace nodes
         VerifyIsScalar(*argValPort);
         auto inputType = GetPortVariableType(*inputPort);
 
-        llvm::Value* input = compiler.EnsureEmitted(inputPort);
+        llvm::Value* input = compiler.EnsureContiguousInput(inputPort);
         llvm::Value* outVal = compiler.EnsureEmitted(valPort);
         llvm::Value* outArgVal = compiler.EnsureEmitted(argValPort);
 
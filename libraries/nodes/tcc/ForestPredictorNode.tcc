@@ -171,21 +171,21 @@ namespace nodes
     template <typename SplitRuleType, typename EdgePredictorType>
     void ForestPredictorNode<SplitRuleType, EdgePredictorType>::Compute() const
     {
-        // forest output
-        auto inputDataVector = typename ForestPredictor::DataVectorType(_input.GetIterator());
-        _output.SetOutput({ _forest.Predict(inputDataVector) });
-
-        // individual tree outputs
-        std::vector<double> treeOutputs(_forest.NumTrees());
-        for (size_t i = 0; i < _forest.NumTrees(); ++i)
+        // copy the input into a reused buffer, rather than into a new data vector
+        auto inputSize = _input.Size();
+        _inputBuffer.resize(inputSize);
+        for (size_t i = 0; i < inputSize; ++i)
         {
-            treeOutputs[i] = _forest.Predict(inputDataVector, _forest.GetRootIndex(i));
+            _inputBuffer[i] = _input[i];
         }
-        _treeOutputs.SetOutput(std::move(treeOutputs));
 
-        // path indicator
-        auto edgeIndicator = _forest.GetEdgeIndicatorVector(inputDataVector);
-        _edgeIndicatorVector.SetOutput(std::move(edgeIndicator));
+        // a single walk down each tree computes the forest output, the tree outputs and the edge indicator vector.
+        // All three are computed even if they have no dependent nodes, since a port can also be read directly by Model::ComputeOutput
+        double output = 0.0;
+        _forest.Predict(_inputBuffer, &output, &_treeOutputsBuffer, &_edgeIndicatorBuffer);
+        _output.SetOutput({ output });
+        _treeOutputs.SetOutput(_treeOutputsBuffer);
+        _edgeIndicatorVector.SetOutput(_edgeIndicatorBuffer);
     }
 }
 }
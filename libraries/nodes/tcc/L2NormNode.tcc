@@ -12,13 +12,13 @@ namespace nodes
 {
     template <typename ValueType>
     L2NormNode<ValueType>::L2NormNode()
-        : Node({ &_input }, { &_output }), _input(this, {}, inputPortName), _output(this, outputPortName, 1)
+        : CompilableNode({ &_input }, { &_output }), _input(this, {}, inputPortName), _output(this, outputPortName, 1)
     {
     }
 
     template <typename ValueType>
     L2NormNode<ValueType>::L2NormNode(const model::PortElements<ValueType>& input)
-        : Node({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, 1)
+        : CompilableNode({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, 1)
     {
     }
 
@@ -34,6 +34,34 @@ namespace nodes
         _output.SetOutput({ std::sqrt(result) });
     };
 
+    template <typename ValueType>
+    void L2NormNode<ValueType>::Compile(model::IRMapCompiler& compiler)
+    {
+        compiler.NewBlockRegion(*this);
+
+        auto inputPort = GetInputPorts()[0];
+        auto outputPort = GetOutputPorts()[0];
+        llvm::Value* pInput = compiler.EnsureContiguousInput(inputPort);
+        llvm::Value* pResult = compiler.EnsureEmitted(outputPort);
+        auto& function = compiler.GetCurrentFunction();
+
+        // accumulate the sum of squares in a single loop, then take its square root
+        llvm::Value* pSum = function.Variable(GetPortVariableType(*outputPort), "sumOfSquares");
+        function.Store(pSum, function.Literal(static_cast<ValueType>(0)));
+        auto forLoop = function.ForLoop();
+        forLoop.Begin(static_cast<int>(inputPort->Size()));
+        {
+            auto i = forLoop.LoadIterationVariable();
+            llvm::Value* pValue = function.ValueAt(pInput, i);
+            llvm::Value* pSquare = function.Operator(emitters::GetMultiplyForValueType<ValueType>(), pValue, pValue);
+            function.OperationAndUpdate(pSum, emitters::GetAddForValueType<ValueType>(), pSquare);
+        }
+        forLoop.End();
+        function.Store(pResult, function.Call(compiler.GetRuntime().GetSqrtFunction<ValueType>(), { function.Load(pSum) }));
+
+        compiler.TryMergeRegion(*this);
+    }
+
     template <typename ValueType>
     void L2NormNode<ValueType>::Copy(model::ModelTransformer& transformer) const
     {
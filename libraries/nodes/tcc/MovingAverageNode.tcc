@@ -12,13 +12,13 @@ namespace nodes
 {
     template <typename ValueType>
     MovingAverageNode<ValueType>::MovingAverageNode()
-        : Node({ &_input }, { &_output }), _input(this, {}, inputPortName), _output(this, outputPortName, 0), _windowSize(0)
+        : CompilableNode({ &_input }, { &_output }), _input(this, {}, inputPortName), _output(this, outputPortName, 0), _windowSize(0)
     {
     }
 
     template <typename ValueType>
     MovingAverageNode<ValueType>::MovingAverageNode(const model::PortElements<ValueType>& input, size_t windowSize)
-        : Node({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, _input.Size()), _windowSize(windowSize)
+        : CompilableNode({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, _input.Size()), _windowSize(windowSize)
     {
         auto dimension = _input.Size();
         for (size_t index = 0; index < _windowSize; ++index)
@@ -67,6 +67,45 @@ namespace nodes
         return true;
     }
 
+    template <typename ValueType>
+    void MovingAverageNode<ValueType>::Compile(model::IRMapCompiler& compiler)
+    {
+        compiler.NewBlockRegion(*this);
+
+        auto inputPort = GetInputPorts()[0];
+        auto outputPort = GetOutputPorts()[0];
+        auto sampleSize = static_cast<int>(outputPort->Size());
+        auto bufferSize = sampleSize * static_cast<int>(_windowSize);
+        auto& function = compiler.GetCurrentFunction();
+
+        // the delay line and the running sum are long lived, so we keep them in globals
+        emitters::Variable* pDelayLineVar = compiler.Variables().AddVariable<emitters::InitializedVectorVariable<ValueType>>(emitters::VariableScope::global, bufferSize);
+        emitters::Variable* pRunningSumVar = compiler.Variables().AddVariable<emitters::InitializedVectorVariable<ValueType>>(emitters::VariableScope::global, sampleSize);
+        llvm::Value* pDelayLine = compiler.EnsureEmitted(*pDelayLineVar);
+        llvm::Value* pRunningSum = compiler.EnsureEmitted(*pRunningSumVar);
+        llvm::Value* pInput = compiler.EnsureContiguousInput(inputPort);
+        llvm::Value* pResult = compiler.EnsureEmitted(outputPort);
+
+        // shift the new sample into the delay line, getting back the sample that drops out of the window
+        llvm::Value* pLastSample = function.Variable(GetPortVariableType(*outputPort), sampleSize);
+        function.ShiftAndUpdate<ValueType>(pDelayLine, bufferSize, sampleSize, pInput, pLastSample);
+
+        // update the running sum and the average in one pass
+        llvm::Value* pWindowSize = function.Literal(static_cast<ValueType>(_windowSize));
+        auto forLoop = function.ForLoop();
+        forLoop.Begin(sampleSize);
+        {
+            auto i = forLoop.LoadIterationVariable();
+            llvm::Value* pDifference = function.Operator(emitters::GetSubtractForValueType<ValueType>(), function.ValueAt(pInput, i), function.ValueAt(pLastSample, i));
+            llvm::Value* pSum = function.Operator(emitters::GetAddForValueType<ValueType>(), function.ValueAt(pRunningSum, i), pDifference);
+            function.SetValueAt(pRunningSum, i, pSum);
+            function.SetValueAt(pResult, i, function.Operator(emitters::GetDivideForValueType<ValueType>(), pSum, pWindowSize));
+        }
+        forLoop.End();
+
+        compiler.TryMergeRegion(*this);
+    }
+
     template <typename ValueType>
     void MovingAverageNode<ValueType>::WriteToArchive(utilities::Archiver& archiver) const
     {
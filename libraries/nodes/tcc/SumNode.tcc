@@ -49,7 +49,7 @@ namespace nodes
 
         // SumNode has exactly 1 input and 1 output
         auto pInput = this->GetInputPorts()[0];
-        if (IsPureVector(*pInput) && !compiler.GetCompilerParameters().unrollLoops)
+        if (IsLoopableVector(*pInput) && !compiler.GetCompilerParameters().unrollLoops)
         {
             CompileSumLoop(compiler);
         }
@@ -66,7 +66,7 @@ namespace nodes
     {
         auto pInput = this->GetInputPorts()[0];
         auto pOutput = this->GetOutputPorts()[0];
-        llvm::Value* pSrcVector = compiler.EnsureEmitted(pInput);
+        llvm::Value* pSrcVector = compiler.EnsureContiguousInput(pInput);
         llvm::Value* pResult = compiler.EnsureEmitted(pOutput);
         // emitters::Variable& resultVar = *(compiler.GetVariableFor(pOutput));
 
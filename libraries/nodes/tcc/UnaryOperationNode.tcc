@@ -80,37 +80,34 @@ namespace nodes
 
     template <typename ValueType>
     template <typename Operation>
-    std::vector<ValueType> UnaryOperationNode<ValueType>::ComputeOutput(Operation&& function) const
+    std::vector<ValueType> UnaryOperationNode<ValueType>::ComputeOutput(const std::vector<ValueType>& input, Operation&& function) const
     {
-        auto output = std::vector<ValueType>(_input.Size());
-        for (size_t index = 0; index < _input.Size(); index++)
+        auto output = std::vector<ValueType>(input.size());
+        for (size_t index = 0; index < input.size(); index++)
         {
-            output[index] = function(_input[index]);
+            output[index] = function(input[index]);
         }
         return output;
     }
 
     template <typename ValueType>
-    void UnaryOperationNode<ValueType>::Compute() const
+    std::vector<ValueType> UnaryOperationNode<ValueType>::ComputeOutput(const std::vector<ValueType>& input) const
     {
-        std::vector<ValueType> output;
         switch (_operation)
         {
             case emitters::UnaryOperationType::sqrt:
-            {
-                output = ComputeOutput(UnaryOperations::Sqrt<ValueType>);
-            }
-            break;
+                return ComputeOutput(input, UnaryOperations::Sqrt<ValueType>);
             case emitters::UnaryOperationType::logicalNot:
-            {
-                output = ComputeOutput(UnaryOperations::LogicalNot<ValueType>);
-            }
-            break;
-
+                return ComputeOutput(input, UnaryOperations::LogicalNot<ValueType>);
             default:
                 throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented, "Unknown operation type");
         }
-        _output.SetOutput(output);
+    }
+
+    template <typename ValueType>
+    void UnaryOperationNode<ValueType>::Compute() const
+    {
+        _output.SetOutput(ComputeOutput(_input.GetValue()));
     };
 
     template <typename ValueType>
@@ -121,6 +118,22 @@ namespace nodes
         transformer.MapNodeOutput(output, newNode->output);
     }
 
+    template <typename ValueType>
+    bool UnaryOperationNode<ValueType>::Optimize(model::ModelTransformer& transformer) const
+    {
+        auto newPortElements = transformer.TransformPortElements(_input.GetPortElements());
+        std::vector<ValueType> values;
+        if (TryGetConstantValues(newPortElements, values))
+        {
+            auto constantNode = transformer.AddNode<ConstantNode<ValueType>>(ComputeOutput(values));
+            transformer.MapNodeOutput(output, constantNode->output);
+            return true;
+        }
+
+        Copy(transformer);
+        return false;
+    }
+
     template <typename ValueType>
     llvm::Function* UnaryOperationNode<ValueType>::GetOperator(model::IRMapCompiler& compiler) const
     {
@@ -143,7 +156,7 @@ namespace nodes
 
         auto inputPort = GetInputPorts()[0];
 
-        if (IsPureVector(*inputPort) && !compiler.GetCompilerParameters().unrollLoops)
+        if (IsLoopableVector(*inputPort) && !compiler.GetCompilerParameters().unrollLoops)
         {
             CompileUnaryOperationLoop(compiler);
         }
@@ -162,7 +175,7 @@ namespace nodes
         auto inputPort = GetInputPorts()[0];
         auto outputPort = GetOutputPorts()[0];
         auto count = inputPort->Size();
-        llvm::Value* pInput = compiler.EnsureEmitted(inputPort);
+        llvm::Value* pInput = compiler.EnsureContiguousInput(inputPort);
         llvm::Value* pResult = compiler.EnsureEmitted(outputPort);
         auto& function = compiler.GetCurrentFunction();
 
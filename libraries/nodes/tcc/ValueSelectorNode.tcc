@@ -13,13 +13,13 @@ namespace nodes
 {
     template <typename ValueType>
     ValueSelectorNode<ValueType>::ValueSelectorNode()
-        : Node({ &_condition, &_input1, &_input2 }, { &_output }), _condition(this, {}, conditionPortName), _input1(this, {}, input1PortName), _input2(this, {}, input2PortName), _output(this, outputPortName, 0)
+        : CompilableNode({ &_condition, &_input1, &_input2 }, { &_output }), _condition(this, {}, conditionPortName), _input1(this, {}, input1PortName), _input2(this, {}, input2PortName), _output(this, outputPortName, 0)
     {
     }
 
     template <typename ValueType>
     ValueSelectorNode<ValueType>::ValueSelectorNode(const model::PortElements<bool>& condition, const model::PortElements<ValueType>& input1, const model::PortElements<ValueType>& input2)
-        : Node({ &_condition, &_input1, &_input2 }, { &_output }), _condition(this, condition, conditionPortName), _input1(this, input1, input1PortName), _input2(this, input2, input2PortName), _output(this, outputPortName, input1.Size())
+        : CompilableNode({ &_condition, &_input1, &_input2 }, { &_output }), _condition(this, condition, conditionPortName), _input1(this, input1, input1PortName), _input2(this, input2, input2PortName), _output(this, outputPortName, input1.Size())
     {
         if (condition.Size() != 1)
         {
@@ -39,6 +39,57 @@ namespace nodes
         _output.SetOutput(cond ? _input1.GetValue() : _input2.GetValue());
     };
 
+    template <typename ValueType>
+    void ValueSelectorNode<ValueType>::Compile(model::IRMapCompiler& compiler)
+    {
+        compiler.NewBlockRegion(*this);
+
+        auto conditionPort = GetInputPorts()[0];
+        auto input1Port = GetInputPorts()[1];
+        auto input2Port = GetInputPorts()[2];
+        auto outputPort = GetOutputPorts()[0];
+        VerifyIsScalar(*conditionPort);
+        auto& function = compiler.GetCurrentFunction();
+
+        llvm::Value* pCondition = compiler.LoadVariable(conditionPort);
+        llvm::Value* pResult = compiler.EnsureEmitted(outputPort);
+        auto size = static_cast<int>(outputPort->Size());
+        if (size == 1)
+        {
+            llvm::Value* pValue1 = compiler.LoadVariable(input1Port);
+            llvm::Value* pValue2 = compiler.LoadVariable(input2Port);
+            emitters::IRIfEmitter ife = function.If();
+            ife.If(emitters::TypedComparison::equals, pCondition, function.Literal(0));
+            {
+                function.Store(pResult, pValue2);
+            }
+            ife.Else();
+            {
+                function.Store(pResult, pValue1);
+            }
+            ife.End();
+        }
+        else
+        {
+            // copy the selected input with a single block copy, instead of selecting element by element
+            using ElementType = typename emitters::VariableValueType<ValueType>::type;
+            llvm::Value* pInput1 = compiler.EnsureContiguousInput(input1Port);
+            llvm::Value* pInput2 = compiler.EnsureContiguousInput(input2Port);
+            emitters::IRIfEmitter ife = function.If();
+            ife.If(emitters::TypedComparison::equals, pCondition, function.Literal(0));
+            {
+                function.MemoryCopy<ElementType>(pInput2, 0, pResult, 0, size);
+            }
+            ife.Else();
+            {
+                function.MemoryCopy<ElementType>(pInput1, 0, pResult, 0, size);
+            }
+            ife.End();
+        }
+
+        compiler.TryMergeRegion(*this);
+    }
+
     template <typename ValueType>
     void ValueSelectorNode<ValueType>::WriteToArchive(utilities::Archiver& archiver) const
     {
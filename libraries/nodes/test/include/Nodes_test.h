@@ -20,6 +20,7 @@ void TestBinaryOperationNodeCompute();
 void TestLinearPredictorNodeCompute();
 void TestDemultiplexerNodeCompute();
 void TestDTWDistanceNodeCompute();
+void TestDTWBankNodeCompute();
 
 // Refinement
 void TestMovingAverageNodeRefine();
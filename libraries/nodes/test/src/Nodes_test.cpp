@@ -12,6 +12,7 @@
 // nodes
 #include "AccumulatorNode.h"
 #include "BinaryOperationNode.h"
+#include "DTWBankNode.h"
 #include "DTWDistanceNode.h"
 #include "DelayNode.h"
 #include "DemultiplexerNode.h"
@@ -430,4 +431,29 @@ void TestDTWDistanceNodeCompute()
         if (sampleIndex + increment >= prototypeLength) std::cout << std::endl;
     }
 }
+
+void TestDTWBankNodeCompute()
+{
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(3);
+    auto prototype1 = GetNextSlidePrototype();
+    std::vector<std::vector<double>> prototype2(prototype1.rbegin(), prototype1.rend());
+    auto bankNode = model.AddNode<nodes::DTWBankNode<double>>(inputNode->output, std::vector<std::vector<std::vector<double>>>{ prototype1, prototype2 });
+    auto dtwNode1 = model.AddNode<nodes::DTWDistanceNode<double>>(inputNode->output, prototype1);
+    auto dtwNode2 = model.AddNode<nodes::DTWDistanceNode<double>>(inputNode->output, prototype2);
+
+    // the bank must compute the same distances as one DTWDistanceNode per prototype
+    bool ok = true;
+    auto prototypeLength = prototype1.size();
+    size_t increment = 3;
+    for (size_t index = 0; index < 100; ++index)
+    {
+        inputNode->SetInput(prototype1[(index * increment) % prototypeLength]);
+        auto bankOutput = model.ComputeOutput(bankNode->output);
+        auto output1 = model.ComputeOutput(dtwNode1->output);
+        auto output2 = model.ComputeOutput(dtwNode2->output);
+        ok = ok && bankOutput.size() == 2 && testing::IsEqual(bankOutput[0], output1[0]) && testing::IsEqual(bankOutput[1], output2[0]);
+    }
+    testing::ProcessTest("Testing DTWBankNode compute", ok);
+}
 }
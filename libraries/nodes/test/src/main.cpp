@@ -35,6 +35,7 @@ int main()
         TestLinearPredictorNodeCompute();
         TestDemultiplexerNodeCompute();
         TestDTWDistanceNodeCompute();
+        TestDTWBankNodeCompute();
 
         TestMovingAverageNodeRefine();
         TestLinearPredictorNodeRefine();
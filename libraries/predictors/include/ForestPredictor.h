@@ -280,6 +280,30 @@ namespace predictors
         /// <returns> The edge indicator vector. </returns>
         std::vector<bool> GetEdgeIndicatorVector(const DataVectorType& input, size_t interiorNodeIndex) const;
 
+        /// <summary> Evaluates the forest with a single walk down each tree, and writes the forest output,
+        /// the output of each tree and the edge path indicator vector into caller-provided buffers. Any of
+        /// the buffers can be nullptr, in which case the corresponding output is not computed. The vectors
+        /// are resized to NumTrees() and NumEdges(), which does not allocate when they are reused. </summary>
+        ///
+        /// <typeparam name="InputVectorType"> The input vector type, which must be accepted by the split rules and edge predictors. </typeparam>
+        /// <param name="input"> The input vector. </param>
+        /// <param name="pOutput"> [out] The forest output, including the bias term, or nullptr. </param>
+        /// <param name="pTreeOutputs"> [out] The output of each tree, or nullptr. </param>
+        /// <param name="pEdgeIndicator"> [out] The edge path indicator vector, or nullptr. </param>
+        template <typename InputVectorType>
+        void Predict(const InputVectorType& input, double* pOutput, std::vector<double>* pTreeOutputs, std::vector<bool>* pEdgeIndicator) const;
+
+        /// <summary> Computes the outputs of the forest for a batch of inputs. The inputs are processed in
+        /// small blocks, and each tree is evaluated on all the inputs of a block before moving on to the next
+        /// tree, so that both the tree and the block stay in cache. This is much faster than calling Predict
+        /// on each input when the forest is large. </summary>
+        ///
+        /// <typeparam name="InputVectorType"> The input vector type, which must be accepted by the split rules and edge predictors. </typeparam>
+        /// <param name="inputs"> Pointers to the input vectors. </param>
+        /// <param name="outputs"> [out] Pointer to an array that receives the forest output, including the bias term, of each input. </param>
+        template <typename InputVectorType>
+        void PredictBatch(const std::vector<const InputVectorType*>& inputs, double* outputs) const;
+
         /// <summary> Gets a SplittableNodeId that represents the root of a new tree. </summary>
         ///
         /// <returns> A root node identifier. </returns>
@@ -361,6 +385,9 @@ namespace predictors
 
         size_t AddInteriorNode(const SplitAction& splitAction);
 
+        template <typename InputVectorType>
+        double GetSubtreeOutput(const InputVectorType& input, size_t interiorNodeIndex) const;
+
         void VisitEdgePathToLeaf(const DataVectorType& input, size_t interiorNodeIndex, std::function<void(const InteriorNode&, size_t edgePosition)> operation) const;
 
         //
@@ -11,6 +11,7 @@
 #include "IPredictor.h"
 
 // math
+#include "Matrix.h"
 #include "Vector.h"
 
 // datasets
@@ -85,6 +86,12 @@ namespace predictors
         /// <returns> The prediction. </returns>
         double Predict(const DataVectorType& dataVector) const;
 
+        /// <summary> Computes the outputs of the predictor for a batch of examples with a single matrix-vector product. </summary>
+        ///
+        /// <param name="examples"> A row major matrix with one dense example per row, and at most Size() columns. </param>
+        /// <param name="outputs"> [out] A column vector with one entry per example, used to store the predictions. </param>
+        void PredictBatch(math::ConstMatrixReference<double, math::MatrixLayout::rowMajor> examples, math::ColumnVectorReference<double> outputs) const;
+
         /// <summary> Returns a vector of dataVector elements weighted by the predictor weights. </summary>
         ///
         /// <param name="example"> The data vector. </param>
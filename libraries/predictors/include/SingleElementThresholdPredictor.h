@@ -18,6 +18,7 @@
 
 // stl
 #include <iostream>
+#include <vector>
 
 namespace ell
 {
@@ -72,6 +73,13 @@ namespace predictors
         /// <returns> The result of the split rule. </returns>
         bool Predict(const DataVectorType& inputVector) const;
 
+        /// <summary> Evaluates the split rule on a dense vector of doubles. </summary>
+        ///
+        /// <param name="inputVector"> The input vector. </param>
+        ///
+        /// <returns> The result of the split rule. </returns>
+        bool Predict(const std::vector<double>& inputVector) const;
+
         /// <summary> Returns the number of outputs (the max output value plus one). </summary>
         ///
         /// <returns> The number of outputs. </returns>
@@ -8,6 +8,12 @@
 
 #include "LinearPredictor.h"
 
+// math
+#include "Operations.h"
+
+// utilities
+#include "Exception.h"
+
 // stl
 #include <memory>
 
@@ -46,6 +52,18 @@ namespace predictors
         return dataVector.Dot(_w) + _b;
     }
 
+    void LinearPredictor::PredictBatch(math::ConstMatrixReference<double, math::MatrixLayout::rowMajor> examples, math::ColumnVectorReference<double> outputs) const
+    {
+        if (examples.NumRows() != outputs.Size() || examples.NumColumns() > _w.Size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Incompatible examples, outputs and predictor sizes.");
+        }
+
+        // outputs = examples * w + b, where missing trailing columns are treated as zeros
+        outputs.Fill(_b);
+        math::Operations::Multiply(1.0, examples, _w.GetSubVector(0, examples.NumColumns()), 1.0, outputs);
+    }
+
     auto LinearPredictor::GetWeightedElements(const DataVectorType& dataVector) const -> DataVectorType
     {
         auto mapper = [&](data::IndexValue indexValue) -> double { return indexValue.value * _w[indexValue.index]; };
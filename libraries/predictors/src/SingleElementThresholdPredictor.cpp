@@ -39,6 +39,16 @@ namespace predictors
         return inputVector[_index] > _threshold;
     }
 
+    bool SingleElementThresholdPredictor::Predict(const std::vector<double>& inputVector) const
+    {
+        if (inputVector.size() <= _index)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange);
+        }
+
+        return inputVector[_index] > _threshold;
+    }
+
     void SingleElementThresholdPredictor::PrintLine(std::ostream& os, size_t tabs) const
     {
         os << std::string(tabs * 4, ' ') << "index = " << _index << ", threshold = " << _threshold << "\n";
@@ -115,11 +115,80 @@ namespace predictors
             return 0.0;
         }
 
-        double output = 0.0;
+        return GetSubtreeOutput(input, interiorNodeIndex);
+    }
 
-        VisitEdgePathToLeaf(input, interiorNodeIndex, [&](const InteriorNode& interiorNode, size_t edgePosition) { output += interiorNode._outgoingEdges[edgePosition]._predictor.Predict(input); });
+    template <typename SplitRuleType, typename EdgePredictorType>
+    template <typename InputVectorType>
+    void ForestPredictor<SplitRuleType, EdgePredictorType>::Predict(const InputVectorType& input, double* pOutput, std::vector<double>* pTreeOutputs, std::vector<bool>* pEdgeIndicator) const
+    {
+        if (pTreeOutputs != nullptr)
+        {
+            pTreeOutputs->assign(_rootIndices.size(), 0.0);
+        }
+        if (pEdgeIndicator != nullptr)
+        {
+            pEdgeIndicator->assign(_numEdges, false);
+        }
+        bool computeOutputs = pOutput != nullptr || pTreeOutputs != nullptr;
 
-        return output;
+        double output = _bias;
+        for (size_t treeIndex = 0; treeIndex < _rootIndices.size(); ++treeIndex)
+        {
+            // same walk as VisitEdgePathToLeaf, without calling through a std::function at every edge
+            double treeOutput = 0.0;
+            size_t nodeIndex = _rootIndices[treeIndex];
+            do
+            {
+                const auto& interiorNode = _interiorNodes[nodeIndex];
+                int edgePosition = static_cast<int>(interiorNode._splitRule.Predict(input));
+                if (edgePosition < 0)
+                {
+                    break;
+                }
+
+                const auto& edge = interiorNode._outgoingEdges[edgePosition];
+                if (computeOutputs)
+                {
+                    treeOutput += edge._predictor.Predict(input);
+                }
+                if (pEdgeIndicator != nullptr)
+                {
+                    (*pEdgeIndicator)[interiorNode._firstEdgeIndex + edgePosition] = true;
+                }
+                nodeIndex = edge.GetTargetNodeIndex();
+            } while (nodeIndex != 0);
+
+            if (pTreeOutputs != nullptr)
+            {
+                (*pTreeOutputs)[treeIndex] = treeOutput;
+            }
+            output += treeOutput;
+        }
+
+        if (pOutput != nullptr)
+        {
+            *pOutput = output;
+        }
+    }
+
+    template <typename SplitRuleType, typename EdgePredictorType>
+    template <typename InputVectorType>
+    void ForestPredictor<SplitRuleType, EdgePredictorType>::PredictBatch(const std::vector<const InputVectorType*>& inputs, double* outputs) const
+    {
+        const size_t blockSize = 64;
+        for (size_t blockBegin = 0; blockBegin < inputs.size(); blockBegin += blockSize)
+        {
+            size_t blockEnd = std::min(blockBegin + blockSize, inputs.size());
+            std::fill(outputs + blockBegin, outputs + blockEnd, _bias);
+            for (auto treeRootIndex : _rootIndices)
+            {
+                for (size_t i = blockBegin; i < blockEnd; ++i)
+                {
+                    outputs[i] += GetSubtreeOutput(*inputs[i], treeRootIndex);
+                }
+            }
+        }
     }
 
     template <typename SplitRuleType, typename EdgePredictorType>
@@ -261,6 +330,30 @@ namespace predictors
         return interiorNodeIndex;
     }
 
+    template <typename SplitRuleType, typename EdgePredictorType>
+    template <typename InputVectorType>
+    double ForestPredictor<SplitRuleType, EdgePredictorType>::GetSubtreeOutput(const InputVectorType& input, size_t interiorNodeIndex) const
+    {
+        // same walk as VisitEdgePathToLeaf, without calling through a std::function at every edge
+        double output = 0.0;
+        size_t nodeIndex = interiorNodeIndex;
+        do
+        {
+            const auto& interiorNode = _interiorNodes[nodeIndex];
+            int edgePosition = static_cast<int>(interiorNode._splitRule.Predict(input));
+            if (edgePosition < 0)
+            {
+                break;
+            }
+
+            const auto& edge = interiorNode._outgoingEdges[edgePosition];
+            output += edge._predictor.Predict(input);
+            nodeIndex = edge.GetTargetNodeIndex();
+        } while (nodeIndex != 0);
+
+        return output;
+    }
+
     template <typename SplitRuleType, typename EdgePredictorType>
     void ForestPredictor<SplitRuleType, EdgePredictorType>::VisitEdgePathToLeaf(const DataVectorType& input, size_t interiorNodeIndex, std::function<void(const InteriorNode&, size_t edgePosition)> operation) const
     {
@@ -7,6 +7,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "ForestPredictor.h"
+#include "LinearPredictor.h"
 
 // testing
 #include "testing.h"
@@ -65,6 +66,60 @@ void ForestPredictorTest()
     // test path generation
     auto edgeIndicator = forest.GetEdgeIndicatorVector(ExampleType{ 0.25, 0.7, 0.0 });
     testing::ProcessTest("Testing SetEdgeIndicatorVector()", testing::IsEqual(edgeIndicator, std::vector<bool>{ 1, 0, 0, 1, 0, 0, 0, 1 }));
+
+    // test single-pass prediction into reused buffers
+    std::vector<double> treeOutputs;
+    std::vector<bool> fusedEdgeIndicator;
+    forest.Predict(std::vector<double>{ 0.5, 0.7, 1.0 }, &output, &treeOutputs, &fusedEdgeIndicator);
+    forest.Predict(std::vector<double>{ 0.25, 0.7, 0.0 }, &output, &treeOutputs, &fusedEdgeIndicator);
+    testing::ProcessTest("Testing single-pass Predict()", testing::IsEqual(output, 4.0, 1.0e-8) && testing::IsEqual(treeOutputs, std::vector<double>{ 1.0, 3.0 }) && testing::IsEqual(fusedEdgeIndicator, edgeIndicator));
+
+    double outputOnly = 0.0;
+    forest.Predict(std::vector<double>{ 0.18, 0.5, 0.0 }, &outputOnly, nullptr, nullptr);
+    testing::ProcessTest("Testing single-pass Predict() without optional outputs", testing::IsEqual(outputOnly, -6.0, 1.0e-8));
+
+    // test batch prediction, with more inputs than fit in a block
+    forest.AddToBias(0.5);
+    std::vector<ExampleType> inputs;
+    for (size_t i = 0; i < 100; ++i)
+    {
+        inputs.push_back(ExampleType{ 0.01 * i, 0.7 - 0.005 * i, 0.01 * i });
+    }
+    std::vector<const ExampleType*> inputPointers;
+    std::vector<double> expectedOutputs;
+    for (const auto& input : inputs)
+    {
+        inputPointers.push_back(&input);
+        expectedOutputs.push_back(forest.Predict(input));
+    }
+    std::vector<double> batchOutputs(inputs.size());
+    forest.PredictBatch(inputPointers, batchOutputs.data());
+    testing::ProcessTest("Testing PredictBatch()", testing::IsEqual(batchOutputs, expectedOutputs));
+}
+
+void LinearPredictorTest()
+{
+    predictors::LinearPredictor predictor(math::ColumnVector<double>{ 1.0, -2.0, 0.5 }, 0.25);
+
+    math::Matrix<double, math::MatrixLayout::rowMajor> examples{
+        { 1.0, 1.0, 2.0 },
+        { 0.0, 3.0, -4.0 },
+        { 2.0, 0.0, 0.0 }
+    };
+    math::ColumnVector<double> outputs(3);
+    predictor.PredictBatch(examples, outputs);
+
+    bool batchMatches = true;
+    for (size_t i = 0; i < examples.NumRows(); ++i)
+    {
+        auto row = examples.GetRow(i);
+        auto output = predictor.Predict(data::AutoDataVector(std::vector<double>{ row[0], row[1], row[2] }));
+        batchMatches = batchMatches && testing::IsEqual(outputs[i], output, 1.0e-8);
+    }
+    testing::ProcessTest("Testing LinearPredictor::PredictBatch()", batchMatches && testing::IsEqual(outputs[0], 0.25, 1.0e-8));
+
+    predictor.PredictBatch(examples.GetSubMatrix(0, 0, 2, 2), outputs.GetSubVector(0, 2));
+    testing::ProcessTest("Testing LinearPredictor::PredictBatch() with fewer columns", testing::IsEqual(outputs[0], -0.75, 1.0e-8) && testing::IsEqual(outputs[1], -5.75, 1.0e-8));
 }
 
 /// Runs all tests
@@ -72,6 +127,7 @@ void ForestPredictorTest()
 int main()
 {
     ForestPredictorTest();
+    LinearPredictorTest();
 
     if (testing::DidTestFail())
     {
@@ -19,11 +19,18 @@
 
 // utilities
 #include "OutputStreamImpostor.h"
+#include "RandomEngines.h"
 
 // stl
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <memory>
+#include <numeric>
 #include <queue>
+#include <random>
+#include <string>
+#include <vector>
 
 namespace ell
 {
@@ -36,6 +43,17 @@ namespace trainers
         double minSplitGain = 0.0;
         size_t maxSplitsPerRound = 0;
         size_t numRounds = 0;
+        std::string randomSeed;
+
+        // row subsampling: each round grows its tree on the largeGradientFraction of rows with the largest weighted
+        // weak labels (gradients), plus a uniform sample of rowSampleFraction of all rows taken from the rest, whose
+        // weights are scaled up to keep the sums unbiased. The defaults use every row.
+        double rowSampleFraction = 1.0;
+        double largeGradientFraction = 0.0;
+
+        // feature subsampling: the fraction of features that split rules may use, drawn once per tree or at every node
+        double featureSampleFraction = 1.0;
+        bool sampleFeaturesPerNode = false;
     };
 
     /// <summary> Nontemplated base class for forest trainers, provides some reusable internal classes. </summary>
@@ -74,22 +92,6 @@ namespace trainers
             std::vector<size_t> _firstIndex;
         };
 
-        // metadata that the forest trainer keeps with each example
-        struct TrainerMetadata
-        {
-            TrainerMetadata(const data::WeightLabel& metaData);
-            void Print(std::ostream& os) const;
-
-            // strong weight and label
-            data::WeightLabel strong;
-
-            // weak weight and label
-            data::WeightLabel weak;
-
-            // the output of the forest on this example
-            double currentOutput = 0;
-        };
-
         // keeps statistics about tree nodes
         struct NodeStats
         {
@@ -106,7 +108,10 @@ namespace trainers
     };
 
     /// <summary>
-    /// Implements a greedy forest growing algorithm.
+    /// Implements a greedy forest growing algorithm. The examples are stored once and never reordered; the boosting
+    /// state (strong and weak weights and labels, and the current forest output) is kept in contiguous arrays indexed
+    /// by example, and tree nodes own contiguous ranges of a row permutation that maps rows to examples. When rows
+    /// are subsampled, the rows of the current round's sample occupy the front of the row permutation.
     /// </summary>
     ///
     /// <typeparam name="LossFunctionType"> Type of loss function to optimize. </typeparam>
@@ -116,7 +121,7 @@ namespace trainers
     public:
         using PredictorType = typename predictors::ForestPredictor<SplitRuleType, EdgePredictorType>;
         using DataVectorType = typename PredictorType::DataVectorType;
-        using TrainerExampleType = data::Example<DataVectorType, TrainerMetadata>;
+        using TrainerExampleType = data::Example<DataVectorType, data::WeightLabel>;
 
         /// <summary> Constructs an instance of ForestTrainer. </summary>
         ///
@@ -134,6 +139,12 @@ namespace trainers
         /// <returns> A const reference to the current predictor. </returns>
         virtual const PredictorType& GetPredictor() const override { return _forest; };
 
+        /// <summary> Sets the forest that training continues from (warm start), for example a forest that
+        /// was loaded from a model file. Subsequent calls to Update add trees to this forest. </summary>
+        ///
+        /// <param name="predictor"> The forest. </param>
+        void SetPredictor(const PredictorType& predictor) { _forest = predictor; }
+
     protected:
         //
         // Private internal structs
@@ -167,7 +178,7 @@ namespace trainers
         // private member functions
         //
 
-        // initializes weak weights and labels, as well as currentOutput
+        // initializes the row permutation and the boosting state: strong and weak weights and labels, and current outputs
         void InitializeMetadata();
 
         // performs an epoch of splits
@@ -176,13 +187,27 @@ namespace trainers
         // runs the booster and sets the weak weight and weak labels
         Sums SetWeakWeightsLabels();
 
-        // updates the currentOutput field in the metadata of a range of examples
+        // updates the current outputs of all examples, or of the examples in a range of rows
         void UpdateCurrentOutputs(double value);
         void UpdateCurrentOutputs(Range range, const EdgePredictorType& edgePredictor);
 
-        // after performing a split, we rearrange the data set to ensure that each node's examples occupy contiguous rows in the dataset
+        // after performing a split, we rearrange the row permutation to ensure that each node's examples occupy contiguous rows
         void SortNodeDataset(Range range, const SplitRuleType& splitRule);
 
+        // moves the rows that participate in the current round to the front of the row permutation, scales their weak
+        // weights as needed, and returns the number of sampled rows
+        size_t SampleRows();
+
+        // chooses the features that split rules may use
+        void SampleFeatures();
+
+        // gets the sorted indices of the features that a derived class should consider when splitting a node
+        const std::vector<size_t>& GetCandidateFeatures();
+
+        // gets the data vector and the weak weight and label of the example in a given row
+        const DataVectorType& GetDataVector(size_t rowIndex) const { return _dataset[_rowIndices[rowIndex]].GetDataVector(); }
+        const data::WeightLabel& GetWeakWeightLabel(size_t rowIndex) const { return _weakWeightsLabels[_rowIndices[rowIndex]]; }
+
         //
         // implementation specific functions that must be implemented by a derived class
         //
@@ -204,8 +229,20 @@ namespace trainers
         // the priority queue that holds the split candidates
         SplitCandidatePriorityQueue _queue;
 
-        // the data set
+        // the data set, with the strong weight and label of each example as its metadata
         data::Dataset<TrainerExampleType> _dataset;
+
+        // the row permutation: row i refers to example _rowIndices[i]
+        std::vector<size_t> _rowIndices;
+
+        // the boosting state, indexed by example
+        std::vector<data::WeightLabel> _strongWeightsLabels;
+        std::vector<data::WeightLabel> _weakWeightsLabels;
+        std::vector<double> _currentOutputs;
+
+        // the features that split rules may currently use, and the random engine used for sampling
+        std::vector<size_t> _featureIndices;
+        std::default_random_engine _random;
     };
 }
 }
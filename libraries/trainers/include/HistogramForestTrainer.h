@@ -26,7 +26,6 @@ namespace trainers
     /// <summary> Parameters for the forest trainer. </summary>
     struct HistogramForestTrainerParameters : public virtual ForestTrainerParameters
     {
-        std::string randomSeed;
         size_t thresholdFinderSampleSize;
         size_t candidatesPerInput;
     };
@@ -54,10 +53,15 @@ namespace trainers
         using typename ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::SplittableNodeId;
         using typename ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::NodeStats;
         using typename ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::Range;
+        using typename ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::NodeRanges;
         using typename ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::Sums;
 
     protected:
+        using typename ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::TrainerExampleType;
         using ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::_dataset;
+        using ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::_rowIndices;
+        using ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::_weakWeightsLabels;
+        using ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::_random;
         virtual SplitCandidate GetBestSplitRuleAtNode(SplittableNodeId nodeId, Range range, Sums sums) override;
         virtual std::vector<EdgePredictorType> GetEdgePredictors(const NodeStats& nodeStats) override;
 
@@ -75,7 +79,6 @@ namespace trainers
         // member variables
         LossFunctionType _lossFunction;
         ThresholdFinderType _thresholdFinder;
-        std::default_random_engine _random;
         size_t _thresholdFinderSampleSize;
         size_t _candidatesPerInput;
     };
@@ -85,10 +88,11 @@ namespace trainers
     /// <typeparam name="LossFunctionType"> Type of loss function to use. </typeparam>
     /// <param name="lossFunction"> The loss function. </param>
     /// <param name="parameters"> The trainer parameters. </param>
+    /// <param name="initialPredictor"> The forest that training continues from, which is empty by default. </param>
     ///
     /// <returns> A unique_ptr to a simple forest trainer. </returns>
     template <typename LossFunctionType, typename BoosterType, typename ThresholdFinderType>
-    std::unique_ptr<ITrainer<predictors::SimpleForestPredictor>> MakeHistogramForestTrainer(const LossFunctionType& lossFunction, const BoosterType& booster, const ThresholdFinderType& thresholdFinder, const HistogramForestTrainerParameters& parameters);
+    std::unique_ptr<ITrainer<predictors::SimpleForestPredictor>> MakeHistogramForestTrainer(const LossFunctionType& lossFunction, const BoosterType& booster, const ThresholdFinderType& thresholdFinder, const HistogramForestTrainerParameters& parameters, const predictors::SimpleForestPredictor& initialPredictor = predictors::SimpleForestPredictor());
 }
 }
 
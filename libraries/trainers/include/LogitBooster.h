@@ -11,6 +11,9 @@
 // data
 #include "Example.h"
 
+// stl
+#include <cstddef>
+
 namespace ell
 {
 namespace trainers
@@ -31,6 +34,16 @@ namespace trainers
         /// <returns> The weak weight and label. </returns>
         data::WeightLabel GetWeakWeightLabel(const data::WeightLabel& strongWeightLabel, double prediction) const;
 
+        /// <summary> Calculates the weak weights and labels of an array of examples. The weights are computed
+        /// with math::FastMath::Logistic, whose relative error is below 1e-15, in a loop that the compiler
+        /// can vectorize. </summary>
+        ///
+        /// <param name="strongWeightsLabels"> Pointer to the strong weights and labels. </param>
+        /// <param name="predictions"> Pointer to the predictions. </param>
+        /// <param name="weakWeightsLabels"> Pointer to an array that receives the weak weights and labels. </param>
+        /// <param name="count"> The number of examples. </param>
+        void GetWeakWeightsLabels(const data::WeightLabel* strongWeightsLabels, const double* predictions, data::WeightLabel* weakWeightsLabels, size_t count) const;
+
     private:
         double _scale;
     };
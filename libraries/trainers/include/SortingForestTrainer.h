@@ -46,14 +46,15 @@ namespace trainers
         using typename ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::SplittableNodeId;
         using typename ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::NodeStats;
         using typename ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::Range;
+        using typename ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::NodeRanges;
         using typename ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::Sums;
-        using typename ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::TrainerMetadata;
         using typename ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::PredictorType;
         using typename ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::DataVectorType;
         using typename ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::TrainerExampleType;
 
     protected:
         using ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::_dataset;
+        using ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::_rowIndices;
         virtual SplitCandidate GetBestSplitRuleAtNode(SplittableNodeId nodeId, Range range, Sums sums) override;
         virtual std::vector<EdgePredictorType> GetEdgePredictors(const NodeStats& nodeStats) override;
 
@@ -70,10 +71,11 @@ namespace trainers
     /// <typeparam name="LossFunctionType"> Type of loss function to use. </typeparam>
     /// <param name="lossFunction"> The loss function. </param>
     /// <param name="parameters"> The trainer parameters. </param>
+    /// <param name="initialPredictor"> The forest that training continues from, which is empty by default. </param>
     ///
     /// <returns> A unique_ptr to a simple forest trainer. </returns>
     template <typename LossFunctionType, typename BoosterType>
-    std::unique_ptr<ITrainer<predictors::SimpleForestPredictor>> MakeSortingForestTrainer(const LossFunctionType& lossFunction, const BoosterType& booster, const SortingForestTrainerParameters& parameters);
+    std::unique_ptr<ITrainer<predictors::SimpleForestPredictor>> MakeSortingForestTrainer(const LossFunctionType& lossFunction, const BoosterType& booster, const SortingForestTrainerParameters& parameters, const predictors::SimpleForestPredictor& initialPredictor = predictors::SimpleForestPredictor());
 }
 }
 
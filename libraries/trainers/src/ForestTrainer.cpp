@@ -106,19 +106,9 @@ namespace trainers
         return _childSums[position];
     }
 
-    ForestTrainerBase::TrainerMetadata::TrainerMetadata(const data::WeightLabel& metaData)
-        : strong(metaData)
-    {
-    }
-
     //
     // debugging code
     //
-    void ForestTrainerBase::TrainerMetadata::Print(std::ostream& os) const
-    {
-        os << "(" << strong.weight << ", " << strong.label << ", " << weak.weight << ", " << weak.label << ", " << currentOutput << ")";
-    }
-
     void ForestTrainerBase::NodeStats::PrintLine(std::ostream& os, size_t tabs) const
     {
         os << std::string(tabs * 4, ' ') << "stats:\n";
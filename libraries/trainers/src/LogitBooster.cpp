@@ -8,6 +8,10 @@
 
 #include "LogitBooster.h"
 
+// math
+#include "FastMath.h"
+
+// stl
 #include <cmath>
 
 namespace ell
@@ -32,5 +36,14 @@ namespace trainers
             return { strongWeightLabel.weight / (1.0 + exp(scaledMargin)), strongWeightLabel.label };
         }
     }
+
+    void LogitBooster::GetWeakWeightsLabels(const data::WeightLabel* strongWeightsLabels, const double* predictions, data::WeightLabel* weakWeightsLabels, size_t count) const
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            double scaledMargin = _scale * strongWeightsLabels[i].label * predictions[i];
+            weakWeightsLabels[i] = { strongWeightsLabels[i].weight * math::FastMath::Logistic(-scaledMargin), strongWeightsLabels[i].label };
+        }
+    }
 }
 }
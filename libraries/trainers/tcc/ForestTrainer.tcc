@@ -15,17 +15,29 @@ namespace trainers
 {
     template <typename SplitRuleType, typename EdgePredictorType, typename BoosterType>
     ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::ForestTrainer(const BoosterType& booster, const ForestTrainerParameters& parameters)
-        : _booster(booster), _parameters(parameters), _forest()
+        : _booster(booster), _parameters(parameters), _forest(), _random(utilities::GetRandomEngine(parameters.randomSeed))
     {
+        if (parameters.rowSampleFraction <= 0.0 || parameters.rowSampleFraction > 1.0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "rowSampleFraction must be in (0, 1]");
+        }
+        if (parameters.largeGradientFraction < 0.0 || parameters.largeGradientFraction > 1.0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "largeGradientFraction must be in [0, 1]");
+        }
+        if (parameters.featureSampleFraction <= 0.0 || parameters.featureSampleFraction > 1.0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "featureSampleFraction must be in (0, 1]");
+        }
     }
 
     template <typename SplitRuleType, typename EdgePredictorType, typename BoosterType>
     void ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::Update(const data::AnyDataset& anyDataset)
     {
-        // materialize a dataset of dense DataVectors with metadata that contains both strong and weak weight and lables for each example
+        // materialize a dataset of dense DataVectors with the strong weight and label of each example as metadata
         _dataset = data::Dataset<TrainerExampleType>(anyDataset);
 
-        // initalizes the speical fields in the dataset metadata: weak weight and label, currentOutput
+        // initalizes the row permutation and the boosting state: weak weights and labels, current outputs
         InitializeMetadata();
 
         // boosting loop (outer loop)
@@ -43,8 +55,23 @@ namespace trainers
             VERBOSE_MODE(std::cout << "\nBoosting iteration\n");
             VERBOSE_MODE(_forest.PrintLine(std::cout, 1));
 
+            // choose the rows and features for this round's tree, and recompute the sums over the sampled rows
+            auto numSampledRows = SampleRows();
+            if (numSampledRows < _rowIndices.size())
+            {
+                sums = Sums();
+                for (size_t rowIndex = 0; rowIndex < numSampledRows; ++rowIndex)
+                {
+                    sums.Increment(GetWeakWeightLabel(rowIndex));
+                }
+            }
+            if (!_parameters.sampleFeaturesPerNode)
+            {
+                SampleFeatures();
+            }
+
             // find split candidate for root node and push it onto the priority queue
-            auto rootSplit = GetBestSplitRuleAtNode(_forest.GetNewRootId(), Range{ 0, _dataset.NumExamples() }, sums);
+            auto rootSplit = GetBestSplitRuleAtNode(_forest.GetNewRootId(), Range{ 0, numSampledRows }, sums);
 
             // check for positive gain
             if (rootSplit.gain < _parameters.minSplitGain || _parameters.maxSplitsPerRound == 0)
@@ -60,7 +87,14 @@ namespace trainers
             _queue.push(std::move(rootSplit));
 
             // start performing splits until the maximum is reached or the queue is empty
+            auto rootInteriorNodeIndex = _forest.NumInteriorNodes();
             PerformSplits(_parameters.maxSplitsPerRound);
+
+            // the splits only updated the current outputs of the sampled rows
+            for (size_t rowIndex = numSampledRows; rowIndex < _rowIndices.size(); ++rowIndex)
+            {
+                _currentOutputs[_rowIndices[rowIndex]] += _forest.Predict(GetDataVector(rowIndex), rootInteriorNodeIndex);
+            }
         }
     }
 
@@ -73,13 +107,12 @@ namespace trainers
     template <typename SplitRuleType, typename EdgePredictorType, typename BoosterType>
     auto ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::SetWeakWeightsLabels() -> Sums
     {
-        Sums sums;
+        _booster.GetWeakWeightsLabels(_strongWeightsLabels.data(), _currentOutputs.data(), _weakWeightsLabels.data(), _currentOutputs.size());
 
-        for (size_t rowIndex = 0; rowIndex < _dataset.NumExamples(); ++rowIndex)
+        Sums sums;
+        for (const auto& weakWeightLabel : _weakWeightsLabels)
         {
-            auto& metadata = _dataset[rowIndex].GetMetadata();
-            metadata.weak = _booster.GetWeakWeightLabel(metadata.strong, metadata.currentOutput);
-            sums.Increment(metadata.weak);
+            sums.Increment(weakWeightLabel);
         }
 
         if (sums.sumWeights == 0.0)
@@ -93,10 +126,9 @@ namespace trainers
     template <typename SplitRuleType, typename EdgePredictorType, typename BoosterType>
     void ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::UpdateCurrentOutputs(double value)
     {
-        for (size_t rowIndex = 0; rowIndex < _dataset.NumExamples(); ++rowIndex)
+        for (auto& currentOutput : _currentOutputs)
         {
-            auto& example = _dataset[rowIndex];
-            example.GetMetadata().currentOutput += value;
+            currentOutput += value;
         }
     }
 
@@ -105,22 +137,103 @@ namespace trainers
     {
         for (size_t rowIndex = range.firstIndex; rowIndex < range.firstIndex + range.size; ++rowIndex)
         {
-            auto& example = _dataset[rowIndex];
-            example.GetMetadata().currentOutput += edgePredictor.Predict(example.GetDataVector());
+            auto exampleIndex = _rowIndices[rowIndex];
+            _currentOutputs[exampleIndex] += edgePredictor.Predict(_dataset[exampleIndex].GetDataVector());
         }
     }
 
     template <typename SplitRuleType, typename EdgePredictorType, typename BoosterType>
     void ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::InitializeMetadata()
     {
-        for (size_t rowIndex = 0; rowIndex < _dataset.NumExamples(); ++rowIndex)
+        const auto numExamples = _dataset.NumExamples();
+        _rowIndices.resize(numExamples);
+        std::iota(_rowIndices.begin(), _rowIndices.end(), 0);
+
+        _strongWeightsLabels.resize(numExamples);
+        _weakWeightsLabels.resize(numExamples);
+        _currentOutputs.resize(numExamples);
+        std::vector<const DataVectorType*> dataVectors(numExamples);
+        for (size_t exampleIndex = 0; exampleIndex < numExamples; ++exampleIndex)
+        {
+            const auto& example = _dataset[exampleIndex];
+            _strongWeightsLabels[exampleIndex] = example.GetMetadata();
+            dataVectors[exampleIndex] = &example.GetDataVector();
+        }
+
+        // the forest may already hold many trees, from earlier updates or from a warm start
+        _forest.PredictBatch(dataVectors, _currentOutputs.data());
+
+        _booster.GetWeakWeightsLabels(_strongWeightsLabels.data(), _currentOutputs.data(), _weakWeightsLabels.data(), numExamples);
+    }
+
+    template <typename SplitRuleType, typename EdgePredictorType, typename BoosterType>
+    size_t ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::SampleRows()
+    {
+        const auto numExamples = _rowIndices.size();
+        if (_parameters.rowSampleFraction >= 1.0 && _parameters.largeGradientFraction <= 0.0)
+        {
+            return numExamples;
+        }
+
+        // move the rows with the largest gradients to the front
+        auto numLargeGradientRows = std::min(numExamples, static_cast<size_t>(_parameters.largeGradientFraction * numExamples));
+        if (numLargeGradientRows > 0)
+        {
+            std::nth_element(_rowIndices.begin(), _rowIndices.begin() + numLargeGradientRows, _rowIndices.end(), [this](size_t a, size_t b) {
+                return std::abs(_weakWeightsLabels[a].weight * _weakWeightsLabels[a].label) > std::abs(_weakWeightsLabels[b].weight * _weakWeightsLabels[b].label);
+            });
+        }
+
+        // uniformly choose the other rows from the rest, without replacement
+        auto numOtherRows = std::min(numExamples - numLargeGradientRows, static_cast<size_t>(_parameters.rowSampleFraction * numExamples));
+        if (numLargeGradientRows + numOtherRows == 0)
+        {
+            numOtherRows = std::min(numExamples, size_t{ 1 });
+        }
+
+        for (size_t rowIndex = numLargeGradientRows; rowIndex < numLargeGradientRows + numOtherRows; ++rowIndex)
+        {
+            std::uniform_int_distribution<size_t> dist(rowIndex, numExamples - 1);
+            std::swap(_rowIndices[rowIndex], _rowIndices[dist(_random)]);
+        }
+
+        // each uniformly sampled row stands in for the unsampled rows of the rest
+        if (numOtherRows > 0)
+        {
+            double scale = static_cast<double>(numExamples - numLargeGradientRows) / numOtherRows;
+            for (size_t rowIndex = numLargeGradientRows; rowIndex < numLargeGradientRows + numOtherRows; ++rowIndex)
+            {
+                _weakWeightsLabels[_rowIndices[rowIndex]].weight *= scale;
+            }
+        }
+
+        return numLargeGradientRows + numOtherRows;
+    }
+
+    template <typename SplitRuleType, typename EdgePredictorType, typename BoosterType>
+    void ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::SampleFeatures()
+    {
+        const auto numFeatures = _dataset.NumFeatures();
+        _featureIndices.resize(numFeatures);
+        std::iota(_featureIndices.begin(), _featureIndices.end(), 0);
+
+        if (_parameters.featureSampleFraction < 1.0 && numFeatures > 1)
+        {
+            auto numSampledFeatures = std::max(size_t{ 1 }, static_cast<size_t>(_parameters.featureSampleFraction * numFeatures));
+            data::RandomPermute(_featureIndices, _random, numSampledFeatures);
+            _featureIndices.resize(numSampledFeatures);
+            std::sort(_featureIndices.begin(), _featureIndices.end());
+        }
+    }
+
+    template <typename SplitRuleType, typename EdgePredictorType, typename BoosterType>
+    auto ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::GetCandidateFeatures() -> const std::vector<size_t>&
+    {
+        if (_parameters.sampleFeaturesPerNode)
         {
-            auto& example = _dataset[rowIndex];
-            auto prediction = _forest.Predict(example.GetDataVector());
-            auto& metadata = example.GetMetadata();
-            metadata.currentOutput = prediction;
-            metadata.weak = _booster.GetWeakWeightLabel(metadata.strong, prediction);
+            SampleFeatures();
         }
+        return _featureIndices;
     }
 
     template <typename SplitRuleType, typename EdgePredictorType, typename BoosterType>
@@ -181,17 +294,15 @@ namespace trainers
     template <typename SplitRuleType, typename EdgePredictorType, typename BoosterType>
     void ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::SortNodeDataset(Range range, const SplitRuleType& splitRule)
     {
+        auto begin = _rowIndices.begin() + range.firstIndex;
+        auto end = begin + range.size;
         if (splitRule.NumOutputs() == 2)
         {
-            _dataset.Partition([splitRule](const data::Example<DataVectorType, TrainerMetadata>& example) { return splitRule.Predict(example.GetDataVector()) == 0; },
-                               range.firstIndex,
-                               range.size);
+            std::partition(begin, end, [this, &splitRule](size_t exampleIndex) { return splitRule.Predict(_dataset[exampleIndex].GetDataVector()) == 0; });
         }
         else
         {
-            _dataset.Sort([splitRule](const data::Example<DataVectorType, TrainerMetadata>& example) { return splitRule.Predict(example.GetDataVector()); },
-                          range.firstIndex,
-                          range.size);
+            std::sort(begin, end, [this, &splitRule](size_t a, size_t b) { return splitRule.Predict(_dataset[a].GetDataVector()) < splitRule.Predict(_dataset[b].GetDataVector()); });
         }
     }
 
@@ -6,8 +6,10 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-// utilities
-#include "RandomEngines.h"
+// stl
+#include <algorithm>
+#include <random>
+#include <utility>
 
 namespace ell
 {
@@ -15,7 +17,7 @@ namespace trainers
 {
     template <typename LossFunctionType, typename BoosterType, typename ThresholdFinderType>
     HistogramForestTrainer<LossFunctionType, BoosterType, ThresholdFinderType>::HistogramForestTrainer(const LossFunctionType& lossFunction, const BoosterType& booster, const ThresholdFinderType& thresholdFinder, const HistogramForestTrainerParameters& parameters)
-        : ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>(booster, parameters), _lossFunction(lossFunction), _thresholdFinder(thresholdFinder), _random(utilities::GetRandomEngine(parameters.randomSeed)), _thresholdFinderSampleSize(parameters.thresholdFinderSampleSize), _candidatesPerInput(parameters.candidatesPerInput)
+        : ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>(booster, parameters), _lossFunction(lossFunction), _thresholdFinder(thresholdFinder), _thresholdFinderSampleSize(parameters.thresholdFinderSampleSize), _candidatesPerInput(parameters.candidatesPerInput)
     {
     }
 
@@ -25,9 +27,15 @@ namespace trainers
         SplitCandidate bestSplitCandidate(nodeId, range, sums);
 
         auto splitRuleCandidates = CallThresholdFinder(range);
+        const auto& candidateFeatures = this->GetCandidateFeatures();
 
         for (const auto& splitRuleCandidate : splitRuleCandidates)
         {
+            if (!std::binary_search(candidateFeatures.begin(), candidateFeatures.end(), splitRuleCandidate.GetElementIndex()))
+            {
+                continue;
+            }
+
             Sums sums0;
             size_t size0;
 
@@ -41,6 +49,7 @@ namespace trainers
             {
                 bestSplitCandidate.gain = gain;
                 bestSplitCandidate.splitRule = splitRuleCandidate;
+                bestSplitCandidate.ranges = NodeRanges(range); // discard the split of the previous best candidate
                 bestSplitCandidate.ranges.SplitChildRange(0, size0);
                 bestSplitCandidate.stats.SetChildSums({ sums0, sums1 });
             }
@@ -74,10 +83,31 @@ namespace trainers
     template <typename LossFunctionType, typename BoosterType, typename ThresholdFinderType>
     auto HistogramForestTrainer<LossFunctionType, BoosterType, ThresholdFinderType>::CallThresholdFinder(Range range) -> std::vector<SplitRuleType>
     {
-        // uniformly choose _candidatesPerInput from the range, without replacement
-        _dataset.RandomPermute(_random, range.firstIndex, range.size, _thresholdFinderSampleSize);
+        // uniformly choose _thresholdFinderSampleSize rows from the range, without replacement
+        auto sampleSize = _thresholdFinderSampleSize;
+        if (sampleSize > range.size || sampleSize == 0)
+        {
+            sampleSize = range.size;
+        }
+
+        for (size_t s = 0; s < sampleSize; ++s)
+        {
+            auto rowIndex = range.firstIndex + s;
+            std::uniform_int_distribution<size_t> dist(rowIndex, range.firstIndex + range.size - 1);
+            std::swap(_rowIndices[rowIndex], _rowIndices[dist(_random)]);
+        }
+
+        // the threshold finder sees the sampled examples with their weak weights and labels
+        data::Dataset<TrainerExampleType> sample;
+        for (size_t rowIndex = range.firstIndex; rowIndex < range.firstIndex + sampleSize; ++rowIndex)
+        {
+            auto exampleIndex = _rowIndices[rowIndex];
+            auto example = _dataset[exampleIndex];
+            example.GetMetadata() = _weakWeightsLabels[exampleIndex];
+            sample.AddExample(std::move(example));
+        }
 
-        auto thresholds = _thresholdFinder.GetThresholds(_dataset.GetExampleReferenceIterator(range.firstIndex, _thresholdFinderSampleSize));
+        auto thresholds = _thresholdFinder.GetThresholds(sample.GetExampleReferenceIterator());
         return thresholds;
     }
 
@@ -87,26 +117,25 @@ namespace trainers
         Sums sums0;
         size_t size0 = 0;
 
-        auto exampleIterator = _dataset.GetExampleIterator(range.firstIndex, range.size);
-        while (exampleIterator.IsValid())
+        for (size_t rowIndex = range.firstIndex; rowIndex < range.firstIndex + range.size; ++rowIndex)
         {
-            const auto& example = exampleIterator.Get();
-            auto prediction = splitRule.Predict(example.GetDataVector());
+            auto prediction = splitRule.Predict(this->GetDataVector(rowIndex));
             if (prediction == 0)
             {
-                sums0.Increment(example.GetMetadata().weak);
+                sums0.Increment(this->GetWeakWeightLabel(rowIndex));
                 ++size0;
             }
-            exampleIterator.Next();
         }
 
         return std::make_tuple(sums0, size0);
     };
 
     template <typename LossFunctionType, typename BoosterType, typename ThresholdFinderType>
-    std::unique_ptr<ITrainer<predictors::SimpleForestPredictor>> MakeHistogramForestTrainer(const LossFunctionType& lossFunction, const BoosterType& booster, const ThresholdFinderType& thresholdFinder, const HistogramForestTrainerParameters& parameters)
+    std::unique_ptr<ITrainer<predictors::SimpleForestPredictor>> MakeHistogramForestTrainer(const LossFunctionType& lossFunction, const BoosterType& booster, const ThresholdFinderType& thresholdFinder, const HistogramForestTrainerParameters& parameters, const predictors::SimpleForestPredictor& initialPredictor)
     {
-        return std::make_unique<HistogramForestTrainer<LossFunctionType, BoosterType, ThresholdFinderType>>(lossFunction, booster, thresholdFinder, parameters);
+        auto trainer = std::make_unique<HistogramForestTrainer<LossFunctionType, BoosterType, ThresholdFinderType>>(lossFunction, booster, thresholdFinder, parameters);
+        trainer->SetPredictor(initialPredictor);
+        return trainer;
     }
 }
 }
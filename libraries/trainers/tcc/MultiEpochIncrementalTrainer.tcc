@@ -23,23 +23,23 @@ namespace trainers
     template <typename PredictorType>
     void MultiEpochIncrementalTrainer<PredictorType>::Update(const data::AnyDataset& anyDataset)
     {
-        using ExampleType = data::Example<typename PredictorType::DataVectorType, data::WeightLabel>;
-        auto dataset = data::Dataset<ExampleType>(anyDataset);
+        // permute a vector of example indices, rather than copying and permuting the examples themselves
+        auto exampleIndices = anyDataset.GetExampleIndices();
 
         // calculate epoch size
         size_t epochSize = _parameters.epochSize;
-        if (epochSize == 0 || epochSize > dataset.NumExamples())
+        if (epochSize == 0 || epochSize > exampleIndices.size())
         {
-            epochSize = dataset.NumExamples();
+            epochSize = exampleIndices.size();
         }
 
         for (int epoch = 0; epoch < _parameters.numEpochs; ++epoch)
         {
             // randomly permute the data
-            dataset.RandomPermute(_random, epochSize);
+            data::RandomPermute(exampleIndices, _random, epochSize);
 
             // update the incremental trainer
-            _internalTrainer->Update(dataset.GetAnyDataset(0, epochSize));
+            _internalTrainer->Update(anyDataset.GetIndexedAnyDataset(exampleIndices, 0, epochSize));
         }
     }
 
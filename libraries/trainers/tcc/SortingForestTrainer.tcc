@@ -19,11 +19,9 @@ namespace trainers
     template <typename LossFunctionType, typename BoosterType>
     auto SortingForestTrainer<LossFunctionType, BoosterType>::GetBestSplitRuleAtNode(SplittableNodeId nodeId, Range range, Sums sums) -> SplitCandidate
     {
-        auto numFeatures = _dataset.NumFeatures();
-
         SplitCandidate bestSplitCandidate(nodeId, range, sums);
 
-        for (size_t inputIndex = 0; inputIndex < numFeatures; ++inputIndex)
+        for (auto inputIndex : this->GetCandidateFeatures())
         {
             // sort the relevant rows of data set in ascending order by inputIndex
             SortNodeDataset(range, inputIndex);
@@ -31,15 +29,15 @@ namespace trainers
             Sums sums0;
 
             // consider all thresholds
-            double nextFeatureValue = _dataset[range.firstIndex].GetDataVector()[inputIndex];
+            double nextFeatureValue = this->GetDataVector(range.firstIndex)[inputIndex];
             for (size_t rowIndex = range.firstIndex; rowIndex < range.firstIndex + range.size - 1; ++rowIndex)
             {
                 // get friendly names
                 double currentFeatureValue = nextFeatureValue;
-                nextFeatureValue = _dataset[rowIndex + 1].GetDataVector()[inputIndex];
+                nextFeatureValue = this->GetDataVector(rowIndex + 1)[inputIndex];
 
                 // increment sums
-                sums0.Increment(_dataset[rowIndex].GetMetadata().weak);
+                sums0.Increment(this->GetWeakWeightLabel(rowIndex));
 
                 // only split between rows with different feature values
                 if (currentFeatureValue == nextFeatureValue)
@@ -56,6 +54,7 @@ namespace trainers
                 {
                     bestSplitCandidate.gain = gain;
                     bestSplitCandidate.splitRule = SplitRuleType{ inputIndex, 0.5 * (currentFeatureValue + nextFeatureValue) };
+                    bestSplitCandidate.ranges = NodeRanges(range); // discard the split of the previous best candidate
                     bestSplitCandidate.ranges.SplitChildRange(0, rowIndex - range.firstIndex + 1);
                     bestSplitCandidate.stats.SetChildSums({ sums0, sums1 });
                 }
@@ -76,9 +75,8 @@ namespace trainers
     template <typename LossFunctionType, typename BoosterType>
     void SortingForestTrainer<LossFunctionType, BoosterType>::SortNodeDataset(Range range, size_t inputIndex)
     {
-        _dataset.Sort([inputIndex](const data::Example<DataVectorType, TrainerMetadata>& example) { return example.GetDataVector()[inputIndex]; },
-                      range.firstIndex,
-                      range.size);
+        auto begin = _rowIndices.begin() + range.firstIndex;
+        std::sort(begin, begin + range.size, [this, inputIndex](size_t a, size_t b) { return _dataset[a].GetDataVector()[inputIndex] < _dataset[b].GetDataVector()[inputIndex]; });
     }
 
     template <typename LossFunctionType, typename BoosterType>
@@ -95,9 +93,11 @@ namespace trainers
     }
 
     template <typename LossFunctionType, typename BoosterType>
-    std::unique_ptr<ITrainer<predictors::SimpleForestPredictor>> MakeSortingForestTrainer(const LossFunctionType& lossFunction, const BoosterType& booster, const SortingForestTrainerParameters& parameters)
+    std::unique_ptr<ITrainer<predictors::SimpleForestPredictor>> MakeSortingForestTrainer(const LossFunctionType& lossFunction, const BoosterType& booster, const SortingForestTrainerParameters& parameters, const predictors::SimpleForestPredictor& initialPredictor)
     {
-        return std::make_unique<SortingForestTrainer<LossFunctionType, BoosterType>>(lossFunction, booster, parameters);
+        auto trainer = std::make_unique<SortingForestTrainer<LossFunctionType, BoosterType>>(lossFunction, booster, parameters);
+        trainer->SetPredictor(initialPredictor);
+        return trainer;
     }
 }
 }
@@ -26,7 +26,7 @@ namespace trainers
         {
             const auto& example = exampleIterator.Get();
             const auto& denseDataVector = example.GetDataVector();
-            double weight = example.GetMetadata().weak.weight;
+            double weight = example.GetMetadata().weight;
 
             totalWeight += weight;
 
@@ -7,12 +7,306 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "ForestTrainer.h"
+#include "HistogramForestTrainer.h"
+#include "LogitBooster.h"
+#include "SortingForestTrainer.h"
+#include "ThresholdFinder.h"
+
+// data
+#include "Dataset.h"
+
+// lossFunctions
+#include "SquaredLoss.h"
+
+// testing
+#include "testing.h"
+
+// stl
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
 
 using namespace ell;
 
+namespace
+{
+using SortingTrainerType = trainers::SortingForestTrainer<lossFunctions::SquaredLoss, trainers::LogitBooster>;
+
+// Exposes the boosting state and the row sampling of the forest trainer
+class BoostingStateTrainer : public SortingTrainerType
+{
+public:
+    BoostingStateTrainer(const trainers::SortingForestTrainerParameters& parameters)
+        : SortingTrainerType(lossFunctions::SquaredLoss(), trainers::LogitBooster(), parameters)
+    {
+    }
+
+    // initializes the boosting state, as Update does before the first round
+    void InitializeBoostingState(const data::AnyDataset& anyDataset)
+    {
+        _dataset = data::Dataset<TrainerExampleType>(anyDataset);
+        InitializeMetadata();
+    }
+
+    using SortingTrainerType::SampleRows;
+
+    const std::vector<size_t>& GetRowIndices() const { return _rowIndices; }
+    const std::vector<data::WeightLabel>& GetWeakWeightsLabels() const { return _weakWeightsLabels; }
+    const std::vector<double>& GetCurrentOutputs() const { return _currentOutputs; }
+};
+
+// Checks that every split uses one of the features that were sampled for its node
+class FeatureSamplingTrainer : public SortingTrainerType
+{
+public:
+    FeatureSamplingTrainer(const trainers::SortingForestTrainerParameters& parameters)
+        : SortingTrainerType(lossFunctions::SquaredLoss(), trainers::LogitBooster(), parameters)
+    {
+    }
+
+    bool AllSplitsUseSampledFeatures() const { return _allSplitsUseSampledFeatures; }
+    const std::vector<size_t>& GetNumCandidateFeatures() const { return _numCandidateFeatures; }
+
+protected:
+    virtual SplitCandidate GetBestSplitRuleAtNode(SplittableNodeId nodeId, Range range, Sums sums) override
+    {
+        auto splitCandidate = SortingTrainerType::GetBestSplitRuleAtNode(nodeId, range, sums);
+        _numCandidateFeatures.push_back(_featureIndices.size());
+        if (splitCandidate.gain > 0 && !std::binary_search(_featureIndices.begin(), _featureIndices.end(), splitCandidate.splitRule.GetElementIndex()))
+        {
+            _allSplitsUseSampledFeatures = false;
+        }
+        return splitCandidate;
+    }
+
+private:
+    bool _allSplitsUseSampledFeatures = true;
+    std::vector<size_t> _numCandidateFeatures;
+};
+
+// Ten examples whose label is determined by whether the first feature is less than 5.5. The second feature cannot separate them.
+data::AutoSupervisedDataset GetStumpDataset()
+{
+    data::AutoSupervisedDataset dataset;
+    for (size_t i = 0; i < 10; ++i)
+    {
+        data::DoubleDataVector dataVector(std::vector<double>{ static_cast<double>(i + 1), static_cast<double>((7 * i) % 10 + 1) });
+        dataset.AddExample(data::AutoSupervisedExample(std::move(dataVector), data::WeightLabel{ 1, i < 5 ? -1.0 : 1.0 }));
+    }
+    return dataset;
+}
+
+// Random examples whose label depends on all of their features
+data::AutoSupervisedDataset GetRandomDataset(size_t numExamples, size_t numFeatures)
+{
+    std::default_random_engine engine;
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    data::AutoSupervisedDataset dataset;
+    for (size_t i = 0; i < numExamples; ++i)
+    {
+        std::vector<double> values(numFeatures);
+        std::generate(values.begin(), values.end(), [&]() { return distribution(engine); });
+        double sum = std::accumulate(values.begin(), values.end(), 0.0);
+        dataset.AddExample(data::AutoSupervisedExample(data::DoubleDataVector(std::move(values)), data::WeightLabel{ 1, sum > 0.5 * numFeatures ? 1.0 : -1.0 }));
+    }
+    return dataset;
+}
+
+std::vector<double> GetPredictions(const predictors::SimpleForestPredictor& forest, const data::AutoSupervisedDataset& dataset)
+{
+    std::vector<double> predictions;
+    for (size_t i = 0; i < dataset.NumExamples(); ++i)
+    {
+        predictions.push_back(forest.Predict(predictors::SimpleForestPredictor::DataVectorType(dataset[i].GetDataVector().ToArray())));
+    }
+    return predictions;
+}
+
+trainers::ForestTrainerParameters& SetRoundParameters(trainers::ForestTrainerParameters& parameters, size_t numRounds, size_t maxSplitsPerRound)
+{
+    parameters.minSplitGain = 0.0;
+    parameters.numRounds = numRounds;
+    parameters.maxSplitsPerRound = maxSplitsPerRound;
+    return parameters;
+}
+
+void SetSamplingParameters(trainers::ForestTrainerParameters& parameters, bool sampleFeaturesPerNode)
+{
+    parameters.randomSeed = "trainers_test";
+    parameters.rowSampleFraction = 0.3;
+    parameters.largeGradientFraction = 0.1;
+    parameters.featureSampleFraction = 0.25;
+    parameters.sampleFeaturesPerNode = sampleFeaturesPerNode;
+}
+}
+
+void ForestTrainerDefaultParametersTest()
+{
+    auto dataset = GetStumpDataset();
+    std::vector<double> expectedPredictions = { -1, -1, -1, -1, -1, 1, 1, 1, 1, 1 };
+
+    // without sampling, the random seed is never used
+    std::vector<std::vector<double>> sortingPredictions;
+    for (auto seed : { "a", "b" })
+    {
+        trainers::SortingForestTrainerParameters parameters;
+        SetRoundParameters(parameters, 1, 1);
+        parameters.randomSeed = seed;
+        auto trainer = trainers::MakeSortingForestTrainer(lossFunctions::SquaredLoss(), trainers::LogitBooster(), parameters);
+        trainer->Update(dataset.GetAnyDataset());
+
+        const auto& forest = trainer->GetPredictor();
+        const auto& splitRule = forest.GetInteriorNodes()[0].GetSplitRule();
+        testing::ProcessTest("Testing SortingForestTrainer default parameters split", forest.NumInteriorNodes() == 1 && splitRule.GetElementIndex() == 0 && testing::IsEqual(splitRule.GetThreshold(), 5.5));
+        sortingPredictions.push_back(GetPredictions(forest, dataset));
+    }
+    testing::ProcessTest("Testing SortingForestTrainer default parameters predictions", testing::IsEqual(sortingPredictions[0], expectedPredictions) && sortingPredictions[0] == sortingPredictions[1]);
+
+    trainers::HistogramForestTrainerParameters parameters;
+    SetRoundParameters(parameters, 1, 1);
+    parameters.thresholdFinderSampleSize = dataset.NumExamples();
+    parameters.candidatesPerInput = dataset.NumExamples();
+    auto trainer = trainers::MakeHistogramForestTrainer(lossFunctions::SquaredLoss(), trainers::LogitBooster(), trainers::ExhaustiveThresholdFinder(), parameters);
+    trainer->Update(dataset.GetAnyDataset());
+    testing::ProcessTest("Testing HistogramForestTrainer default parameters predictions", trainer->GetPredictor().NumInteriorNodes() == 1 && testing::IsEqual(GetPredictions(trainer->GetPredictor(), dataset), expectedPredictions));
+}
+
+void ForestTrainerRandomSeedTest()
+{
+    auto dataset = GetRandomDataset(200, 8);
+
+    std::vector<std::vector<double>> predictions;
+    std::vector<size_t> numInteriorNodes;
+    for (size_t repetition = 0; repetition < 2; ++repetition)
+    {
+        trainers::SortingForestTrainerParameters parameters;
+        SetRoundParameters(parameters, 5, 4);
+        SetSamplingParameters(parameters, true);
+        auto trainer = trainers::MakeSortingForestTrainer(lossFunctions::SquaredLoss(), trainers::LogitBooster(), parameters);
+        trainer->Update(dataset.GetAnyDataset());
+        predictions.push_back(GetPredictions(trainer->GetPredictor(), dataset));
+        numInteriorNodes.push_back(trainer->GetPredictor().NumInteriorNodes());
+    }
+    testing::ProcessTest("Testing ForestTrainer with a fixed random seed is deterministic", numInteriorNodes[0] > 0 && numInteriorNodes[0] == numInteriorNodes[1] && predictions[0] == predictions[1]);
+}
+
+void ForestTrainerRowSamplingTest()
+{
+    const size_t numExamples = 100;
+    const size_t numLargeGradientRows = 10;
+    const size_t numOtherRows = 30;
+
+    // distinct weights give every example a different gradient, the largest belong to the last examples
+    data::AutoSupervisedDataset dataset;
+    for (size_t i = 0; i < numExamples; ++i)
+    {
+        dataset.AddExample(data::AutoSupervisedExample(data::DoubleDataVector(std::vector<double>{ static_cast<double>(i + 1) }), data::WeightLabel{ 1.0 + i, i % 2 == 0 ? 1.0 : -1.0 }));
+    }
+
+    trainers::SortingForestTrainerParameters parameters;
+    SetSamplingParameters(parameters, false);
+    BoostingStateTrainer trainer(parameters);
+    trainer.InitializeBoostingState(dataset.GetAnyDataset());
+    auto numSampledRows = trainer.SampleRows();
+    testing::ProcessTest("Testing ForestTrainer row sample size", numSampledRows == numLargeGradientRows + numOtherRows);
+
+    // before any tree is grown, every weak weight is half the strong weight
+    const auto& rowIndices = trainer.GetRowIndices();
+    const auto& weakWeightsLabels = trainer.GetWeakWeightsLabels();
+    bool ok = true;
+    double scale = static_cast<double>(numExamples - numLargeGradientRows) / numOtherRows;
+    for (size_t rowIndex = 0; rowIndex < numExamples; ++rowIndex)
+    {
+        auto exampleIndex = rowIndices[rowIndex];
+        double weight = 0.5 * (1.0 + exampleIndex);
+        if (rowIndex < numLargeGradientRows)
+        {
+            ok = ok && exampleIndex >= numExamples - numLargeGradientRows && testing::IsEqual(weakWeightsLabels[exampleIndex].weight, weight);
+        }
+        else if (rowIndex < numSampledRows)
+        {
+            ok = ok && exampleIndex < numExamples - numLargeGradientRows && testing::IsEqual(weakWeightsLabels[exampleIndex].weight, scale * weight);
+        }
+        else
+        {
+            ok = ok && testing::IsEqual(weakWeightsLabels[exampleIndex].weight, weight);
+        }
+    }
+    testing::ProcessTest("Testing ForestTrainer row sample keeps large gradients and rescales the other rows", ok);
+}
+
+void ForestTrainerFeatureSamplingTest()
+{
+    auto dataset = GetRandomDataset(200, 8);
+
+    for (bool sampleFeaturesPerNode : { false, true })
+    {
+        trainers::SortingForestTrainerParameters parameters;
+        SetRoundParameters(parameters, 3, 5);
+        SetSamplingParameters(parameters, sampleFeaturesPerNode);
+        parameters.rowSampleFraction = 1.0;
+        parameters.largeGradientFraction = 0.0;
+        FeatureSamplingTrainer trainer(parameters);
+        trainer.Update(dataset.GetAnyDataset());
+
+        const auto& numCandidateFeatures = trainer.GetNumCandidateFeatures();
+        bool sampleSizesOk = !numCandidateFeatures.empty() && std::all_of(numCandidateFeatures.begin(), numCandidateFeatures.end(), [](size_t size) { return size == 2; });
+        testing::ProcessTest(std::string("Testing ForestTrainer feature sampling") + (sampleFeaturesPerNode ? " per node" : " per tree"), sampleSizesOk && trainer.AllSplitsUseSampledFeatures() && trainer.GetPredictor().NumInteriorNodes() > 0);
+    }
+}
+
+void ForestTrainerWarmStartTest()
+{
+    auto dataset = GetRandomDataset(200, 4);
+    const size_t numRounds = 3;
+    const size_t numWarmStartRounds = 2;
+
+    auto trainForest = [&dataset](size_t rounds, const predictors::SimpleForestPredictor& initialPredictor) {
+        trainers::SortingForestTrainerParameters parameters;
+        SetRoundParameters(parameters, rounds, 3);
+        auto trainer = trainers::MakeSortingForestTrainer(lossFunctions::SquaredLoss(), trainers::LogitBooster(), parameters, initialPredictor);
+        trainer->Update(dataset.GetAnyDataset());
+        return trainer->GetPredictor();
+    };
+
+    // continuing from the forest of the first rounds grows the same trees as training all rounds at once
+    auto forest = trainForest(numRounds, predictors::SimpleForestPredictor());
+    auto warmStartForest = trainForest(numWarmStartRounds, forest);
+    auto fullForest = trainForest(numRounds + numWarmStartRounds, predictors::SimpleForestPredictor());
+    testing::ProcessTest("Testing ForestTrainer warm start", warmStartForest.NumTrees() == numRounds + numWarmStartRounds && warmStartForest.NumInteriorNodes() == fullForest.NumInteriorNodes() && testing::IsEqual(GetPredictions(warmStartForest, dataset), GetPredictions(fullForest, dataset), 1.0e-10));
+
+    // the boosting state starts from the outputs of the forest that was set
+    trainers::SortingForestTrainerParameters parameters;
+    BoostingStateTrainer trainer(parameters);
+    trainer.SetPredictor(forest);
+    trainer.InitializeBoostingState(dataset.GetAnyDataset());
+    auto predictions = GetPredictions(forest, dataset);
+    trainers::LogitBooster booster;
+    bool ok = testing::IsEqual(trainer.GetCurrentOutputs(), predictions, 1.0e-12);
+    for (size_t i = 0; i < dataset.NumExamples(); ++i)
+    {
+        auto weakWeightLabel = booster.GetWeakWeightLabel(dataset[i].GetMetadata(), predictions[i]);
+        ok = ok && testing::IsEqual(trainer.GetWeakWeightsLabels()[i].weight, weakWeightLabel.weight, 1.0e-12) && trainer.GetWeakWeightsLabels()[i].label == weakWeightLabel.label;
+    }
+    testing::ProcessTest("Testing ForestTrainer boosting state after SetPredictor", forest.NumTrees() == numRounds && ok);
+}
+
 /// Runs all tests
 ///
 int main()
 {
+    ForestTrainerDefaultParametersTest();
+    ForestTrainerRandomSeedTest();
+    ForestTrainerRowSamplingTest();
+    ForestTrainerFeatureSamplingTest();
+    ForestTrainerWarmStartTest();
+
+    if (testing::DidTestFail())
+    {
+        return 1;
+    }
+
     return 0;
 }
@@ -0,0 +1,150 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BufferedTokenizer.h (utilities)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <istream>
+#include <string>
+
+namespace ell
+{
+namespace utilities
+{
+    /// <summary> A non-owning reference to a token in a BufferedTokenizer's buffer </summary>
+    class TokenView
+    {
+    public:
+        TokenView() = default;
+
+        /// <summary> Constructor </summary>
+        ///
+        /// <param name="begin"> Pointer to the first character of the token </param>
+        /// <param name="size"> The number of characters in the token </param>
+        TokenView(const char* begin, size_t size)
+            : _begin(begin), _size(size) {}
+
+        /// <summary> Gets a pointer to the first character of the token. The token isn't null-terminated. </summary>
+        ///
+        /// <returns> Pointer to the first character </returns>
+        const char* Begin() const { return _begin; }
+
+        /// <summary> Gets a pointer one past the last character of the token. </summary>
+        ///
+        /// <returns> Pointer one past the last character </returns>
+        const char* End() const { return _begin + _size; }
+
+        /// <summary> Gets the number of characters in the token. </summary>
+        ///
+        /// <returns> The size of the token </returns>
+        size_t Size() const { return _size; }
+
+        /// <summary> Checks if the token is empty, which indicates the end of the input. </summary>
+        ///
+        /// <returns> true if the token is empty </returns>
+        bool IsEmpty() const { return _size == 0; }
+
+        /// <summary> Copies the token into a string. </summary>
+        ///
+        /// <returns> The token as a string </returns>
+        std::string ToString() const { return std::string(_begin, _size); }
+
+        /// <summary> Equality operator with a null-terminated string. </summary>
+        bool operator==(const char* str) const { return std::strlen(str) == _size && std::memcmp(_begin, str, _size) == 0; }
+
+        /// <summary> Equality operator with a string. </summary>
+        bool operator==(const std::string& str) const { return str.size() == _size && std::memcmp(_begin, str.data(), _size) == 0; }
+
+        /// <summary> Inequality operator with a null-terminated string. </summary>
+        bool operator!=(const char* str) const { return !(*this == str); }
+
+        /// <summary> Inequality operator with a string. </summary>
+        bool operator!=(const std::string& str) const { return !(*this == str); }
+
+    private:
+        const char* _begin = "";
+        size_t _size = 0;
+    };
+
+    /// <summary>
+    /// A tokenizer with the same rules as Tokenizer that reads its entire input into a single buffer up front
+    /// and returns tokens as views into that buffer. Reading, peeking and matching tokens doesn't allocate
+    /// memory, and numeric tokens can be parsed in place with utilities::Parse, since the buffer is null-terminated.
+    /// </summary>
+    class BufferedTokenizer
+    {
+    public:
+        /// <summary> Constructor. Reads the remainder of the stream into the buffer. </summary>
+        ///
+        /// <param name=inputStream> Stream to read from </param>
+        /// <param name=tokenStartChars> Set of characters that indicate the beginning of a new token. </param>
+        BufferedTokenizer(std::istream& inputStream, const std::string& tokenStartChars);
+
+        /// <summary> Constructor </summary>
+        ///
+        /// <param name=buffer> The text to tokenize </param>
+        /// <param name=tokenStartChars> Set of characters that indicate the beginning of a new token. </param>
+        BufferedTokenizer(std::string buffer, const std::string& tokenStartChars);
+
+        BufferedTokenizer(const BufferedTokenizer&) = delete;
+
+        BufferedTokenizer& operator=(const BufferedTokenizer&) = delete;
+
+        /// <summary> Gets the next token from the buffer. The token remains valid for the lifetime of the tokenizer. </summary>
+        ///
+        /// <returns> The next token, or an empty token if the end of the buffer is reached. </returns>
+        TokenView ReadNextToken();
+
+        /// <summary> Gets the next token from the buffer without consuming it. </summary>
+        ///
+        /// <returns> The next token, or an empty token if the end of the buffer is reached. </returns>
+        TokenView PeekNextToken();
+
+        /// <summary> Consumes the next token if it matches the given token. </summary>
+        ///
+        /// <param name="token"> The token to match. </param>
+        /// <returns> true if the next token matched and was consumed. </returns>
+        bool TryMatchToken(const char* token);
+
+        /// <summary> Matches the next token from the buffer. Throws an exception if token doesn't match. </summary>
+        ///
+        /// <param name="token"> The token to match. </param>
+        void MatchToken(const char* token);
+
+        /// <summary> Matches the next tokens from the buffer. Throws an exception if a token doesn't match. </summary>
+        ///
+        /// <param name="tokens"> The tokens to match. </param>
+        void MatchTokens(std::initializer_list<const char*> tokens);
+
+    private:
+        struct State
+        {
+            size_t position = 0;
+            char currentStringDelimiter = '\0'; // '\0' if we're not currently parsing a string
+        };
+
+        TokenView ScanToken(State& state) const;
+        bool IsTokenStartChar(char ch) const { return _tokenStartChars.find(ch) != std::string::npos; }
+        bool IsStringDelimiter(char ch) const { return _stringDelimiters.find(ch) != std::string::npos; }
+
+        std::string _buffer;
+        std::string _tokenStartChars;
+        std::string _stringDelimiters = "'\"";
+
+        State _state;
+
+        // the most recently peeked token, and the state just after it
+        bool _hasPeekedToken = false;
+        TokenView _peekedToken;
+        State _peekedState;
+    };
+}
+}
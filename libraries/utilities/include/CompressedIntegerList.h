@@ -98,6 +98,15 @@ namespace utilities
         /// <returns> The iterator. </returns>
         Iterator GetIterator() const { return Iterator(_data.data(), _data.data() + _data.size()); }
 
+        /// <summary> Decodes the list in batches of consecutive entries, which is faster than advancing an
+        /// Iterator one entry at a time. The function is called once per batch, with a pointer to the decoded
+        /// integers, the position of the first of them in the list, and the number of integers in the batch. </summary>
+        ///
+        /// <typeparam name="FunctionType"> Type of the function, void(const size_t*, size_t, size_t). </typeparam>
+        /// <param name="function"> The function. </param>
+        template <typename FunctionType>
+        void DecodeBatches(FunctionType function) const;
+
     private:
         std::vector<uint8_t> _data;
         size_t _last;
@@ -105,3 +114,5 @@ namespace utilities
     };
 }
 }
+
+#include "../tcc/CompressedIntegerList.tcc"
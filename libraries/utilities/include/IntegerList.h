@@ -92,9 +92,20 @@ namespace utilities
         /// <returns> The iterator. </returns>
         Iterator GetIterator() const;
 
+        /// <summary> Calls a function on the entire list as a single batch, with a pointer to the integers, the
+        /// position of the first of them in the list (always zero), and the number of integers. This matches
+        /// the interface of CompressedIntegerList::DecodeBatches. </summary>
+        ///
+        /// <typeparam name="FunctionType"> Type of the function, void(const size_t*, size_t, size_t). </typeparam>
+        /// <param name="function"> The function. </param>
+        template <typename FunctionType>
+        void DecodeBatches(FunctionType function) const;
+
     private:
         // The list
         std::vector<size_t> _list;
     };
 }
 }
+
+#include "../tcc/IntegerList.tcc"
@@ -9,8 +9,9 @@
 #pragma once
 
 #include "Archiver.h"
+#include "BufferedTokenizer.h"
 #include "Exception.h"
-#include "Tokenizer.h"
+#include "Parser.h"
 #include "TypeFactory.h"
 #include "TypeName.h"
 
@@ -90,16 +91,17 @@ namespace utilities
         void SetEndOfLine(std::string endOfLine);
     };
 
-    /// <summary> An unarchiver that reads data encoded in JSON-formatted text. </summary>
+    /// <summary> An unarchiver that reads data encoded in JSON-formatted text. The unarchiver reads the remainder
+    /// of its input stream into memory when it is constructed, and parses tokens and numbers in place. </summary>
     class JsonUnarchiver : public Unarchiver
     {
     public:
-        /// <summary> Default Constructor --- reads from standard input. </summary>
+        /// <summary> Default Constructor --- reads from standard input, up to the end of the stream. </summary>
         JsonUnarchiver(SerializationContext context);
 
         /// <summary> Constructor </summary>
         ///
-        /// <param name="inputStream"> The stream to read data from. </summary>
+        /// <param name="inputStream"> The stream to read data from, up to the end of the stream. </summary>
         JsonUnarchiver(std::istream& inputStream, SerializationContext context);
 
     protected:
@@ -140,10 +142,15 @@ namespace utilities
 
         void ReadArray(const char* name, std::vector<std::string>& array);
 
+        template <typename ValueType>
+        static void ParseToken(const TokenView& token, ValueType& value);
+
+        static void ParseToken(const TokenView& token, char& value);
+
         void MatchFieldName(const char* name);
 
         std::string _endOfPreviousLine;
-        Tokenizer _tokenizer;
+        BufferedTokenizer _tokenizer;
     };
 
     // Json utility functions
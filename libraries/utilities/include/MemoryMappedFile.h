@@ -0,0 +1,54 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     MemoryMappedFile.h (utilities)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <cstddef>
+#include <string>
+
+namespace ell
+{
+namespace utilities
+{
+    /// <summary> Maps the contents of a file into memory. The mapping is private (copy-on-write): the
+    /// contents can be modified in memory, but modifications are never written back to the file. </summary>
+    class MemoryMappedFile
+    {
+    public:
+        /// <summary> Maps a file into memory. </summary>
+        ///
+        /// <param name="filepath"> The file path. </param>
+        MemoryMappedFile(const std::string& filepath);
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        ~MemoryMappedFile();
+
+        /// <summary> Gets a pointer to the beginning of the mapped memory. </summary>
+        ///
+        /// <returns> Pointer to the mapped memory, or nullptr if the file is empty. </returns>
+        char* GetData() const { return _data; }
+
+        /// <summary> Gets the size of the mapped file, in bytes. </summary>
+        ///
+        /// <returns> The size in bytes. </returns>
+        size_t Size() const { return _size; }
+
+    private:
+        char* _data = nullptr;
+        size_t _size = 0;
+#ifdef _WIN32
+        void* _fileHandle = nullptr;
+        void* _mappingHandle = nullptr;
+#endif
+    };
+}
+}
@@ -0,0 +1,169 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BufferedTokenizer.cpp (utilities)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BufferedTokenizer.h"
+#include "Exception.h"
+
+// stl
+#include <cctype>
+#include <iterator>
+#include <utility>
+
+namespace ell
+{
+namespace utilities
+{
+    namespace
+    {
+        std::string ReadStream(std::istream& inputStream)
+        {
+            std::string buffer;
+
+            // if the stream is seekable, read it in one go
+            auto begin = inputStream.tellg();
+            if (begin != std::streampos(-1) && inputStream.seekg(0, std::ios::end))
+            {
+                auto end = inputStream.tellg();
+                inputStream.seekg(begin);
+                if (end != std::streampos(-1) && end >= begin)
+                {
+                    buffer.resize(static_cast<size_t>(end - begin));
+                    inputStream.read(&buffer[0], static_cast<std::streamsize>(buffer.size()));
+                    buffer.resize(static_cast<size_t>(inputStream.gcount()));
+                    return buffer;
+                }
+            }
+
+            inputStream.clear();
+            buffer.assign(std::istreambuf_iterator<char>(inputStream), std::istreambuf_iterator<char>());
+            return buffer;
+        }
+    }
+
+    BufferedTokenizer::BufferedTokenizer(std::istream& inputStream, const std::string& tokenStartChars)
+        : BufferedTokenizer(ReadStream(inputStream), tokenStartChars)
+    {
+    }
+
+    BufferedTokenizer::BufferedTokenizer(std::string buffer, const std::string& tokenStartChars)
+        : _buffer(std::move(buffer)), _tokenStartChars(tokenStartChars)
+    {
+    }
+
+    TokenView BufferedTokenizer::ReadNextToken()
+    {
+        if (_hasPeekedToken)
+        {
+            _hasPeekedToken = false;
+            _state = _peekedState;
+            return _peekedToken;
+        }
+
+        return ScanToken(_state);
+    }
+
+    TokenView BufferedTokenizer::PeekNextToken()
+    {
+        if (!_hasPeekedToken)
+        {
+            _peekedState = _state;
+            _peekedToken = ScanToken(_peekedState);
+            _hasPeekedToken = true;
+        }
+        return _peekedToken;
+    }
+
+    bool BufferedTokenizer::TryMatchToken(const char* token)
+    {
+        if (PeekNextToken() == token)
+        {
+            ReadNextToken();
+            return true;
+        }
+        return false;
+    }
+
+    void BufferedTokenizer::MatchToken(const char* token)
+    {
+        auto nextToken = ReadNextToken();
+        if (nextToken != token)
+        {
+            throw InputException(InputExceptionErrors::badStringFormat, std::string{ "Failed to match token " } + token + ", got: " + nextToken.ToString());
+        }
+    }
+
+    void BufferedTokenizer::MatchTokens(std::initializer_list<const char*> tokens)
+    {
+        for (auto token : tokens)
+        {
+            MatchToken(token);
+        }
+    }
+
+    // Follows the same rules as Tokenizer::ReadNextToken. Since a token never skips characters once it has
+    // started, it is always a contiguous range of the buffer.
+    TokenView BufferedTokenizer::ScanToken(State& state) const
+    {
+        const char escapeChar = '\\';
+        const char* data = _buffer.data();
+        const size_t size = _buffer.size();
+        size_t& position = state.position;
+
+        // eat whitespace and add first char
+        while (position < size && std::isspace(static_cast<unsigned char>(data[position])))
+        {
+            ++position;
+        }
+        if (position == size)
+        {
+            return TokenView();
+        }
+
+        const size_t begin = position;
+        char ch = data[position++];
+        bool isStringDelimiter = IsStringDelimiter(ch);
+        if (state.currentStringDelimiter == '\0') // didn't just finish parsing a string, so set the delimiter if we got one
+        {
+            state.currentStringDelimiter = isStringDelimiter ? ch : '\0';
+        }
+        else if (isStringDelimiter) // just finished parsing a string
+        {
+            state.currentStringDelimiter = '\0';
+        }
+
+        if (IsTokenStartChar(ch)) // we hit a token-stop char. Return it.
+        {
+            return TokenView(data + begin, 1);
+        }
+
+        // If we're in read-string mode, read until we get an unescaped string delimiter that matches the current string delimiter
+        bool prevEscaped = false;
+        while (position < size)
+        {
+            ch = data[position];
+            if (state.currentStringDelimiter != '\0') // we're in read-string mode
+            {
+                // only break if we're done reading a string
+                if (!prevEscaped && ch == state.currentStringDelimiter)
+                {
+                    break;
+                }
+            }
+            else if (std::isspace(static_cast<unsigned char>(ch)) || IsTokenStartChar(ch)) // not in read-string mode, break on token or space
+            {
+                break;
+            }
+
+            ++position;
+            prevEscaped = !prevEscaped && ch == escapeChar;
+        }
+
+        return TokenView(data + begin, position - begin);
+    }
+}
+}
@@ -178,7 +178,7 @@ namespace utilities
         _tokenizer.MatchToken("{");
         MatchFieldName("_type");
         _tokenizer.MatchToken("\"");
-        auto encodedTypeName = _tokenizer.ReadNextToken();
+        auto encodedTypeName = _tokenizer.ReadNextToken().ToString();
         assert(encodedTypeName != "");
         _tokenizer.MatchToken("\"");
 
@@ -272,7 +272,7 @@ namespace utilities
         auto s = _tokenizer.ReadNextToken();
         if (s != key)
         {
-            throw InputException(InputExceptionErrors::badStringFormat, std::string{ "Failed to match name " } + key + ", got: " + s);
+            throw InputException(InputExceptionErrors::badStringFormat, std::string{ "Failed to match name " } + key + ", got: " + s.ToString());
         }
         _tokenizer.MatchTokens({ "\"", ":" });
     }
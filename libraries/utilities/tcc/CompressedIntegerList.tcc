@@ -0,0 +1,53 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CompressedIntegerList.tcc (utilities)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// stl
+#include <cstdint>
+#include <cstring>
+
+#define COMPRESSED_INTEGER_LIST_BATCH_SIZE 64
+
+namespace ell
+{
+namespace utilities
+{
+    template <typename FunctionType>
+    void CompressedIntegerList::DecodeBatches(FunctionType function) const
+    {
+        size_t batch[COMPRESSED_INTEGER_LIST_BATCH_SIZE];
+        const uint8_t* iter = _data.data();
+        const uint8_t* end = iter + _data.size();
+        size_t value = 0;
+        size_t position = 0;
+
+        while (iter < end)
+        {
+            // decode the same delta encoding as Iterator::Next, without the per-entry iterator bookkeeping
+            size_t count = 0;
+            while (count < COMPRESSED_INTEGER_LIST_BATCH_SIZE && iter < end)
+            {
+                uint8_t first_val = *iter;
+                int total_bytes = 1 << ((first_val >> 6) & 0x03);
+                size_t delta = first_val;
+                if (total_bytes > 1)
+                {
+                    delta = 0;
+                    std::memcpy(&delta, iter + 1, total_bytes - 1);
+                    delta = (delta << 6) | (first_val & 0x3f);
+                }
+                iter += total_bytes;
+                value += delta;
+                batch[count++] = value;
+            }
+
+            function(static_cast<const size_t*>(batch), position, count);
+            position += count;
+        }
+    }
+}
+}
@@ -0,0 +1,22 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     IntegerList.tcc (utilities)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ell
+{
+namespace utilities
+{
+    template <typename FunctionType>
+    void IntegerList::DecodeBatches(FunctionType function) const
+    {
+        if (!_list.empty())
+        {
+            function(_list.data(), size_t{ 0 }, _list.size());
+        }
+    }
+}
+}
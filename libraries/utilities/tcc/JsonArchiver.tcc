@@ -118,6 +118,27 @@ namespace utilities
     //
     // Deserialization
     //
+    template <typename ValueType>
+    void JsonUnarchiver::ParseToken(const TokenView& token, ValueType& value)
+    {
+        // the tokenizer's buffer is null-terminated, so the number can be parsed in place
+        char* pEnd = nullptr;
+        cParse(token.Begin(), pEnd, value);
+        if (token.IsEmpty() || pEnd != token.End())
+        {
+            throw InputException(InputExceptionErrors::badStringFormat, "Failed to parse number, got: " + token.ToString());
+        }
+    }
+
+    inline void JsonUnarchiver::ParseToken(const TokenView& token, char& value)
+    {
+        if (token.IsEmpty())
+        {
+            throw InputException(InputExceptionErrors::badStringFormat, "Failed to parse char, got end of input");
+        }
+        value = *token.Begin();
+    }
+
     template <typename ValueType, IsFundamental<ValueType> concept>
     void JsonUnarchiver::ReadScalar(const char* name, ValueType& value)
     {
@@ -127,10 +148,8 @@ namespace utilities
             MatchFieldName(name);
         }
 
-        // read string
         auto valueToken = _tokenizer.ReadNextToken();
-        std::stringstream valueStream(valueToken);
-        valueStream >> value;
+        ParseToken(valueToken, value);
 
         // eat a comma if it exists
         if (hasName)
@@ -176,7 +195,7 @@ namespace utilities
 
         _tokenizer.MatchToken("\"");
         auto valueToken = _tokenizer.ReadNextToken();
-        value = JsonUtilities::DecodeString(valueToken);
+        value = JsonUtilities::DecodeString(valueToken.ToString());
         _tokenizer.MatchToken("\"");
 
         // eat a comma if it exists
@@ -303,6 +303,49 @@ void TestUnarchiver()
         // std::cout << strstream2.str() << std::endl;
     }
 
+    {
+        // large numeric arrays, with values that exercise sign, exponent and integer parsing
+        std::vector<double> doubleVector;
+        std::vector<float> floatVector;
+        std::vector<size_t> sizeVector;
+        std::vector<short> shortVector;
+        for (int index = 0; index < 1000; ++index)
+        {
+            doubleVector.push_back((index % 2 == 0 ? -0.125 : 2.5e-7) * index);
+            floatVector.push_back(index * -0.5f);
+            sizeVector.push_back(static_cast<size_t>(index) * 1000000007);
+            shortVector.push_back(static_cast<short>(-index));
+        }
+
+        std::stringstream strstream;
+        {
+            ArchiverType archiver(strstream);
+            archiver.Archive("doubles", doubleVector);
+            archiver.Archive("floats", floatVector);
+            archiver.Archive("sizes", sizeVector);
+            archiver.Archive("shorts", shortVector);
+            archiver.Archive("empty", std::vector<int>{});
+        }
+
+        UnarchiverType unarchiver(strstream, context);
+        std::vector<double> newDoubleVector;
+        std::vector<float> newFloatVector;
+        std::vector<size_t> newSizeVector;
+        std::vector<short> newShortVector;
+        std::vector<int> newEmptyVector;
+        unarchiver.Unarchive("doubles", newDoubleVector);
+        unarchiver.Unarchive("floats", newFloatVector);
+        unarchiver.Unarchive("sizes", newSizeVector);
+        unarchiver.Unarchive("shorts", newShortVector);
+        unarchiver.Unarchive("empty", newEmptyVector);
+
+        testing::ProcessTest("Deserialize large double array check", testing::IsEqual(doubleVector, newDoubleVector, 1.0e-6));
+        testing::ProcessTest("Deserialize large float array check", floatVector == newFloatVector);
+        testing::ProcessTest("Deserialize large size_t array check", sizeVector == newSizeVector);
+        testing::ProcessTest("Deserialize large short array check", shortVector == newShortVector);
+        testing::ProcessTest("Deserialize empty array check", newEmptyVector.empty());
+    }
+
     {
         auto stringVal = std::string{ "Hi there! Here's a tab character: \t, as well as some 'quoted' text." };
         std::stringstream strstream;
@@ -0,0 +1,51 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BenchmarkArguments.h (benchmarks)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// utilities
+#include "CommandLineParser.h"
+#include "OutputStreamImpostor.h"
+
+// stl
+#include <string>
+
+namespace ell
+{
+/// <summary> Command line arguments for the benchmarks executable. </summary>
+struct BenchmarkArguments
+{
+    /// <summary> Only run the benchmarks whose names contain this string. </summary>
+    std::string filter;
+
+    /// <summary> The minimum time, in seconds, of each timed batch of iterations. </summary>
+    double minTime = 0.5;
+
+    /// <summary> Path to the JSON output file. </summary>
+    std::string outputFilename;
+
+    /// <summary> An output stream for the JSON results. </summary>
+    utilities::OutputStreamImpostor outputStream;
+};
+
+/// <summary> Parsed command line arguments for the benchmarks executable. </summary>
+struct ParsedBenchmarkArguments : public BenchmarkArguments, public utilities::ParsedArgSet
+{
+    /// <summary> Adds the arguments to the command line parser. </summary>
+    ///
+    /// <param name="parser"> [in,out] The parser. </param>
+    virtual void AddArgs(utilities::CommandLineParser& parser) override;
+
+    /// <summary> Check the parsed arguments. </summary>
+    ///
+    /// <param name="parser"> The parser. </param>
+    ///
+    /// <returns> An utilities::CommandLineParseResult. </returns>
+    virtual utilities::CommandLineParseResult PostProcess(const utilities::CommandLineParser& parser) override;
+};
+}
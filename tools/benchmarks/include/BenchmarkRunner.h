@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BenchmarkRunner.h (benchmarks)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ell
+{
+/// <summary> The measurements of one benchmark. </summary>
+struct BenchmarkResult
+{
+    /// <summary> The benchmark name, of the form group/case. </summary>
+    std::string name;
+
+    /// <summary> The number of iterations that were timed. </summary>
+    size_t iterations = 0;
+
+    /// <summary> Wall-clock time per iteration, in nanoseconds. </summary>
+    double realTime = 0;
+
+    /// <summary> Processor time per iteration, in nanoseconds. </summary>
+    double cpuTime = 0;
+
+    /// <summary> The number of items (examples, samples, lines) processed per second of wall-clock time. </summary>
+    double itemsPerSecond = 0;
+};
+
+/// <summary> Runs benchmarks and reports their results. Each benchmark runs its iteration function in batches
+/// of increasing size until a batch takes at least the minimum time, and reports the timings of that batch. </summary>
+class BenchmarkRunner
+{
+public:
+    /// <summary> Constructor. </summary>
+    ///
+    /// <param name="filter"> Only benchmarks whose names contain this string are run (all benchmarks if empty). </param>
+    /// <param name="minTime"> The minimum time, in seconds, of the batch of iterations that is reported. </param>
+    BenchmarkRunner(const std::string& filter, double minTime);
+
+    /// <summary> Checks whether a benchmark is selected by the filter. Use this to skip expensive setup code. </summary>
+    ///
+    /// <param name="name"> The full benchmark name. </param>
+    ///
+    /// <returns> true if the benchmark will run. </returns>
+    bool IsSelected(const std::string& name) const;
+
+    /// <summary> Checks whether any of several benchmarks is selected by the filter. Use this to skip setup code
+    /// shared by those benchmarks. </summary>
+    ///
+    /// <param name="names"> The full benchmark names. </param>
+    ///
+    /// <returns> true if at least one of the benchmarks will run. </returns>
+    bool IsAnySelected(const std::vector<std::string>& names) const;
+
+    /// <summary> Runs a benchmark, if it is selected by the filter. </summary>
+    ///
+    /// <param name="name"> The benchmark name, of the form group/case. </param>
+    /// <param name="itemsPerIteration"> The number of items processed by one call to the iteration function. </param>
+    /// <param name="iteration"> The function to time. </param>
+    void Run(const std::string& name, size_t itemsPerIteration, const std::function<void()>& iteration);
+
+    /// <summary> Gets the results of the benchmarks that ran so far. </summary>
+    ///
+    /// <returns> The results. </returns>
+    const std::vector<BenchmarkResult>& GetResults() const { return _results; }
+
+    /// <summary> Writes the results as JSON, in the same layout as the output of Google Benchmark's --benchmark_format=json,
+    /// so that existing tools for comparing benchmark runs can read it. </summary>
+    ///
+    /// <param name="os"> The stream to write to. </param>
+    void WriteJson(std::ostream& os) const;
+
+    /// <summary> Prints a human-readable table of the results. </summary>
+    ///
+    /// <param name="os"> The stream to write to. </param>
+    void Print(std::ostream& os) const;
+
+private:
+    std::string _filter;
+    double _minTime;
+    std::vector<BenchmarkResult> _results;
+};
+}
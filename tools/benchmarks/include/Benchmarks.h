@@ -0,0 +1,38 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     Benchmarks.h (benchmarks)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "BenchmarkRunner.h"
+
+namespace ell
+{
+/// <summary> Runs the map benchmarks: the per-sample latency of linear, forest and DTW maps, both
+/// interpreted (DynamicMap) and compiled (IRCompiledMap). Names start with "map/". </summary>
+///
+/// <param name="runner"> The benchmark runner. </param>
+void RunMapBenchmarks(BenchmarkRunner& runner);
+
+/// <summary> Runs the trainer benchmarks: the throughput of the SGD, SDSGD, sorting forest and histogram
+/// forest trainers on synthetic datasets. Names start with "trainer/". </summary>
+///
+/// <param name="runner"> The benchmark runner. </param>
+void RunTrainerBenchmarks(BenchmarkRunner& runner);
+
+/// <summary> Runs the data loading benchmarks: the throughput of the sequential and parallel text parsers.
+/// Names start with "data/". </summary>
+///
+/// <param name="runner"> The benchmark runner. </param>
+void RunDataBenchmarks(BenchmarkRunner& runner);
+
+/// <summary> Runs the math benchmarks: the throughput of the native dot product and matrix-vector and matrix-matrix
+/// products, and of the OpenBLAS ones when BLAS is available. Names start with "math/". </summary>
+///
+/// <param name="runner"> The benchmark runner. </param>
+void RunMathBenchmarks(BenchmarkRunner& runner);
+}
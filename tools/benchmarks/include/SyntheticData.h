@@ -0,0 +1,47 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SyntheticData.h (benchmarks)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// data
+#include "Dataset.h"
+
+// stl
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ell
+{
+/// <summary> Makes a binary classification dataset with dense Gaussian features, whose labels (+1 or -1) are the
+/// signs of a random linear function of the features plus noise. The same seed always gives the same dataset. </summary>
+///
+/// <param name="numExamples"> The number of examples. </param>
+/// <param name="numFeatures"> The number of features. </param>
+/// <param name="seed"> The random seed. </param>
+///
+/// <returns> The dataset. </returns>
+data::AutoSupervisedDataset MakeSyntheticDataset(size_t numExamples, size_t numFeatures, const std::string& seed = "benchmarks");
+
+/// <summary> Makes random vectors with values drawn from a standard Gaussian. </summary>
+///
+/// <param name="numVectors"> The number of vectors. </param>
+/// <param name="size"> The size of each vector. </param>
+/// <param name="seed"> The random seed. </param>
+///
+/// <returns> The vectors. </returns>
+std::vector<std::vector<double>> MakeRandomVectors(size_t numVectors, size_t size, const std::string& seed = "benchmarks");
+
+/// <summary> Formats a dataset as text, with one example per line: the label followed by index:value pairs for the
+/// nonzero features. This is the format read by SequentialLineIterator and SparseEntryParser. </summary>
+///
+/// <param name="dataset"> The dataset. </param>
+///
+/// <returns> The text. </returns>
+std::string FormatDataset(const data::AutoSupervisedDataset& dataset);
+}
@@ -0,0 +1,61 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BenchmarkArguments.cpp (benchmarks)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BenchmarkArguments.h"
+
+namespace ell
+{
+void ParsedBenchmarkArguments::AddArgs(utilities::CommandLineParser& parser)
+{
+    parser.AddOption(
+        filter,
+        "filter",
+        "f",
+        "Only run the benchmarks whose names contain this string (e.g., 'map/', 'trainer/forest', 'compiled')",
+        "");
+
+    parser.AddOption(
+        minTime,
+        "minTime",
+        "mt",
+        "The minimum time, in seconds, spent in the reported batch of iterations of each benchmark",
+        0.5);
+
+    parser.AddOption(
+        outputFilename,
+        "outputFilename",
+        "of",
+        "Path to the JSON output file, 'null' for no output, or empty for standard output",
+        "");
+}
+
+utilities::CommandLineParseResult ParsedBenchmarkArguments::PostProcess(const utilities::CommandLineParser& parser)
+{
+    std::vector<std::string> errors;
+
+    if (minTime < 0)
+    {
+        errors.push_back("minTime must be non-negative");
+    }
+
+    if (outputFilename == "null")
+    {
+        outputStream = utilities::OutputStreamImpostor(utilities::OutputStreamImpostor::StreamType::null);
+    }
+    else if (outputFilename == "")
+    {
+        outputStream = utilities::OutputStreamImpostor(utilities::OutputStreamImpostor::StreamType::cout);
+    }
+    else // treat argument as filename
+    {
+        outputStream = utilities::OutputStreamImpostor(outputFilename);
+    }
+
+    return errors;
+}
+}
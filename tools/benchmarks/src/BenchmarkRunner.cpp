@@ -0,0 +1,144 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BenchmarkRunner.cpp (benchmarks)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BenchmarkRunner.h"
+
+// stl
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <thread>
+
+namespace ell
+{
+namespace
+{
+    std::string EscapeJsonString(const std::string& str)
+    {
+        std::string result;
+        for (auto ch : str)
+        {
+            if (ch == '"' || ch == '\\')
+            {
+                result += '\\';
+            }
+            result += ch;
+        }
+        return result;
+    }
+
+    std::string GetDateString()
+    {
+        auto now = std::time(nullptr);
+        char buffer[32];
+        std::strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", std::localtime(&now));
+        return buffer;
+    }
+}
+
+BenchmarkRunner::BenchmarkRunner(const std::string& filter, double minTime)
+    : _filter(filter), _minTime(minTime)
+{
+}
+
+bool BenchmarkRunner::IsSelected(const std::string& name) const
+{
+    return _filter.empty() || name.find(_filter) != std::string::npos;
+}
+
+bool BenchmarkRunner::IsAnySelected(const std::vector<std::string>& names) const
+{
+    return std::any_of(names.begin(), names.end(), [this](const std::string& name) { return IsSelected(name); });
+}
+
+void BenchmarkRunner::Run(const std::string& name, size_t itemsPerIteration, const std::function<void()>& iteration)
+{
+    if (!IsSelected(name))
+    {
+        return;
+    }
+
+    // warm up caches and lazily-initialized state
+    iteration();
+
+    BenchmarkResult result;
+    result.name = name;
+    size_t iterations = 1;
+    while (true)
+    {
+        auto cpuStart = std::clock();
+        auto realStart = std::chrono::steady_clock::now();
+        for (size_t index = 0; index < iterations; ++index)
+        {
+            iteration();
+        }
+        std::chrono::duration<double> realElapsed = std::chrono::steady_clock::now() - realStart;
+        double cpuElapsed = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+
+        // stop once the batch is long enough to be measured reliably, or the next one would be too many iterations
+        if (realElapsed.count() >= _minTime || iterations >= 1000000000)
+        {
+            result.iterations = iterations;
+            result.realTime = 1e9 * realElapsed.count() / iterations;
+            result.cpuTime = 1e9 * cpuElapsed / iterations;
+            result.itemsPerSecond = realElapsed.count() > 0 ? static_cast<double>(itemsPerIteration * iterations) / realElapsed.count() : 0;
+            break;
+        }
+
+        // aim for the minimum time, but grow by at least 2x and at most 10x per batch
+        double scale = realElapsed.count() > 0 ? 1.4 * _minTime / realElapsed.count() : 10.0;
+        scale = std::min(std::max(scale, 2.0), 10.0);
+        iterations = static_cast<size_t>(iterations * scale);
+    }
+
+    _results.push_back(result);
+}
+
+void BenchmarkRunner::WriteJson(std::ostream& os) const
+{
+#ifdef NDEBUG
+    const char* buildType = "release";
+#else
+    const char* buildType = "debug";
+#endif
+
+    os << "{\n";
+    os << "  \"context\": {\n";
+    os << "    \"date\": \"" << GetDateString() << "\",\n";
+    os << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+    os << "    \"library_build_type\": \"" << buildType << "\"\n";
+    os << "  },\n";
+    os << "  \"benchmarks\": [";
+    for (size_t index = 0; index < _results.size(); ++index)
+    {
+        const auto& result = _results[index];
+        os << (index == 0 ? "\n" : ",\n");
+        os << "    {\n";
+        os << "      \"name\": \"" << EscapeJsonString(result.name) << "\",\n";
+        os << "      \"iterations\": " << result.iterations << ",\n";
+        os << "      \"real_time\": " << std::setprecision(10) << result.realTime << ",\n";
+        os << "      \"cpu_time\": " << result.cpuTime << ",\n";
+        os << "      \"time_unit\": \"ns\",\n";
+        os << "      \"items_per_second\": " << result.itemsPerSecond << "\n";
+        os << "    }";
+    }
+    os << "\n  ]\n";
+    os << "}\n";
+}
+
+void BenchmarkRunner::Print(std::ostream& os) const
+{
+    os << std::left << std::setw(48) << "benchmark" << std::right << std::setw(16) << "time (ns)" << std::setw(16) << "cpu (ns)" << std::setw(14) << "iterations" << std::setw(16) << "items/s" << '\n';
+    for (const auto& result : _results)
+    {
+        os << std::left << std::setw(48) << result.name << std::right << std::fixed << std::setprecision(0) << std::setw(16) << result.realTime << std::setw(16) << result.cpuTime << std::setw(14) << result.iterations << std::setw(16) << result.itemsPerSecond << '\n';
+    }
+    os.unsetf(std::ios_base::floatfield);
+}
+}
@@ -0,0 +1,65 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DataBenchmarks.cpp (benchmarks)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Benchmarks.h"
+#include "SyntheticData.h"
+
+// data
+#include "CompactDataset.h"
+#include "ParallelTextParser.h"
+#include "ParsingExampleIterator.h"
+#include "SequentialLineIterator.h"
+#include "SparseEntryParser.h"
+
+// utilities
+#include "Files.h"
+
+// stl
+#include <cstdio>
+#include <string>
+
+namespace ell
+{
+namespace
+{
+    const size_t numParsingExamples = 2000;
+    const size_t numParsingFeatures = 50;
+    const char* parsingFilename = "benchmarks_parsing_data.txt";
+}
+
+void RunDataBenchmarks(BenchmarkRunner& runner)
+{
+    if (!runner.IsAnySelected({ "data/parse/sequential", "data/parse/parallel" }))
+    {
+        return;
+    }
+
+    // both benchmarks parse the same file into a CompactDataset, line by line or in concurrent chunks
+    {
+        auto dataset = MakeSyntheticDataset(numParsingExamples, numParsingFeatures);
+        auto stream = utilities::OpenOfstream(parsingFilename);
+        stream << FormatDataset(dataset);
+    }
+
+    runner.Run("data/parse/sequential", numParsingExamples, [&]() {
+        data::CompactDataset parsedDataset;
+        auto exampleIterator = data::GetParsingExampleIterator(data::SequentialLineIterator(parsingFilename), data::SparseEntryParser());
+        while (exampleIterator->IsValid())
+        {
+            parsedDataset.AddExample(exampleIterator->Get());
+            exampleIterator->Next();
+        }
+    });
+
+    runner.Run("data/parse/parallel", numParsingExamples, [&]() {
+        data::ParseCompactDatasetFile(parsingFilename);
+    });
+
+    std::remove(parsingFilename);
+}
+}
\ No newline at end of file
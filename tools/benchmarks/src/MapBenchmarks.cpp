@@ -0,0 +1,135 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     MapBenchmarks.cpp (benchmarks)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Benchmarks.h"
+#include "SyntheticData.h"
+
+// model
+#include "DynamicMap.h"
+#include "IRCompiledMap.h"
+#include "InputNode.h"
+#include "Model.h"
+
+// nodes
+#include "DTWDistanceNode.h"
+#include "ForestPredictorNode.h"
+#include "LinearPredictorNode.h"
+
+// predictors
+#include "LinearPredictor.h"
+
+// trainers
+#include "LogitBooster.h"
+#include "SortingForestTrainer.h"
+
+// lossFunctions
+#include "SquaredLoss.h"
+
+// math
+#include "Vector.h"
+
+// stl
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace
+{
+    const size_t numInputVectors = 256;
+
+    bool IsMapSelected(const BenchmarkRunner& runner, const std::string& name)
+    {
+        return runner.IsAnySelected({ "map/" + name + "/interpreted", "map/" + name + "/compiled" });
+    }
+
+    // Times a single-sample call to the interpreted map, and then to the same map compiled
+    void RunMapBenchmark(BenchmarkRunner& runner, const std::string& name, const model::DynamicMap& map, size_t inputSize)
+    {
+        auto inputs = MakeRandomVectors(numInputVectors, inputSize, name);
+
+        auto interpretedName = "map/" + name + "/interpreted";
+        if (runner.IsSelected(interpretedName))
+        {
+            auto interpretedMap = map;
+            size_t index = 0;
+            runner.Run(interpretedName, 1, [&]() {
+                interpretedMap.SetInputValue(0, inputs[index++ % numInputVectors]);
+                interpretedMap.ComputeOutput<double>(0);
+            });
+        }
+
+        auto compiledName = "map/" + name + "/compiled";
+        if (runner.IsSelected(compiledName))
+        {
+            model::IRCompiledMap compiledMap(map);
+            size_t index = 0;
+            runner.Run(compiledName, 1, [&]() {
+                compiledMap.SetInputValue(0, inputs[index++ % numInputVectors]);
+                compiledMap.ComputeOutput<double>(0);
+            });
+        }
+    }
+
+    model::DynamicMap MakeLinearMap(size_t numFeatures)
+    {
+        auto weights = MakeRandomVectors(1, numFeatures, "linear")[0];
+        predictors::LinearPredictor predictor(math::ColumnVector<double>(std::move(weights)), 0.5);
+
+        model::Model model;
+        auto inputNode = model.AddNode<model::InputNode<double>>(numFeatures);
+        auto predictorNode = model.AddNode<nodes::LinearPredictorNode>(inputNode->output, predictor);
+        return model::DynamicMap(model, { { "input", inputNode } }, { { "output", predictorNode->output } });
+    }
+
+    model::DynamicMap MakeForestMap(size_t numFeatures)
+    {
+        trainers::SortingForestTrainerParameters parameters;
+        parameters.minSplitGain = 0.0;
+        parameters.maxSplitsPerRound = 10;
+        parameters.numRounds = 20;
+        auto trainer = trainers::MakeSortingForestTrainer(lossFunctions::SquaredLoss(), trainers::LogitBooster(), parameters);
+
+        auto dataset = MakeSyntheticDataset(500, numFeatures, "forest");
+        trainer->Update(dataset.GetAnyDataset());
+
+        model::Model model;
+        auto inputNode = model.AddNode<model::InputNode<double>>(numFeatures);
+        auto predictorNode = model.AddNode<nodes::SimpleForestPredictorNode>(inputNode->output, trainer->GetPredictor());
+        return model::DynamicMap(model, { { "input", inputNode } }, { { "output", predictorNode->output } });
+    }
+
+    model::DynamicMap MakeDTWMap(size_t prototypeLength, size_t numChannels)
+    {
+        auto prototype = MakeRandomVectors(prototypeLength, numChannels, "dtw");
+
+        model::Model model;
+        auto inputNode = model.AddNode<model::InputNode<double>>(numChannels);
+        auto dtwNode = model.AddNode<nodes::DTWDistanceNode<double>>(inputNode->output, prototype);
+        return model::DynamicMap(model, { { "input", inputNode } }, { { "output", dtwNode->output } });
+    }
+}
+
+void RunMapBenchmarks(BenchmarkRunner& runner)
+{
+    if (IsMapSelected(runner, "linear"))
+    {
+        RunMapBenchmark(runner, "linear", MakeLinearMap(100), 100);
+    }
+
+    if (IsMapSelected(runner, "forest"))
+    {
+        RunMapBenchmark(runner, "forest", MakeForestMap(20), 20);
+    }
+
+    if (IsMapSelected(runner, "dtw"))
+    {
+        RunMapBenchmark(runner, "dtw", MakeDTWMap(50, 8), 8);
+    }
+}
+}
@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     MathBenchmarks.cpp (benchmarks)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Benchmarks.h"
+
+// math
+#include "Matrix.h"
+#include "Operations.h"
+#include "SparseMatrix.h"
+#include "Vector.h"
+
+// stl
+#include <random>
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace
+{
+    const size_t vectorSize = 4096;
+    const size_t gemvSize = 512;
+    const size_t gemmSize = 256;
+    const size_t sparseSize = 20000;
+    const size_t sparseNonzerosPerRow = 50;
+
+    template <typename ElementType>
+    ElementType GetRandomValue(std::default_random_engine& engine)
+    {
+        std::normal_distribution<ElementType> distribution;
+        return distribution(engine);
+    }
+
+    math::SparseMatrix<double, math::MatrixLayout::rowMajor> GetRandomSparseMatrix(std::default_random_engine& engine)
+    {
+        std::uniform_int_distribution<size_t> indexDistribution(0, sparseSize / sparseNonzerosPerRow - 1);
+        std::vector<size_t> offsets(1, 0);
+        std::vector<size_t> indices;
+        std::vector<double> values;
+        for (size_t i = 0; i < sparseSize; ++i)
+        {
+            // one nonzero in each of sparseNonzerosPerRow equal segments of the row keeps the indices sorted
+            for (size_t k = 0; k < sparseNonzerosPerRow; ++k)
+            {
+                indices.push_back(k * (sparseSize / sparseNonzerosPerRow) + indexDistribution(engine));
+                values.push_back(GetRandomValue<double>(engine));
+            }
+            offsets.push_back(values.size());
+        }
+        return { sparseSize, sparseSize, std::move(offsets), std::move(indices), std::move(values) };
+    }
+
+    // Each benchmark reports the number of multiply-adds per second
+    template <math::ImplementationType Implementation>
+    void RunMathBenchmarks(BenchmarkRunner& runner, const std::string& implementationName)
+    {
+        using Ops = math::OperationsImplementation<Implementation>;
+        std::default_random_engine engine;
+
+        auto dotName = "math/dot/" + implementationName;
+        if (runner.IsSelected(dotName))
+        {
+            math::ColumnVector<double> u(vectorSize);
+            math::ColumnVector<double> v(vectorSize);
+            u.Generate([&]() { return GetRandomValue<double>(engine); });
+            v.Generate([&]() { return GetRandomValue<double>(engine); });
+            double result = 0;
+            runner.Run(dotName, vectorSize, [&]() { result += Ops::Dot(u, v); });
+        }
+
+        auto rowMajorGemvName = "math/gemv/rowMajor/" + implementationName;
+        if (runner.IsSelected(rowMajorGemvName))
+        {
+            math::Matrix<double, math::MatrixLayout::rowMajor> M(gemvSize, gemvSize);
+            math::ColumnVector<double> v(gemvSize);
+            math::ColumnVector<double> u(gemvSize);
+            M.Generate([&]() { return GetRandomValue<double>(engine); });
+            v.Generate([&]() { return GetRandomValue<double>(engine); });
+            runner.Run(rowMajorGemvName, gemvSize * gemvSize, [&]() { Ops::Multiply(1.0, M, v, 0.0, u); });
+        }
+
+        auto columnMajorGemvName = "math/gemv/columnMajor/" + implementationName;
+        if (runner.IsSelected(columnMajorGemvName))
+        {
+            math::Matrix<double, math::MatrixLayout::columnMajor> M(gemvSize, gemvSize);
+            math::ColumnVector<double> v(gemvSize);
+            math::ColumnVector<double> u(gemvSize);
+            M.Generate([&]() { return GetRandomValue<double>(engine); });
+            v.Generate([&]() { return GetRandomValue<double>(engine); });
+            runner.Run(columnMajorGemvName, gemvSize * gemvSize, [&]() { Ops::Multiply(1.0, M, v, 0.0, u); });
+        }
+
+        auto gemmName = "math/gemm/" + implementationName;
+        if (runner.IsSelected(gemmName))
+        {
+            math::Matrix<double, math::MatrixLayout::rowMajor> A(gemmSize, gemmSize);
+            math::Matrix<double, math::MatrixLayout::rowMajor> B(gemmSize, gemmSize);
+            math::Matrix<double, math::MatrixLayout::rowMajor> C(gemmSize, gemmSize);
+            A.Generate([&]() { return GetRandomValue<double>(engine); });
+            B.Generate([&]() { return GetRandomValue<double>(engine); });
+            runner.Run(gemmName, gemmSize * gemmSize * gemmSize, [&]() { Ops::Multiply(1.0, A, B, 0.0, C); });
+        }
+    }
+}
+
+void RunMathBenchmarks(BenchmarkRunner& runner)
+{
+    // sparse operations only have a native implementation
+    std::default_random_engine engine;
+    if (runner.IsAnySelected({ "math/spmv/csr", "math/spmv/transposed/csr" }))
+    {
+        auto M = GetRandomSparseMatrix(engine);
+        math::ColumnVector<double> v(sparseSize);
+        math::ColumnVector<double> u(sparseSize);
+        v.Generate([&]() { return GetRandomValue<double>(engine); });
+        runner.Run("math/spmv/csr", M.NumNonzeros(), [&]() { math::Operations::Multiply(1.0, M, v, 0.0, u); });
+        runner.Run("math/spmv/transposed/csr", M.NumNonzeros(), [&]() { math::Operations::Multiply(1.0, v.Transpose(), M, 0.0, u.Transpose()); });
+    }
+
+    RunMathBenchmarks<math::ImplementationType::native>(runner, "native");
+#ifdef USE_BLAS
+    RunMathBenchmarks<math::ImplementationType::openBlas>(runner, "blas");
+#endif
+}
+}
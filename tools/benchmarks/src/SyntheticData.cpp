@@ -0,0 +1,88 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SyntheticData.cpp (benchmarks)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SyntheticData.h"
+
+// data
+#include "AutoDataVector.h"
+#include "Example.h"
+
+// utilities
+#include "RandomEngines.h"
+
+// stl
+#include <memory>
+#include <random>
+#include <sstream>
+
+namespace ell
+{
+data::AutoSupervisedDataset MakeSyntheticDataset(size_t numExamples, size_t numFeatures, const std::string& seed)
+{
+    auto randomEngine = utilities::GetRandomEngine(seed);
+    std::normal_distribution<double> normal(0.0, 1.0);
+
+    std::vector<double> weights(numFeatures);
+    for (auto& weight : weights)
+    {
+        weight = normal(randomEngine);
+    }
+
+    data::AutoSupervisedDataset dataset;
+    for (size_t exampleIndex = 0; exampleIndex < numExamples; ++exampleIndex)
+    {
+        std::vector<double> features(numFeatures);
+        double score = normal(randomEngine);
+        for (size_t featureIndex = 0; featureIndex < numFeatures; ++featureIndex)
+        {
+            features[featureIndex] = normal(randomEngine);
+            score += weights[featureIndex] * features[featureIndex];
+        }
+        double label = score > 0 ? 1.0 : -1.0;
+        auto dataVector = std::make_shared<data::AutoDataVector>(std::move(features));
+        dataset.AddExample(data::AutoSupervisedExample(dataVector, data::WeightLabel{ 1.0, label }));
+    }
+    return dataset;
+}
+
+std::vector<std::vector<double>> MakeRandomVectors(size_t numVectors, size_t size, const std::string& seed)
+{
+    auto randomEngine = utilities::GetRandomEngine(seed);
+    std::normal_distribution<double> normal(0.0, 1.0);
+
+    std::vector<std::vector<double>> vectors(numVectors, std::vector<double>(size));
+    for (auto& vector : vectors)
+    {
+        for (auto& value : vector)
+        {
+            value = normal(randomEngine);
+        }
+    }
+    return vectors;
+}
+
+std::string FormatDataset(const data::AutoSupervisedDataset& dataset)
+{
+    std::stringstream stream;
+    for (size_t index = 0; index < dataset.NumExamples(); ++index)
+    {
+        const auto& example = dataset.GetExample(index);
+        stream << example.GetMetadata().label;
+        auto values = example.GetDataVector().ToArray();
+        for (size_t featureIndex = 0; featureIndex < values.size(); ++featureIndex)
+        {
+            if (values[featureIndex] != 0)
+            {
+                stream << '\t' << featureIndex << ':' << values[featureIndex];
+            }
+        }
+        stream << '\n';
+    }
+    return stream.str();
+}
+}
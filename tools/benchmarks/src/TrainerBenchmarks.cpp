@@ -0,0 +1,100 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     TrainerBenchmarks.cpp (benchmarks)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Benchmarks.h"
+#include "SyntheticData.h"
+
+// trainers
+#include "HistogramForestTrainer.h"
+#include "LogitBooster.h"
+#include "SDSGDLinearTrainer.h"
+#include "SGDLinearTrainer.h"
+#include "SortingForestTrainer.h"
+#include "ThresholdFinder.h"
+
+// lossFunctions
+#include "LogLoss.h"
+#include "SquaredLoss.h"
+
+namespace ell
+{
+namespace
+{
+    const size_t numLinearExamples = 1000;
+    const size_t numLinearFeatures = 100;
+    const size_t numForestExamples = 1000;
+    const size_t numForestFeatures = 20;
+
+    // Every iteration trains a fresh trainer for one epoch (or one call to Update), so iterations are comparable
+    template <typename MakeTrainerFunction>
+    void RunTrainerBenchmark(BenchmarkRunner& runner, const std::string& name, const data::AutoSupervisedDataset& dataset, MakeTrainerFunction makeTrainer)
+    {
+        auto anyDataset = dataset.GetAnyDataset();
+        runner.Run(name, dataset.NumExamples(), [&]() {
+            auto trainer = makeTrainer();
+            trainer->Update(anyDataset);
+        });
+    }
+
+    trainers::ForestTrainerParameters& SetForestParameters(trainers::ForestTrainerParameters& parameters)
+    {
+        parameters.minSplitGain = 0.0;
+        parameters.maxSplitsPerRound = 10;
+        parameters.numRounds = 10;
+        return parameters;
+    }
+}
+
+void RunTrainerBenchmarks(BenchmarkRunner& runner)
+{
+    if (runner.IsAnySelected({ "trainer/sgd", "trainer/sdsgd" }))
+    {
+        auto dataset = MakeSyntheticDataset(numLinearExamples, numLinearFeatures);
+
+        if (runner.IsSelected("trainer/sgd"))
+        {
+            RunTrainerBenchmark(runner, "trainer/sgd", dataset, []() { return trainers::MakeSGDLinearTrainer(lossFunctions::LogLoss(), trainers::SGDLinearTrainerParameters{ 0.01 }); });
+        }
+        if (runner.IsSelected("trainer/sdsgd"))
+        {
+            RunTrainerBenchmark(runner, "trainer/sdsgd", dataset, []() { return trainers::MakeSDSGDLinearTrainer(lossFunctions::LogLoss(), trainers::SDSGDLinearTrainerParameters{ 0.01 }); });
+        }
+    }
+
+    if (runner.IsAnySelected({ "trainer/forest/sorting", "trainer/forest/sorting/subsampled", "trainer/forest/histogram" }))
+    {
+        auto dataset = MakeSyntheticDataset(numForestExamples, numForestFeatures);
+
+        if (runner.IsSelected("trainer/forest/sorting"))
+        {
+            trainers::SortingForestTrainerParameters parameters;
+            SetForestParameters(parameters);
+            RunTrainerBenchmark(runner, "trainer/forest/sorting", dataset, [&]() { return trainers::MakeSortingForestTrainer(lossFunctions::SquaredLoss(), trainers::LogitBooster(), parameters); });
+        }
+        if (runner.IsSelected("trainer/forest/sorting/subsampled"))
+        {
+            trainers::SortingForestTrainerParameters parameters;
+            SetForestParameters(parameters);
+            parameters.randomSeed = "benchmarks";
+            parameters.rowSampleFraction = 0.2;
+            parameters.largeGradientFraction = 0.1;
+            parameters.featureSampleFraction = 0.5;
+            RunTrainerBenchmark(runner, "trainer/forest/sorting/subsampled", dataset, [&]() { return trainers::MakeSortingForestTrainer(lossFunctions::SquaredLoss(), trainers::LogitBooster(), parameters); });
+        }
+        if (runner.IsSelected("trainer/forest/histogram"))
+        {
+            trainers::HistogramForestTrainerParameters parameters;
+            SetForestParameters(parameters);
+            parameters.randomSeed = "benchmarks";
+            parameters.thresholdFinderSampleSize = numForestExamples;
+            parameters.candidatesPerInput = 32;
+            RunTrainerBenchmark(runner, "trainer/forest/histogram", dataset, [&]() { return trainers::MakeHistogramForestTrainer(lossFunctions::SquaredLoss(), trainers::LogitBooster(), trainers::ExhaustiveThresholdFinder(), parameters); });
+        }
+    }
+}
+}
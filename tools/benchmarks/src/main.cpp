@@ -0,0 +1,69 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     main.cpp (benchmarks)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BenchmarkArguments.h"
+#include "BenchmarkRunner.h"
+#include "Benchmarks.h"
+
+// utilities
+#include "CommandLineParser.h"
+#include "Exception.h"
+
+// stl
+#include <iostream>
+
+using namespace ell;
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        // create a command line parser
+        utilities::CommandLineParser commandLineParser(argc, argv);
+
+        // add arguments to the command line parser
+        ParsedBenchmarkArguments benchmarkArguments;
+        commandLineParser.AddOptionSet(benchmarkArguments);
+
+        // parse command line
+        commandLineParser.Parse();
+
+        BenchmarkRunner runner(benchmarkArguments.filter, benchmarkArguments.minTime);
+
+        // each group skips the setup of the benchmarks that the filter does not select
+        RunMapBenchmarks(runner);
+        RunTrainerBenchmarks(runner);
+        RunDataBenchmarks(runner);
+        RunMathBenchmarks(runner);
+
+        // the table goes to stderr, so that the JSON output can be redirected from stdout
+        runner.Print(std::cerr);
+        runner.WriteJson(benchmarkArguments.outputStream);
+    }
+    catch (const utilities::CommandLineParserPrintHelpException& exception)
+    {
+        std::cout << exception.GetHelpText() << std::endl;
+        return 0;
+    }
+    catch (const utilities::CommandLineParserErrorException& exception)
+    {
+        std::cerr << "Command line parse error:" << std::endl;
+        for (const auto& error : exception.GetParseErrors())
+        {
+            std::cerr << error.GetMessage() << std::endl;
+        }
+        return 1;
+    }
+    catch (const utilities::Exception& exception)
+    {
+        std::cerr << "exception: " << exception.GetMessage() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
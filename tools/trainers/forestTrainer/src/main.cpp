@@ -108,8 +108,22 @@ int main(int argc, char* argv[])
         // predictor type
         using PredictorType = predictors::SimpleForestPredictor;
 
+        // load the forest that training continues from
+        PredictorType initialPredictor;
+        if (forestTrainerArguments.warmStartModelFilename != "")
+        {
+            if (trainerArguments.verbose) std::cout << "Loading warm start model ..." << std::endl;
+            auto warmStartModel = common::LoadModel(forestTrainerArguments.warmStartModelFilename);
+            auto forestNodes = warmStartModel.GetNodesByType<nodes::SimpleForestPredictorNode>();
+            if (forestNodes.size() != 1)
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::badData, "warm start model must contain exactly one forest predictor node");
+            }
+            initialPredictor = forestNodes[0]->GetForest();
+        }
+
         // create trainer
-        auto trainer = common::MakeForestTrainer(trainerArguments.lossArguments, forestTrainerArguments);
+        auto trainer = common::MakeForestTrainer(trainerArguments.lossArguments, forestTrainerArguments, initialPredictor);
 
         // in verbose mode, create an evaluator and wrap the sgd trainer with an evaluatingTrainer
         std::shared_ptr<evaluators::IEvaluator<PredictorType>> evaluator = nullptr;
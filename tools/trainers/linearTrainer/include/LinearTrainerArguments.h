@@ -24,6 +24,12 @@ struct LinearTrainerArguments
     Algorithm algorithm = Algorithm::SGD;
 
     double regularization;
+
+    // if positive, the data file is streamed in blocks of this many examples instead of being loaded into memory
+    size_t streamingBlockSize = 0;
+
+    // when streaming, whether the examples of each block are visited in random order
+    bool permuteStreamingBlocks = true;
 };
 
 /// <summary> Parsed version of LinearTrainerArguments. </summary>
@@ -25,5 +25,17 @@ void ParsedLinearTrainerArguments::AddArgs(utilities::CommandLineParser& parser)
                      "r",
                      "The L2 regularization parameter",
                      1.0);
+
+    parser.AddOption(streamingBlockSize,
+                     "streamingBlockSize",
+                     "sbs",
+                     "If positive, stream the data file in blocks of this many examples during each epoch, instead of loading it into memory",
+                     0);
+
+    parser.AddOption(permuteStreamingBlocks,
+                     "permuteStreamingBlocks",
+                     "psb",
+                     "When streaming, visit the examples of each block in random order, seeded by dataPermutationRandomSeed",
+                     true);
 }
 }
@@ -57,7 +57,9 @@
 #include "LogLoss.h"
 
 // stl
+#include <algorithm>
 #include <iostream>
+#include <limits>
 #include <memory>
 
 using namespace ell;
@@ -99,9 +101,14 @@ int main(int argc, char* argv[])
         mapLoadArguments.defaultInputSize = dataLoadArguments.parsedDataDimension;
         model::DynamicMap map = common::LoadMap(mapLoadArguments);
 
-        // load dataset
-        if (trainerArguments.verbose) std::cout << "Loading data ..." << std::endl;
-        auto mappedDataset = common::GetMappedDataset(dataLoadArguments, map);
+        // load dataset, unless it is streamed in blocks during training
+        bool isStreaming = linearTrainerArguments.streamingBlockSize > 0;
+        data::AutoSupervisedDataset mappedDataset;
+        if (!isStreaming)
+        {
+            if (trainerArguments.verbose) std::cout << "Loading data ..." << std::endl;
+            mappedDataset = common::GetMappedDataset(dataLoadArguments, map);
+        }
         auto mappedDatasetDimension = map.GetOutput(0).Size();
 
         // predictor type
@@ -121,20 +128,46 @@ int main(int argc, char* argv[])
                 throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "unrecognized algorithm type");
         }
 
-        // in verbose mode, create an evaluator and wrap the sgd trainer with an evaluatingTrainer
+        // in verbose mode, create an evaluator and wrap the sgd trainer with an evaluatingTrainer (the evaluator needs the entire dataset, so it isn't available when streaming)
         std::shared_ptr<evaluators::IEvaluator<PredictorType>> evaluator = nullptr;
-        if (trainerArguments.verbose)
+        if (trainerArguments.verbose && !isStreaming)
         {
             evaluator = common::MakeEvaluator<PredictorType>(mappedDataset.GetAnyDataset(), evaluatorArguments, trainerArguments.lossArguments);
             trainer = std::make_unique<trainers::EvaluatingIncrementalTrainer<PredictorType>>(trainers::MakeEvaluatingIncrementalTrainer(std::move(trainer), evaluator));
         }
 
-        // create multi epoch trainer
-        trainer = trainers::MakeMultiEpochIncrementalTrainer(std::move(trainer), multiEpochTrainerArguments);
-
         // Train the predictor
         if (trainerArguments.verbose) std::cout << "Training ..." << std::endl;
-        trainer->Update(mappedDataset.GetAnyDataset());
+        if (isStreaming)
+        {
+            // each epoch streams the data file again, parsing and mapping the next block on a background thread
+            // while the trainer makes a pass over the current block. An epoch ends after epochSize examples (if
+            // positive), which are the first examples of the file rather than a random sample of all of them.
+            auto rng = utilities::GetRandomEngine(multiEpochTrainerArguments.dataPermutationRandomSeed);
+            for (size_t epoch = 0; epoch < multiEpochTrainerArguments.numEpochs; ++epoch)
+            {
+                size_t numRemainingExamples = multiEpochTrainerArguments.epochSize > 0 ? multiEpochTrainerArguments.epochSize : std::numeric_limits<size_t>::max();
+                auto blockIterator = common::GetMappedDatasetBlockIterator(dataLoadArguments, map, linearTrainerArguments.streamingBlockSize);
+                while (blockIterator->IsValid() && numRemainingExamples > 0)
+                {
+                    auto blockAnyDataset = blockIterator->Get().GetAnyDataset();
+                    auto exampleIndices = blockAnyDataset.GetExampleIndices();
+                    if (linearTrainerArguments.permuteStreamingBlocks)
+                    {
+                        data::RandomPermute(exampleIndices, rng);
+                    }
+                    auto numExamples = std::min(exampleIndices.size(), numRemainingExamples);
+                    trainer->Update(blockAnyDataset.GetIndexedAnyDataset(exampleIndices, 0, numExamples));
+                    numRemainingExamples -= numExamples;
+                    blockIterator->Next();
+                }
+            }
+        }
+        else
+        {
+            trainer = trainers::MakeMultiEpochIncrementalTrainer(std::move(trainer), multiEpochTrainerArguments);
+            trainer->Update(mappedDataset.GetAnyDataset());
+        }
         predictors::LinearPredictor predictor(trainer->GetPredictor());
         predictor.Resize(mappedDatasetDimension);
 
@@ -144,9 +177,12 @@ int main(int argc, char* argv[])
             std::cout << "Finished training.\n";
 
             // print evaluation
-            std::cout << "Training error\n";
-            evaluator->Print(std::cout);
-            std::cout << std::endl;
+            if (evaluator != nullptr)
+            {
+                std::cout << "Training error\n";
+                evaluator->Print(std::cout);
+                std::cout << std::endl;
+            }
         }
 
         // Save predictor model
@@ -24,6 +24,12 @@ struct ApplyArguments
 
     /// <summary> Instead of raw output, report a summary. </summary>
     bool summarize = false;
+
+    /// <summary> Compile the map and apply the compiled code. </summary>
+    bool compile = false;
+
+    /// <summary> Report the time spent in each type of node. </summary>
+    bool profile = false;
 };
 
 /// <summary> Parsed command line arguments for the compile executable. </summary>
@@ -25,6 +25,20 @@ void ParsedApplyArguments::AddArgs(utilities::CommandLineParser& parser)
         "s",
         "Aggregate and summarize map output.",
         false);
+
+    parser.AddOption(
+        compile,
+        "compile",
+        "c",
+        "Compile the map and apply the compiled code instead of interpreting the map.",
+        false);
+
+    parser.AddOption(
+        profile,
+        "profile",
+        "p",
+        "Print the number of calls, time and bytes touched for each type of node to stderr (time is in ms when interpreting and in cycles when compiled).",
+        false);
 }
 
 utilities::CommandLineParseResult ParsedApplyArguments::PostProcess(const utilities::CommandLineParser& parser)
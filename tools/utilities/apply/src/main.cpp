@@ -28,8 +28,10 @@
 
 // model
 #include "DynamicMap.h"
+#include "IRCompiledMap.h"
 #include "InputNode.h"
 #include "Model.h"
+#include "ModelProfile.h"
 #include "OutputNode.h"
 
 // stl
@@ -62,8 +64,21 @@ int main(int argc, char* argv[])
         // parse command line
         commandLineParser.Parse();
 
-        // load map
-        auto map = common::LoadMap(mapLoadArguments);
+        // load map, and compile it if requested
+        auto loadedMap = common::LoadMap(mapLoadArguments);
+        std::unique_ptr<model::IRCompiledMap> compiledMap = nullptr;
+        if (applyArguments.compile)
+        {
+            compiledMap = std::make_unique<model::IRCompiledMap>(std::move(loadedMap), "predict", true, applyArguments.profile);
+        }
+        model::DynamicMap& map = compiledMap != nullptr ? *compiledMap : loadedMap;
+
+        // profile the interpreter, if requested (the compiled code keeps its own profile table)
+        model::ModelProfile interpreterProfile;
+        if (applyArguments.profile && compiledMap == nullptr)
+        {
+            map.GetModel().SetProfile(&interpreterProfile);
+        }
 
         // get data iterator
         auto dataIterator = GetDataIterator(dataLoadArguments);
@@ -131,6 +146,18 @@ int main(int argc, char* argv[])
                 dataIterator->Next();
             }
         }
+
+        if (applyArguments.profile)
+        {
+            if (compiledMap != nullptr)
+            {
+                compiledMap->GetProfile().Print(std::cerr);
+            }
+            else
+            {
+                interpreterProfile.Print(std::cerr);
+            }
+        }
     }
     catch (const utilities::CommandLineParserPrintHelpException& exception)
     {
@@ -48,6 +48,12 @@ struct CompileArguments
 
     /// <summary> If output type is ASM then we need a target cpu (cortex-m0 or cortex-m4). </summary>
     std::string cpu = "cortex-m0";
+
+    /// <summary> true to instrument the compiled code with per-node call and cycle counters. </summary>
+    bool profile = false;
+
+    /// <summary> true to allow optimizations that change floating-point results, such as reassociating operations. </summary>
+    bool relaxedPrecision = false;
 };
 
 /// <summary> Parsed command line arguments for the compile executable. </summary>
@@ -58,6 +58,20 @@ void ParsedCompileArguments::AddArgs(utilities::CommandLineParser& parser)
         "The CPU target for generating assembly code (only valid if outputType is 'asm')",
         { { "cortex-m0", "cortex-m0" }, { "cortex-m4", "cortex-m4" } },
         "cortex-m0");
+
+    parser.AddOption(
+        profile,
+        "profile",
+        "p",
+        "Instrument the compiled code with per-node call and cycle counters, and print the layout of the profile table to stderr",
+        false);
+
+    parser.AddOption(
+        relaxedPrecision,
+        "relaxedPrecision",
+        "rp",
+        "Allow optimizations that change floating-point results, such as reassociating chains of additions or multiplications",
+        false);
 }
 
 utilities::CommandLineParseResult ParsedCompileArguments::PostProcess(const utilities::CommandLineParser& parser)
@@ -31,6 +31,7 @@
 #include "IRMapCompiler.h"
 #include "InputNode.h"
 #include "Model.h"
+#include "ModelProfile.h"
 #include "OutputNode.h"
 
 // stl
@@ -73,7 +74,17 @@ int main(int argc, char* argv[])
         }
         else
         {
-            model::IRCompiledMap compiledMap{ std::move(map), compileArguments.compiledFunctionName, compileArguments.optimize };
+            model::IRCompiledMap compiledMap{ std::move(map), compileArguments.compiledFunctionName, compileArguments.optimize, compileArguments.profile, compileArguments.relaxedPrecision };
+            if (compileArguments.profile)
+            {
+                // the compiled code counts calls in <function>_profileCallCounts and cycles in <function>_profileCycles
+                const auto& profiledNodes = compiledMap.GetProfiledNodes();
+                std::cerr << "index\tnode\tnode type\tbytes per call\n";
+                for (size_t index = 0; index < profiledNodes.size(); ++index)
+                {
+                    std::cerr << index << '\t' << profiledNodes[index]->GetId() << '\t' << profiledNodes[index]->GetRuntimeTypeName() << '\t' << model::ModelProfile::GetBytesTouchedPerCall(*profiledNodes[index]) << '\n';
+                }
+            }
             switch (compileArguments.outputType)
             {
                 case CompileArguments::OutputType::compiledMap:
@@ -0,0 +1,41 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ConvertDatasetArguments.h (convertDataset)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// utilities
+#include "CommandLineParser.h"
+
+// stl
+#include <string>
+
+namespace ell
+{
+/// <summary> Arguments for convertDataset. </summary>
+struct ConvertDatasetArguments
+{
+    std::string outputDataFilename;
+    bool dense = false;
+};
+
+/// <summary> Arguments for parsed convertDataset. </summary>
+struct ParsedConvertDatasetArguments : public ConvertDatasetArguments, public utilities::ParsedArgSet
+{
+    /// <summary> Adds the arguments. </summary>
+    ///
+    /// <param name="parser"> [in,out] The parser. </param>
+    virtual void AddArgs(utilities::CommandLineParser& parser);
+
+    /// <summary> Check arguments. </summary>
+    ///
+    /// <param name="parser"> The parser. </param>
+    ///
+    /// <returns> An utilities::CommandLineParseResult. </returns>
+    virtual utilities::CommandLineParseResult PostProcess(const utilities::CommandLineParser& parser);
+};
+}
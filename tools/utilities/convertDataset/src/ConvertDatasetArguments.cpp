@@ -0,0 +1,28 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ConvertDatasetArguments.cpp (convertDataset)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ConvertDatasetArguments.h"
+
+namespace ell
+{
+void ParsedConvertDatasetArguments::AddArgs(utilities::CommandLineParser& parser)
+{
+    parser.AddOption(outputDataFilename, "outputDataFilename", "odf", "Path to the output binary dataset file", "");
+    parser.AddOption(dense, "dense", "d", "Store the examples in the dense layout, rather than the sparse layout", false);
+}
+
+utilities::CommandLineParseResult ParsedConvertDatasetArguments::PostProcess(const utilities::CommandLineParser& parser)
+{
+    std::vector<std::string> parseErrorMessages;
+    if (outputDataFilename == "")
+    {
+        parseErrorMessages.push_back("Must specify an output data file");
+    }
+    return parseErrorMessages;
+}
+}
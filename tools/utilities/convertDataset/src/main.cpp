@@ -0,0 +1,78 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     main.cpp (convertDataset)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ConvertDatasetArguments.h"
+
+// common
+#include "DataLoadArguments.h"
+
+// data
+#include "CompactDataset.h"
+#include "ParallelTextParser.h"
+
+// utilities
+#include "CommandLineParser.h"
+#include "Exception.h"
+
+// stl
+#include <fstream>
+#include <iostream>
+
+using namespace ell;
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        // create a command line parser
+        utilities::CommandLineParser commandLineParser(argc, argv);
+
+        // add arguments to the command line parser
+        common::ParsedDataLoadArguments dataLoadArguments;
+        ParsedConvertDatasetArguments convertDatasetArguments;
+        commandLineParser.AddOptionSet(dataLoadArguments);
+        commandLineParser.AddOptionSet(convertDatasetArguments);
+        commandLineParser.Parse();
+
+        // parse the text dataset into contiguous storage
+        auto layout = convertDatasetArguments.dense ? data::CompactDataset::Layout::dense : data::CompactDataset::Layout::sparse;
+        auto dataset = data::ParseCompactDatasetFile(dataLoadArguments.inputDataFilename, layout);
+
+        // write it in the binary format
+        std::ofstream outputStream(convertDatasetArguments.outputDataFilename, std::ios::binary);
+        if (!outputStream.is_open())
+        {
+            throw utilities::SystemException(utilities::SystemExceptionErrors::fileNotWritable, "error opening file " + convertDatasetArguments.outputDataFilename);
+        }
+        dataset.Write(outputStream);
+
+        std::cout << "Wrote " << dataset.NumExamples() << " examples with " << dataset.NumStoredValues() << " stored values to " << convertDatasetArguments.outputDataFilename << std::endl;
+    }
+    catch (const utilities::CommandLineParserPrintHelpException& exception)
+    {
+        std::cout << exception.GetHelpText() << std::endl;
+        return 0;
+    }
+    catch (const utilities::CommandLineParserErrorException& exception)
+    {
+        std::cerr << "Command line parse error:" << std::endl;
+        for (const auto& error : exception.GetParseErrors())
+        {
+            std::cerr << error.GetMessage() << std::endl;
+        }
+        return 1;
+    }
+    catch (const utilities::Exception& exception)
+    {
+        std::cerr << "exception: " << exception.GetMessage() << std::endl;
+        return 1;
+    }
+
+    // the end
+    return 0;
+}